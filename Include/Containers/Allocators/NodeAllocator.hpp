@@ -0,0 +1,17 @@
+#pragma once
+
+namespace Edvar::Containers::Allocators {
+/**
+ * @brief Allocator for node based containers. Hands out single, fixed-size blocks instead of growing arrays like
+ * DefaultAllocator does.
+ *
+ * Any type with the same Allocate/Free signatures (e.g. a pool) can be used in place of this one.
+ */
+class DefaultNodeAllocator {
+public:
+    void* Allocate(const uint64_t Size, const uint64_t Alignment) {
+        return ::operator new(Size, static_cast<std::align_val_t>(Alignment));
+    }
+    void Free(void* Ptr, const uint64_t Alignment) { ::operator delete(Ptr, static_cast<std::align_val_t>(Alignment)); }
+};
+} // namespace Edvar::Containers::Allocators
@@ -0,0 +1,834 @@
+#pragma once
+#include "Containers/Allocators/NodeAllocator.hpp"
+#include "Containers/List.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define EDVAR_CPP_CORE_BTREE_SSE2 1
+#    include <emmintrin.h>
+#else
+#    define EDVAR_CPP_CORE_BTREE_SSE2 0
+#endif
+
+namespace Edvar::Containers {
+
+namespace _BTreePrivate {
+struct NoValue {};
+
+/**
+ * Keys per node. Sized so the key array of a node spans a few cache lines, which keeps the in-node search a short
+ * linear (SIMD) scan instead of a chain of dependent branches.
+ */
+template <typename K> constexpr int32_t NodeCapacityFor() {
+    constexpr int32_t ByKeySize = static_cast<int32_t>(256 / sizeof(K));
+    constexpr int32_t Clamped = ByKeySize < 8 ? 8 : (ByKeySize > 64 ? 64 : ByKeySize);
+    return Clamped & ~1; // must be even for split/merge symmetry
+}
+
+/**
+ * @return Number of keys in [Keys, Keys + Count) that compare less than Key (or less-or-equal when Inclusive).
+ */
+template <bool Inclusive, typename K>
+EDVAR_CPP_CORE_FORCE_INLINE int32_t CountBelow(const K* Keys, const int32_t Count, const K& Key) {
+    if constexpr (std::is_arithmetic_v<K>) {
+        int32_t i = 0;
+        int32_t result = 0;
+#if EDVAR_CPP_CORE_BTREE_SSE2
+        if constexpr (std::is_same_v<K, int32_t> || std::is_same_v<K, float>) {
+            // Compare four keys at a time. True lanes are all ones (-1), so subtracting them counts matches.
+            __m128i accumulator = _mm_setzero_si128();
+            for (; i + 4 <= Count; i += 4) {
+                __m128i mask;
+                if constexpr (std::is_same_v<K, int32_t>) {
+                    const __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Keys + i));
+                    const __m128i key = _mm_set1_epi32(Key);
+                    mask = Inclusive ? _mm_xor_si128(_mm_cmpgt_epi32(keys, key), _mm_set1_epi32(-1))
+                                     : _mm_cmplt_epi32(keys, key);
+                } else {
+                    const __m128 keys = _mm_loadu_ps(Keys + i);
+                    const __m128 key = _mm_set1_ps(Key);
+                    mask = _mm_castps_si128(Inclusive ? _mm_cmple_ps(keys, key) : _mm_cmplt_ps(keys, key));
+                }
+                accumulator = _mm_sub_epi32(accumulator, mask);
+            }
+            alignas(16) int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), accumulator);
+            result = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        }
+#endif
+        // Branch-free so the compiler can vectorise it for the remaining arithmetic key types.
+        for (; i < Count; ++i) {
+            if constexpr (Inclusive) {
+                result += (Key < Keys[i]) ? 0 : 1;
+            } else {
+                result += (Keys[i] < Key) ? 1 : 0;
+            }
+        }
+        return result;
+    } else {
+        // Non-arithmetic keys can be expensive to compare, binary search keeps the comparisons at log2(Count).
+        int32_t low = 0;
+        int32_t high = Count;
+        while (low < high) {
+            const int32_t mid = (low + high) / 2;
+            const bool below = Inclusive ? !(Key < Keys[mid]) : (Keys[mid] < Key);
+            if (below) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+}
+
+template <typename K, typename V, typename AllocatorT> class BTree {
+public:
+    static constexpr int32_t Capacity = NodeCapacityFor<K>();
+    static constexpr int32_t MinLeafCount = Capacity / 2;
+    static constexpr int32_t MinInternalCount = Capacity / 2 - 1;
+    static constexpr int32_t MaxDepth = 32;
+
+    struct alignas(64) Node {
+        int32_t Count = 0;
+        bool IsLeaf = true;
+        K Keys[Capacity];
+    };
+    struct LeafNode : Node {
+        V Values[Capacity];
+        LeafNode* Next = nullptr;
+        LeafNode* Previous = nullptr;
+    };
+    struct InternalNode : Node {
+        Node* Children[Capacity + 1] = {};
+    };
+
+    struct Position {
+        LeafNode* Leaf = nullptr;
+        int32_t Index = 0;
+        bool operator==(const Position& other) const { return Leaf == other.Leaf && Index == other.Index; }
+        bool operator!=(const Position& other) const { return !((*this) == other); }
+        void Advance() {
+            if (++Index >= Leaf->Count) {
+                Leaf = Leaf->Next;
+                Index = 0;
+            }
+        }
+        void Retreat(const BTree& tree) {
+            if (Leaf == nullptr) {
+                Leaf = tree.Last;
+                Index = Leaf != nullptr ? Leaf->Count - 1 : 0;
+            } else if (--Index < 0) {
+                Leaf = Leaf->Previous;
+                Index = Leaf != nullptr ? Leaf->Count - 1 : 0;
+            }
+        }
+    };
+
+    BTree() = default;
+    BTree(const BTree& other) : Allocator() { CopyFrom(other); }
+    BTree(BTree&& other) noexcept
+        : Root(other.Root), First(other.First), Last(other.Last), Size(other.Size),
+          Allocator(std::move(other.Allocator)) {
+        other.Root = nullptr;
+        other.First = nullptr;
+        other.Last = nullptr;
+        other.Size = 0;
+    }
+    ~BTree() { Clear(); }
+
+    BTree& operator=(const BTree& other) {
+        if (this != &other) {
+            Clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+    BTree& operator=(BTree&& other) noexcept {
+        if (this != &other) {
+            Clear();
+            Root = other.Root;
+            First = other.First;
+            Last = other.Last;
+            Size = other.Size;
+            Allocator = std::move(other.Allocator);
+            other.Root = nullptr;
+            other.First = nullptr;
+            other.Last = nullptr;
+            other.Size = 0;
+        }
+        return *this;
+    }
+
+    void Clear() {
+        if (Root != nullptr) {
+            FreeSubtree(Root);
+        }
+        Root = nullptr;
+        First = nullptr;
+        Last = nullptr;
+        Size = 0;
+    }
+
+    [[nodiscard]] int32_t Length() const { return Size; }
+
+    [[nodiscard]] Position Begin() const { return Position{First, 0}; }
+    [[nodiscard]] Position End() const { return Position{}; }
+
+    /**
+     * @return Position of the first key not less than Key (Inclusive = false) or greater than Key (Inclusive = true).
+     */
+    template <bool Inclusive> [[nodiscard]] Position Bound(const K& Key) const {
+        if (Root == nullptr) {
+            return End();
+        }
+        const Node* node = Root;
+        while (!node->IsLeaf) {
+            const auto* internal = static_cast<const InternalNode*>(node);
+            node = internal->Children[CountBelow<true>(internal->Keys, internal->Count, Key)];
+        }
+        auto* leaf = const_cast<LeafNode*>(static_cast<const LeafNode*>(node));
+        const int32_t index = CountBelow<Inclusive>(leaf->Keys, leaf->Count, Key);
+        if (index >= leaf->Count) {
+            return Position{leaf->Next, 0};
+        }
+        return Position{leaf, index};
+    }
+
+    [[nodiscard]] Position Find(const K& Key) const {
+        const Position position = Bound<false>(Key);
+        if (position.Leaf != nullptr && !(Key < position.Leaf->Keys[position.Index])) {
+            return position;
+        }
+        return End();
+    }
+
+    /**
+     * @brief Inserts Key, or assigns Value if the key already exists.
+     * @return true if a new key was added.
+     */
+    template <typename ValueArgT> bool Insert(const K& Key, ValueArgT&& Value) {
+        if (Root == nullptr) {
+            LeafNode* leaf = NewLeaf();
+            leaf->Keys[0] = Key;
+            leaf->Values[0] = std::forward<ValueArgT>(Value);
+            leaf->Count = 1;
+            Root = leaf;
+            First = leaf;
+            Last = leaf;
+            Size = 1;
+            return true;
+        }
+
+        PathEntry path[MaxDepth];
+        int32_t depth = 0;
+        LeafNode* leaf = Descend(Key, path, depth);
+        const int32_t index = CountBelow<false>(leaf->Keys, leaf->Count, Key);
+        if (index < leaf->Count && !(Key < leaf->Keys[index])) {
+            leaf->Values[index] = std::forward<ValueArgT>(Value);
+            return false;
+        }
+
+        if (leaf->Count < Capacity) {
+            InsertIntoLeaf(leaf, index, Key, std::forward<ValueArgT>(Value));
+        } else {
+            LeafNode* right = SplitLeaf(leaf);
+            if (index > leaf->Count) {
+                InsertIntoLeaf(right, index - leaf->Count, Key, std::forward<ValueArgT>(Value));
+            } else {
+                InsertIntoLeaf(leaf, index, Key, std::forward<ValueArgT>(Value));
+            }
+            InsertIntoParent(path, depth - 1, leaf, right->Keys[0], right);
+        }
+        ++Size;
+        return true;
+    }
+
+    /**
+     * @return true if the key was found and removed.
+     */
+    bool Remove(const K& Key) {
+        if (Root == nullptr) {
+            return false;
+        }
+        PathEntry path[MaxDepth];
+        int32_t depth = 0;
+        LeafNode* leaf = Descend(Key, path, depth);
+        const int32_t index = CountBelow<false>(leaf->Keys, leaf->Count, Key);
+        if (index >= leaf->Count || Key < leaf->Keys[index]) {
+            return false;
+        }
+        for (int32_t i = index; i < leaf->Count - 1; ++i) {
+            leaf->Keys[i] = std::move(leaf->Keys[i + 1]);
+            leaf->Values[i] = std::move(leaf->Values[i + 1]);
+        }
+        --leaf->Count;
+        --Size;
+        RebalanceLeaf(leaf, path, depth - 1);
+        return true;
+    }
+
+    /**
+     * @brief Replaces the content with Count entries. Keys must be strictly ascending. Leaves are filled evenly
+     * and the tree is built bottom-up in O(Count). Values may be nullptr for sets.
+     */
+    void BulkLoad(const K* Keys, const V* Values, const int32_t Count) {
+        Clear();
+        if (Count <= 0) {
+            return;
+        }
+        for (int32_t i = 1; i < Count; ++i) {
+            if (!(Keys[i - 1] < Keys[i])) [[unlikely]] {
+                Platform::GetPlatform().OnFatalError(u"BTree: BulkLoad input is not sorted or has duplicate keys.");
+                return;
+            }
+        }
+
+        // Every level is appended behind the previous one, [levelStart, levelEnd) is the level being grouped.
+        const int32_t leafCount = (Count + Capacity - 1) / Capacity;
+        List<Node*> nodes;
+        List<K> minKeys;
+        nodes.EnsureCapacity(leafCount * 2);
+        minKeys.EnsureCapacity(leafCount * 2);
+        int32_t consumed = 0;
+        LeafNode* previous = nullptr;
+        for (int32_t l = 0; l < leafCount; ++l) {
+            const int32_t take = (Count - consumed) / (leafCount - l);
+            LeafNode* leaf = NewLeaf();
+            for (int32_t i = 0; i < take; ++i) {
+                leaf->Keys[i] = Keys[consumed + i];
+                if constexpr (!std::is_same_v<V, NoValue>) {
+                    leaf->Values[i] = Values[consumed + i];
+                }
+            }
+            leaf->Count = take;
+            leaf->Previous = previous;
+            if (previous != nullptr) {
+                previous->Next = leaf;
+            } else {
+                First = leaf;
+            }
+            previous = leaf;
+            nodes.Add(leaf);
+            minKeys.Add(Keys[consumed]);
+            consumed += take;
+        }
+        Last = previous;
+
+        int32_t levelStart = 0;
+        int32_t levelEnd = nodes.Length();
+        while (levelEnd - levelStart > 1) {
+            const int32_t childCount = levelEnd - levelStart;
+            const int32_t parentCount = (childCount + Capacity) / (Capacity + 1);
+            int32_t used = levelStart;
+            for (int32_t p = 0; p < parentCount; ++p) {
+                const int32_t take = (levelEnd - used) / (parentCount - p);
+                InternalNode* parent = NewInternal();
+                parent->Children[0] = nodes[used];
+                for (int32_t i = 1; i < take; ++i) {
+                    parent->Keys[i - 1] = minKeys[used + i];
+                    parent->Children[i] = nodes[used + i];
+                }
+                parent->Count = take - 1;
+                K parentMinKey = minKeys[used];
+                nodes.Add(parent);
+                minKeys.Add(std::move(parentMinKey));
+                used += take;
+            }
+            levelStart = levelEnd;
+            levelEnd = nodes.Length();
+        }
+        Root = nodes[levelStart];
+        Size = Count;
+    }
+
+private:
+    struct PathEntry {
+        InternalNode* Parent;
+        int32_t ChildIndex;
+    };
+
+    Node* Root = nullptr;
+    LeafNode* First = nullptr;
+    LeafNode* Last = nullptr;
+    int32_t Size = 0;
+    AllocatorT Allocator;
+
+    LeafNode* NewLeaf() { return new (Allocator.Allocate(sizeof(LeafNode), alignof(LeafNode))) LeafNode(); }
+    InternalNode* NewInternal() {
+        auto* node = new (Allocator.Allocate(sizeof(InternalNode), alignof(InternalNode))) InternalNode();
+        node->IsLeaf = false;
+        return node;
+    }
+    void FreeNode(Node* node) {
+        if (node->IsLeaf) {
+            auto* leaf = static_cast<LeafNode*>(node);
+            leaf->~LeafNode();
+            Allocator.Free(leaf, alignof(LeafNode));
+        } else {
+            auto* internal = static_cast<InternalNode*>(node);
+            internal->~InternalNode();
+            Allocator.Free(internal, alignof(InternalNode));
+        }
+    }
+    void FreeSubtree(Node* node) {
+        if (!node->IsLeaf) {
+            auto* internal = static_cast<InternalNode*>(node);
+            for (int32_t i = 0; i <= internal->Count; ++i) {
+                FreeSubtree(internal->Children[i]);
+            }
+        }
+        FreeNode(node);
+    }
+
+    void CopyFrom(const BTree& other) {
+        if (other.Size == 0) {
+            return;
+        }
+        List<K> keys;
+        List<V> values;
+        keys.EnsureCapacity(other.Size);
+        values.EnsureCapacity(other.Size);
+        for (Position position = other.Begin(); position != other.End(); position.Advance()) {
+            keys.Add(position.Leaf->Keys[position.Index]);
+            values.Add(position.Leaf->Values[position.Index]);
+        }
+        BulkLoad(keys.Data(), values.Data(), keys.Length());
+    }
+
+    LeafNode* Descend(const K& Key, PathEntry* path, int32_t& depth) const {
+        Node* node = Root;
+        while (!node->IsLeaf) {
+            auto* internal = static_cast<InternalNode*>(node);
+            const int32_t childIndex = CountBelow<true>(internal->Keys, internal->Count, Key);
+            path[depth++] = PathEntry{internal, childIndex};
+            node = internal->Children[childIndex];
+        }
+        return static_cast<LeafNode*>(node);
+    }
+
+    template <typename ValueArgT>
+    static void InsertIntoLeaf(LeafNode* leaf, const int32_t index, const K& Key, ValueArgT&& Value) {
+        for (int32_t i = leaf->Count; i > index; --i) {
+            leaf->Keys[i] = std::move(leaf->Keys[i - 1]);
+            leaf->Values[i] = std::move(leaf->Values[i - 1]);
+        }
+        leaf->Keys[index] = Key;
+        leaf->Values[index] = std::forward<ValueArgT>(Value);
+        ++leaf->Count;
+    }
+
+    LeafNode* SplitLeaf(LeafNode* leaf) {
+        LeafNode* right = NewLeaf();
+        const int32_t keep = Capacity / 2;
+        for (int32_t i = keep; i < leaf->Count; ++i) {
+            right->Keys[i - keep] = std::move(leaf->Keys[i]);
+            right->Values[i - keep] = std::move(leaf->Values[i]);
+        }
+        right->Count = leaf->Count - keep;
+        leaf->Count = keep;
+
+        right->Next = leaf->Next;
+        right->Previous = leaf;
+        if (leaf->Next != nullptr) {
+            leaf->Next->Previous = right;
+        } else {
+            Last = right;
+        }
+        leaf->Next = right;
+        return right;
+    }
+
+    void InsertIntoParent(PathEntry* path, const int32_t level, Node* left, const K& separator, Node* right) {
+        if (level < 0) {
+            InternalNode* newRoot = NewInternal();
+            newRoot->Keys[0] = separator;
+            newRoot->Children[0] = left;
+            newRoot->Children[1] = right;
+            newRoot->Count = 1;
+            Root = newRoot;
+            return;
+        }
+        InternalNode* parent = path[level].Parent;
+        const int32_t index = path[level].ChildIndex;
+        if (parent->Count < Capacity) {
+            for (int32_t i = parent->Count; i > index; --i) {
+                parent->Keys[i] = std::move(parent->Keys[i - 1]);
+                parent->Children[i + 1] = parent->Children[i];
+            }
+            parent->Keys[index] = separator;
+            parent->Children[index + 1] = right;
+            ++parent->Count;
+            return;
+        }
+
+        // Parent is full: lay out Capacity + 1 keys, push the middle one up.
+        K keys[Capacity + 1];
+        Node* children[Capacity + 2];
+        for (int32_t i = 0, source = 0; i < Capacity + 1; ++i) {
+            keys[i] = (i == index) ? separator : std::move(parent->Keys[source++]);
+        }
+        for (int32_t i = 0, source = 0; i < Capacity + 2; ++i) {
+            children[i] = (i == index + 1) ? right : parent->Children[source++];
+        }
+        const int32_t middle = (Capacity + 1) / 2;
+        InternalNode* sibling = NewInternal();
+        parent->Count = middle;
+        for (int32_t i = 0; i < middle; ++i) {
+            parent->Keys[i] = std::move(keys[i]);
+            parent->Children[i] = children[i];
+        }
+        parent->Children[middle] = children[middle];
+        sibling->Count = Capacity - middle;
+        for (int32_t i = 0; i < sibling->Count; ++i) {
+            sibling->Keys[i] = std::move(keys[middle + 1 + i]);
+            sibling->Children[i] = children[middle + 1 + i];
+        }
+        sibling->Children[sibling->Count] = children[Capacity + 1];
+        InsertIntoParent(path, level - 1, parent, keys[middle], sibling);
+    }
+
+    static void RemoveFromInternal(InternalNode* node, const int32_t keyIndex) {
+        // Removes Keys[keyIndex] and Children[keyIndex + 1].
+        for (int32_t i = keyIndex; i < node->Count - 1; ++i) {
+            node->Keys[i] = std::move(node->Keys[i + 1]);
+            node->Children[i + 1] = node->Children[i + 2];
+        }
+        --node->Count;
+    }
+
+    void RebalanceLeaf(LeafNode* leaf, PathEntry* path, const int32_t level) {
+        if (level < 0) {
+            if (leaf->Count == 0) {
+                FreeNode(leaf);
+                Root = nullptr;
+                First = nullptr;
+                Last = nullptr;
+            }
+            return;
+        }
+        if (leaf->Count >= MinLeafCount) {
+            return;
+        }
+        InternalNode* parent = path[level].Parent;
+        const int32_t index = path[level].ChildIndex;
+        auto* left = index > 0 ? static_cast<LeafNode*>(parent->Children[index - 1]) : nullptr;
+        auto* right = index < parent->Count ? static_cast<LeafNode*>(parent->Children[index + 1]) : nullptr;
+
+        if (left != nullptr && left->Count > MinLeafCount) {
+            InsertIntoLeaf(leaf, 0, left->Keys[left->Count - 1], std::move(left->Values[left->Count - 1]));
+            --left->Count;
+            parent->Keys[index - 1] = leaf->Keys[0];
+            return;
+        }
+        if (right != nullptr && right->Count > MinLeafCount) {
+            InsertIntoLeaf(leaf, leaf->Count, right->Keys[0], std::move(right->Values[0]));
+            for (int32_t i = 0; i < right->Count - 1; ++i) {
+                right->Keys[i] = std::move(right->Keys[i + 1]);
+                right->Values[i] = std::move(right->Values[i + 1]);
+            }
+            --right->Count;
+            parent->Keys[index] = right->Keys[0];
+            return;
+        }
+        if (left != nullptr) {
+            MergeLeaves(left, leaf);
+            RemoveFromInternal(parent, index - 1);
+        } else {
+            MergeLeaves(leaf, right);
+            RemoveFromInternal(parent, index);
+        }
+        RebalanceInternal(path, level);
+    }
+
+    void MergeLeaves(LeafNode* left, LeafNode* right) {
+        for (int32_t i = 0; i < right->Count; ++i) {
+            left->Keys[left->Count + i] = std::move(right->Keys[i]);
+            left->Values[left->Count + i] = std::move(right->Values[i]);
+        }
+        left->Count += right->Count;
+        left->Next = right->Next;
+        if (right->Next != nullptr) {
+            right->Next->Previous = left;
+        } else {
+            Last = left;
+        }
+        FreeNode(right);
+    }
+
+    void RebalanceInternal(PathEntry* path, const int32_t level) {
+        InternalNode* node = path[level].Parent;
+        if (level == 0) {
+            if (node->Count == 0) {
+                Root = node->Children[0];
+                FreeNode(node);
+            }
+            return;
+        }
+        if (node->Count >= MinInternalCount) {
+            return;
+        }
+        InternalNode* parent = path[level - 1].Parent;
+        const int32_t index = path[level - 1].ChildIndex;
+        auto* left = index > 0 ? static_cast<InternalNode*>(parent->Children[index - 1]) : nullptr;
+        auto* right = index < parent->Count ? static_cast<InternalNode*>(parent->Children[index + 1]) : nullptr;
+
+        if (left != nullptr && left->Count > MinInternalCount) {
+            // Rotate right through the parent separator.
+            node->Children[node->Count + 1] = node->Children[node->Count];
+            for (int32_t i = node->Count; i > 0; --i) {
+                node->Keys[i] = std::move(node->Keys[i - 1]);
+                node->Children[i] = node->Children[i - 1];
+            }
+            node->Keys[0] = std::move(parent->Keys[index - 1]);
+            node->Children[0] = left->Children[left->Count];
+            parent->Keys[index - 1] = std::move(left->Keys[left->Count - 1]);
+            --left->Count;
+            ++node->Count;
+            return;
+        }
+        if (right != nullptr && right->Count > MinInternalCount) {
+            // Rotate left through the parent separator.
+            node->Keys[node->Count] = std::move(parent->Keys[index]);
+            node->Children[node->Count + 1] = right->Children[0];
+            ++node->Count;
+            parent->Keys[index] = std::move(right->Keys[0]);
+            for (int32_t i = 0; i < right->Count - 1; ++i) {
+                right->Keys[i] = std::move(right->Keys[i + 1]);
+                right->Children[i] = right->Children[i + 1];
+            }
+            right->Children[right->Count - 1] = right->Children[right->Count];
+            --right->Count;
+            return;
+        }
+        if (left != nullptr) {
+            MergeInternals(left, parent->Keys[index - 1], node);
+            RemoveFromInternal(parent, index - 1);
+        } else {
+            MergeInternals(node, parent->Keys[index], right);
+            RemoveFromInternal(parent, index);
+        }
+        RebalanceInternal(path, level - 1);
+    }
+
+    void MergeInternals(InternalNode* left, const K& separator, InternalNode* right) {
+        left->Keys[left->Count] = separator;
+        for (int32_t i = 0; i < right->Count; ++i) {
+            left->Keys[left->Count + 1 + i] = std::move(right->Keys[i]);
+            left->Children[left->Count + 1 + i] = right->Children[i];
+        }
+        left->Children[left->Count + 1 + right->Count] = right->Children[right->Count];
+        left->Count += 1 + right->Count;
+        FreeNode(right);
+    }
+};
+} // namespace _BTreePrivate
+
+/**
+ * @brief Ordered map backed by a B+ tree. Keys are kept sorted, iteration is in ascending key order and walks a
+ * linked list of leaves.
+ * @tparam K Key type. Must be default constructible and comparable with operator<.
+ * @tparam V Value type. Must be default constructible.
+ * @tparam AllocatorT Node allocator, see Allocators::DefaultNodeAllocator for the required interface.
+ *
+ * Nodes hold up to 64 keys (less for large keys) in a contiguous array; arithmetic keys are searched inside a node with
+ * SIMD compares.
+ *
+ * Example usage:
+ *   BTreeMap<double, Keyframe> keyframes;
+ *   keyframes.Insert(0.5, frame);
+ *   for (auto entry : keyframes.Range(0.0, 1.0)) { entry.Key; entry.Value; }
+ */
+template <typename K, typename V, typename AllocatorT = Allocators::DefaultNodeAllocator> class BTreeMap {
+    using TreeType = _BTreePrivate::BTree<K, V, AllocatorT>;
+    using PositionType = typename TreeType::Position;
+
+public:
+    using KeyType = K;
+    using ValueType = V;
+
+    struct EntryReference {
+        const K& Key;
+        V& Value;
+    };
+    struct ConstEntryReference {
+        const K& Key;
+        const V& Value;
+    };
+
+    template <bool IsConst> class Iterator {
+    public:
+        using ValueReferenceType = std::conditional_t<IsConst, const V&, V&>;
+
+        Iterator(const TreeType* InTree, PositionType InPosition) : tree(InTree), position(InPosition) {}
+
+        [[nodiscard]] const K& Key() const { return position.Leaf->Keys[position.Index]; }
+        [[nodiscard]] ValueReferenceType Value() const { return position.Leaf->Values[position.Index]; }
+
+        std::conditional_t<IsConst, ConstEntryReference, EntryReference> operator*() const { return {Key(), Value()}; }
+
+        Iterator& operator++() {
+            position.Advance();
+            return *this;
+        }
+        Iterator& operator--() {
+            position.Retreat(*tree);
+            return *this;
+        }
+        bool operator==(const Iterator& other) const { return position == other.position; }
+        bool operator!=(const Iterator& other) const { return position != other.position; }
+        operator bool() const { return position.Leaf != nullptr; }
+
+    private:
+        const TreeType* tree;
+        PositionType position;
+    };
+    using IteratorType = Iterator<false>;
+    using ConstIteratorType = Iterator<true>;
+
+    template <bool IsConst> struct RangeView {
+        Iterator<IsConst> First;
+        Iterator<IsConst> Last;
+        Iterator<IsConst> begin() const { return First; }
+        Iterator<IsConst> end() const { return Last; }
+    };
+
+    /**
+     * @brief Inserts a key/value pair, or assigns the value if the key already exists.
+     * @return true if a new key was added.
+     */
+    bool Insert(const K& Key, const V& Value) { return tree.Insert(Key, Value); }
+    bool Insert(const K& Key, V&& Value) { return tree.Insert(Key, std::move(Value)); }
+
+    bool Remove(const K& Key) { return tree.Remove(Key); }
+    void Clear() { tree.Clear(); }
+
+    /**
+     * @return Pointer to the value of Key, nullptr if the key is not present.
+     */
+    V* Find(const K& Key) {
+        const PositionType position = tree.Find(Key);
+        return position.Leaf != nullptr ? &position.Leaf->Values[position.Index] : nullptr;
+    }
+    const V* Find(const K& Key) const {
+        const PositionType position = tree.Find(Key);
+        return position.Leaf != nullptr ? &position.Leaf->Values[position.Index] : nullptr;
+    }
+    [[nodiscard]] bool Contains(const K& Key) const { return tree.Find(Key).Leaf != nullptr; }
+
+    /**
+     * @brief Returns the value of Key, default-inserting it first if it is not present.
+     */
+    V& operator[](const K& Key) {
+        if (V* value = Find(Key)) {
+            return *value;
+        }
+        tree.Insert(Key, V());
+        return *Find(Key);
+    }
+
+    [[nodiscard]] int32_t Length() const { return tree.Length(); }
+    [[nodiscard]] bool IsEmpty() const { return tree.Length() == 0; }
+
+    /**
+     * @brief Replaces the content from parallel, strictly ascending key and value lists in O(n).
+     */
+    void BulkLoad(const List<K>& SortedKeys, const List<V>& Values) {
+        if (SortedKeys.Length() != Values.Length()) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(u"BTreeMap: BulkLoad key and value counts differ.");
+            return;
+        }
+        tree.BulkLoad(SortedKeys.Data(), Values.Data(), SortedKeys.Length());
+    }
+
+    /** @return Iterator to the first entry whose key is not less than Key. */
+    IteratorType LowerBound(const K& Key) { return IteratorType(&tree, tree.template Bound<false>(Key)); }
+    ConstIteratorType LowerBound(const K& Key) const {
+        return ConstIteratorType(&tree, tree.template Bound<false>(Key));
+    }
+    /** @return Iterator to the first entry whose key is greater than Key. */
+    IteratorType UpperBound(const K& Key) { return IteratorType(&tree, tree.template Bound<true>(Key)); }
+    ConstIteratorType UpperBound(const K& Key) const {
+        return ConstIteratorType(&tree, tree.template Bound<true>(Key));
+    }
+
+    /** @return The entries whose keys are in [Low, High). */
+    RangeView<false> Range(const K& Low, const K& High) { return {LowerBound(Low), LowerBound(High)}; }
+    RangeView<true> Range(const K& Low, const K& High) const { return {LowerBound(Low), LowerBound(High)}; }
+
+    IteratorType begin() { return IteratorType(&tree, tree.Begin()); }
+    IteratorType end() { return IteratorType(&tree, tree.End()); }
+    ConstIteratorType begin() const { return ConstIteratorType(&tree, tree.Begin()); }
+    ConstIteratorType end() const { return ConstIteratorType(&tree, tree.End()); }
+
+private:
+    TreeType tree;
+};
+
+/**
+ * @brief Ordered set backed by a B+ tree. See BTreeMap.
+ */
+template <typename K, typename AllocatorT = Allocators::DefaultNodeAllocator> class BTreeSet {
+    using TreeType = _BTreePrivate::BTree<K, _BTreePrivate::NoValue, AllocatorT>;
+    using PositionType = typename TreeType::Position;
+
+public:
+    using KeyType = K;
+
+    class Iterator {
+    public:
+        Iterator(const TreeType* InTree, PositionType InPosition) : tree(InTree), position(InPosition) {}
+
+        const K& operator*() const { return position.Leaf->Keys[position.Index]; }
+        const K* operator->() const { return &position.Leaf->Keys[position.Index]; }
+        Iterator& operator++() {
+            position.Advance();
+            return *this;
+        }
+        Iterator& operator--() {
+            position.Retreat(*tree);
+            return *this;
+        }
+        bool operator==(const Iterator& other) const { return position == other.position; }
+        bool operator!=(const Iterator& other) const { return position != other.position; }
+        operator bool() const { return position.Leaf != nullptr; }
+
+    private:
+        const TreeType* tree;
+        PositionType position;
+    };
+
+    struct RangeView {
+        Iterator First;
+        Iterator Last;
+        Iterator begin() const { return First; }
+        Iterator end() const { return Last; }
+    };
+
+    /** @return true if the key was not present before. */
+    bool Add(const K& Key) { return tree.Insert(Key, _BTreePrivate::NoValue{}); }
+    bool Remove(const K& Key) { return tree.Remove(Key); }
+    void Clear() { tree.Clear(); }
+    [[nodiscard]] bool Contains(const K& Key) const { return tree.Find(Key).Leaf != nullptr; }
+
+    [[nodiscard]] int32_t Length() const { return tree.Length(); }
+    [[nodiscard]] bool IsEmpty() const { return tree.Length() == 0; }
+
+    /**
+     * @brief Replaces the content from a strictly ascending key list in O(n).
+     */
+    void BulkLoad(const List<K>& SortedKeys) {
+        tree.BulkLoad(SortedKeys.Data(), nullptr, SortedKeys.Length());
+    }
+
+    [[nodiscard]] Iterator LowerBound(const K& Key) const { return Iterator(&tree, tree.template Bound<false>(Key)); }
+    [[nodiscard]] Iterator UpperBound(const K& Key) const { return Iterator(&tree, tree.template Bound<true>(Key)); }
+    /** @return The keys in [Low, High). */
+    [[nodiscard]] RangeView Range(const K& Low, const K& High) const { return {LowerBound(Low), LowerBound(High)}; }
+
+    Iterator begin() const { return Iterator(&tree, tree.Begin()); }
+    Iterator end() const { return Iterator(&tree, tree.End()); }
+
+private:
+    TreeType tree;
+};
+} // namespace Edvar::Containers
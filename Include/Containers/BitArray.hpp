@@ -0,0 +1,388 @@
+#pragma once
+#include "Containers/List.hpp"
+#include <bit>
+
+namespace Edvar::Containers {
+namespace _BitArrayPrivate {
+// Word kernels, vectorised in BitArray.cpp.
+EDVAR_CPP_CORE_API void AndWords(uint64_t* Destination, const uint64_t* Source, int32_t Count);
+EDVAR_CPP_CORE_API void OrWords(uint64_t* Destination, const uint64_t* Source, int32_t Count);
+EDVAR_CPP_CORE_API void XorWords(uint64_t* Destination, const uint64_t* Source, int32_t Count);
+EDVAR_CPP_CORE_API int64_t CountSetBitsInWords(const uint64_t* Words, int32_t Count);
+
+constexpr int32_t BitsPerWord = 64;
+constexpr int32_t WordCountFor(const int32_t BitCount) { return (BitCount + BitsPerWord - 1) / BitsPerWord; }
+constexpr uint64_t BitOf(const int32_t Index) { return uint64_t{1} << (Index & (BitsPerWord - 1)); }
+/** @return Mask of the bits [First, First + Count) inside a single word. */
+constexpr uint64_t WordMask(const int32_t First, const int32_t Count) {
+    return (Count >= BitsPerWord ? ~uint64_t{0} : ((uint64_t{1} << Count) - 1)) << First;
+}
+} // namespace _BitArrayPrivate
+
+/**
+ * @brief Dynamically sized array of bits, packed in 64-bit words.
+ *
+ * Searches (FindFirstSet, FindFirstClear) skip whole words at a time, bulk operations (&=, |=, ^=, CountSetBits) run
+ * on the packed words with AVX2 when it is enabled.
+ *
+ * Example usage:
+ *   BitArray visible(objectCount);
+ *   visible.SetBit(index);
+ *   for (int32_t i = visible.FindFirstSet(); i != BitArray::NotFound; i = visible.FindFirstSet(i + 1)) { ... }
+ */
+class BitArray {
+public:
+    static constexpr int32_t NotFound = -1;
+
+    BitArray() = default;
+    explicit BitArray(const int32_t InBitCount, const bool InitialValue = false) { Resize(InBitCount, InitialValue); }
+
+    /**
+     * @brief Changes the number of bits. New bits are set to Value.
+     */
+    void Resize(const int32_t NewBitCount, const bool Value = false) {
+        const int32_t oldBitCount = bitCount;
+        const int32_t oldWordCount = Words.Length();
+        const int32_t newWordCount = _BitArrayPrivate::WordCountFor(NewBitCount);
+        Words.Resize(newWordCount);
+        for (int32_t i = oldWordCount; i < newWordCount; ++i) {
+            Words[i] = 0;
+        }
+        bitCount = NewBitCount;
+        if (NewBitCount > oldBitCount) {
+            SetRange(oldBitCount, NewBitCount - oldBitCount, Value);
+        } else {
+            ClearTrailingBits();
+        }
+    }
+
+    [[nodiscard]] int32_t Length() const { return bitCount; }
+    [[nodiscard]] int32_t WordCount() const { return Words.Length(); }
+    /** @brief Packed words, bit i is bit (i % 64) of word (i / 64). Bits past Length() are always zero. */
+    [[nodiscard]] const uint64_t* Data() const { return Words.Data(); }
+
+    [[nodiscard]] bool IsSet(const int32_t Index) const {
+        CheckIndex(Index);
+        return (Words[Index / _BitArrayPrivate::BitsPerWord] & _BitArrayPrivate::BitOf(Index)) != 0;
+    }
+    bool operator[](const int32_t Index) const { return IsSet(Index); }
+
+    void SetBit(const int32_t Index, const bool Value = true) {
+        CheckIndex(Index);
+        uint64_t& word = Words[Index / _BitArrayPrivate::BitsPerWord];
+        if (Value) {
+            word |= _BitArrayPrivate::BitOf(Index);
+        } else {
+            word &= ~_BitArrayPrivate::BitOf(Index);
+        }
+    }
+    void ClearBit(const int32_t Index) { SetBit(Index, false); }
+
+    /**
+     * @brief Sets the bits [Start, Start + Count) to Value, a word at a time.
+     */
+    void SetRange(const int32_t Start, const int32_t Count, const bool Value = true) {
+        if (Count <= 0) {
+            return;
+        }
+        if (Start < 0 || Start + Count > bitCount) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(
+                *String::Format(u"BitArray: Range [{}, {}) out of bounds, length {}.", Start, Start + Count, bitCount));
+        }
+        int32_t index = Start;
+        const int32_t end = Start + Count;
+        while (index < end) {
+            const int32_t bitInWord = index % _BitArrayPrivate::BitsPerWord;
+            const int32_t take = std::min(end - index, _BitArrayPrivate::BitsPerWord - bitInWord);
+            const uint64_t mask = _BitArrayPrivate::WordMask(bitInWord, take);
+            uint64_t& word = Words[index / _BitArrayPrivate::BitsPerWord];
+            word = Value ? (word | mask) : (word & ~mask);
+            index += take;
+        }
+    }
+    void ClearRange(const int32_t Start, const int32_t Count) { SetRange(Start, Count, false); }
+
+    void SetAll(const bool Value = true) {
+        for (int32_t i = 0; i < Words.Length(); ++i) {
+            Words[i] = Value ? ~uint64_t{0} : 0;
+        }
+        ClearTrailingBits();
+    }
+    void ClearAll() { SetAll(false); }
+
+    /**
+     * @return Index of the first set bit at or after StartIndex, NotFound if there is none.
+     */
+    [[nodiscard]] int32_t FindFirstSet(const int32_t StartIndex = 0) const {
+        return FindFirst<false>(StartIndex);
+    }
+    /**
+     * @return Index of the first clear bit at or after StartIndex, NotFound if there is none.
+     */
+    [[nodiscard]] int32_t FindFirstClear(const int32_t StartIndex = 0) const {
+        return FindFirst<true>(StartIndex);
+    }
+
+    [[nodiscard]] int32_t CountSetBits() const {
+        return static_cast<int32_t>(_BitArrayPrivate::CountSetBitsInWords(Words.Data(), Words.Length()));
+    }
+    [[nodiscard]] bool AnySet() const { return FindFirstSet() != NotFound; }
+
+    BitArray& operator&=(const BitArray& other) {
+        CheckSameLength(other);
+        _BitArrayPrivate::AndWords(Words.Data(), other.Words.Data(), Words.Length());
+        return *this;
+    }
+    BitArray& operator|=(const BitArray& other) {
+        CheckSameLength(other);
+        _BitArrayPrivate::OrWords(Words.Data(), other.Words.Data(), Words.Length());
+        return *this;
+    }
+    BitArray& operator^=(const BitArray& other) {
+        CheckSameLength(other);
+        _BitArrayPrivate::XorWords(Words.Data(), other.Words.Data(), Words.Length());
+        return *this;
+    }
+
+private:
+    template <bool Invert> [[nodiscard]] int32_t FindFirst(const int32_t StartIndex) const {
+        if (StartIndex < 0 || StartIndex >= bitCount) {
+            return NotFound;
+        }
+        int32_t wordIndex = StartIndex / _BitArrayPrivate::BitsPerWord;
+        uint64_t word = (Invert ? ~Words[wordIndex] : Words[wordIndex]) &
+                        (~uint64_t{0} << (StartIndex % _BitArrayPrivate::BitsPerWord));
+        while (word == 0) {
+            if (++wordIndex >= Words.Length()) {
+                return NotFound;
+            }
+            word = Invert ? ~Words[wordIndex] : Words[wordIndex];
+        }
+        const int32_t index = wordIndex * _BitArrayPrivate::BitsPerWord + std::countr_zero(word);
+        // Inverted trailing bits of the last word read as clear, they are not part of the array.
+        return index < bitCount ? index : NotFound;
+    }
+
+    void ClearTrailingBits() {
+        if (const int32_t used = bitCount % _BitArrayPrivate::BitsPerWord; used != 0) {
+            Words[Words.Length() - 1] &= _BitArrayPrivate::WordMask(0, used);
+        }
+    }
+
+    void CheckIndex(const int32_t Index) const {
+        if (Index < 0 || Index >= bitCount) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(
+                *String::Format(u"BitArray: Index {} out of bounds, length {}.", Index, bitCount));
+        }
+    }
+    void CheckSameLength(const BitArray& other) const {
+        if (other.bitCount != bitCount) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(
+                *String::Format(u"BitArray: Length mismatch, {} and {}.", bitCount, other.bitCount));
+        }
+    }
+
+    List<uint64_t> Words;
+    int32_t bitCount = 0;
+};
+
+/**
+ * @brief Fixed size bit array with summary levels on top: a bit of level N + 1 is set when the matching word of level
+ * N has any bit set. Finding a set bit costs one word per level (at most 6 for 2^31 bits) regardless of how sparse the
+ * array is, which makes it suited for free-lists: keep free slots as set bits, allocate with FindFirstSet + ClearBit.
+ *
+ * Example usage:
+ *   HierarchicalBitArray freeSlots(descriptorCount, true);
+ *   const int32_t slot = freeSlots.FindFirstSet();
+ *   freeSlots.ClearBit(slot);
+ *   ...
+ *   freeSlots.SetBit(slot);
+ */
+class HierarchicalBitArray {
+public:
+    static constexpr int32_t NotFound = -1;
+    static constexpr int32_t MaxLevels = 6;
+
+    HierarchicalBitArray() = default;
+    explicit HierarchicalBitArray(const int32_t InBitCount, const bool InitialValue = false) {
+        Initialize(InBitCount, InitialValue);
+    }
+
+    /**
+     * @brief Resets the array to InBitCount bits, all set to InitialValue.
+     */
+    void Initialize(const int32_t InBitCount, const bool InitialValue = false) {
+        bitCount = InBitCount;
+        levelCount = 0;
+        int32_t totalWords = 0;
+        int32_t levelBits = InBitCount > 0 ? InBitCount : 1;
+        do {
+            levelOffsets[levelCount] = totalWords;
+            levelBitCounts[levelCount] = levelBits;
+            const int32_t levelWords = _BitArrayPrivate::WordCountFor(levelBits);
+            totalWords += levelWords;
+            ++levelCount;
+            levelBits = levelWords;
+        } while (levelBits > 1);
+        levelOffsets[levelCount] = totalWords;
+        Words.Resize(totalWords);
+        SetAll(InitialValue);
+    }
+
+    [[nodiscard]] int32_t Length() const { return bitCount; }
+
+    [[nodiscard]] bool IsSet(const int32_t Index) const {
+        CheckIndex(Index);
+        return (Words[Index / _BitArrayPrivate::BitsPerWord] & _BitArrayPrivate::BitOf(Index)) != 0;
+    }
+    bool operator[](const int32_t Index) const { return IsSet(Index); }
+
+    void SetBit(const int32_t Index) {
+        CheckIndex(Index);
+        uint64_t& word = Words[Index / _BitArrayPrivate::BitsPerWord];
+        if ((word & _BitArrayPrivate::BitOf(Index)) != 0) {
+            return;
+        }
+        const bool wasEmpty = word == 0;
+        word |= _BitArrayPrivate::BitOf(Index);
+        ++setCount;
+        if (wasEmpty) {
+            MarkWordNonEmpty(0, Index / _BitArrayPrivate::BitsPerWord);
+        }
+    }
+    void ClearBit(const int32_t Index) {
+        CheckIndex(Index);
+        uint64_t& word = Words[Index / _BitArrayPrivate::BitsPerWord];
+        if ((word & _BitArrayPrivate::BitOf(Index)) == 0) {
+            return;
+        }
+        word &= ~_BitArrayPrivate::BitOf(Index);
+        --setCount;
+        if (word == 0) {
+            MarkWordEmpty(0, Index / _BitArrayPrivate::BitsPerWord);
+        }
+    }
+
+    /**
+     * @brief Sets or clears the bits [Start, Start + Count), a word at a time.
+     */
+    void SetRange(const int32_t Start, const int32_t Count, const bool Value = true) {
+        if (Count <= 0) {
+            return;
+        }
+        if (Start < 0 || Start + Count > bitCount) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(*String::Format(
+                u"HierarchicalBitArray: Range [{}, {}) out of bounds, length {}.", Start, Start + Count, bitCount));
+        }
+        int32_t index = Start;
+        const int32_t end = Start + Count;
+        while (index < end) {
+            const int32_t bitInWord = index % _BitArrayPrivate::BitsPerWord;
+            const int32_t take = std::min(end - index, _BitArrayPrivate::BitsPerWord - bitInWord);
+            const uint64_t mask = _BitArrayPrivate::WordMask(bitInWord, take);
+            const int32_t wordIndex = index / _BitArrayPrivate::BitsPerWord;
+            uint64_t& word = Words[wordIndex];
+            const uint64_t before = word;
+            word = Value ? (word | mask) : (word & ~mask);
+            setCount += std::popcount(word) - std::popcount(before);
+            if (before == 0 && word != 0) {
+                MarkWordNonEmpty(0, wordIndex);
+            } else if (before != 0 && word == 0) {
+                MarkWordEmpty(0, wordIndex);
+            }
+            index += take;
+        }
+    }
+    void ClearRange(const int32_t Start, const int32_t Count) { SetRange(Start, Count, false); }
+
+    void SetAll(const bool Value = true) {
+        for (int32_t i = 0; i < Words.Length(); ++i) {
+            Words[i] = 0;
+        }
+        setCount = 0;
+        if (Value && bitCount > 0) {
+            // Every level is a full array of its lower level's word count.
+            for (int32_t level = 0; level < levelCount; ++level) {
+                const int32_t bits = levelBitCounts[level];
+                for (int32_t i = 0; i < _BitArrayPrivate::WordCountFor(bits); ++i) {
+                    const int32_t remaining = bits - i * _BitArrayPrivate::BitsPerWord;
+                    Words[levelOffsets[level] + i] = _BitArrayPrivate::WordMask(0, remaining);
+                }
+            }
+            setCount = bitCount;
+        }
+    }
+    void ClearAll() { SetAll(false); }
+
+    /**
+     * @return Index of the first set bit at or after StartIndex, NotFound if there is none.
+     */
+    [[nodiscard]] int32_t FindFirstSet(const int32_t StartIndex = 0) const {
+        if (StartIndex < 0 || StartIndex >= bitCount) {
+            return NotFound;
+        }
+        // Climb until a level has a set bit at or after the position, then descend along the first set bits.
+        int32_t position = StartIndex;
+        for (int32_t level = 0; level < levelCount; ++level) {
+            const int32_t wordIndex = position / _BitArrayPrivate::BitsPerWord;
+            if (wordIndex >= levelOffsets[level + 1] - levelOffsets[level]) {
+                return NotFound;
+            }
+            const uint64_t word = Words[levelOffsets[level] + wordIndex] &
+                                  (~uint64_t{0} << (position % _BitArrayPrivate::BitsPerWord));
+            if (word != 0) {
+                position = wordIndex * _BitArrayPrivate::BitsPerWord + std::countr_zero(word);
+                while (level > 0) {
+                    --level;
+                    position = position * _BitArrayPrivate::BitsPerWord +
+                               std::countr_zero(Words[levelOffsets[level] + position]);
+                }
+                return position;
+            }
+            position = wordIndex + 1;
+        }
+        return NotFound;
+    }
+
+    [[nodiscard]] int32_t CountSetBits() const { return setCount; }
+    [[nodiscard]] bool AnySet() const { return setCount != 0; }
+
+private:
+    void MarkWordNonEmpty(int32_t level, int32_t wordIndex) {
+        while (++level < levelCount) {
+            uint64_t& summary = Words[levelOffsets[level] + wordIndex / _BitArrayPrivate::BitsPerWord];
+            const bool wasEmpty = summary == 0;
+            summary |= _BitArrayPrivate::BitOf(wordIndex);
+            if (!wasEmpty) {
+                return;
+            }
+            wordIndex /= _BitArrayPrivate::BitsPerWord;
+        }
+    }
+    void MarkWordEmpty(int32_t level, int32_t wordIndex) {
+        while (++level < levelCount) {
+            uint64_t& summary = Words[levelOffsets[level] + wordIndex / _BitArrayPrivate::BitsPerWord];
+            summary &= ~_BitArrayPrivate::BitOf(wordIndex);
+            if (summary != 0) {
+                return;
+            }
+            wordIndex /= _BitArrayPrivate::BitsPerWord;
+        }
+    }
+
+    void CheckIndex(const int32_t Index) const {
+        if (Index < 0 || Index >= bitCount) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(
+                *String::Format(u"HierarchicalBitArray: Index {} out of bounds, length {}.", Index, bitCount));
+        }
+    }
+
+    // All levels back to back, level 0 holds the bits themselves.
+    List<uint64_t> Words;
+    int32_t levelOffsets[MaxLevels + 1] = {};
+    int32_t levelBitCounts[MaxLevels] = {};
+    int32_t levelCount = 0;
+    int32_t bitCount = 0;
+    int32_t setCount = 0;
+};
+} // namespace Edvar::Containers
@@ -9,7 +9,10 @@ template <typename T, typename AllocatorT>
 List<T, AllocatorT>::List(const List& other)
     requires(std::is_copy_constructible_v<T>)
     : Size(other.Size), Capacity(other.Capacity), Allocator() {
-    Allocator.Allocate(Capacity);
+    // An empty copy allocates lazily like a new list, the first Add would otherwise allocate over this buffer.
+    if (Capacity > 0) {
+        Allocator.Allocate(Capacity);
+    }
     for (int32_t i = 0; i < Size; ++i) {
         new (Allocator.Data() + i) T(other.Allocator[i]);
     }
@@ -55,13 +58,11 @@ template <typename T, typename AllocatorT> List<T, AllocatorT>& List<T, Allocato
     return *this;
 }
 template <typename T, typename AllocatorT> void List<T, AllocatorT>::Clear() {
-    if (Allocator.HasAllocated()) {
-        for (int32_t i = 0; i < Size; ++i) {
-            Allocator[i].~T();
-        }
-        Allocator.Resize(0);
-        Size = 0;
+    // Keeps the allocation, only destroys the elements, so Capacity stays valid for reuse
+    for (int32_t i = 0; i < Size; ++i) {
+        Allocator[i].~T();
     }
+    Size = 0;
 }
 template <typename T, typename AllocatorT> void List<T, AllocatorT>::EnsureCapacity(int32_t NewCapacity) {
     if (!Allocator.HasAllocated()) {
@@ -202,7 +203,11 @@ typename List<T, AllocatorT>::DataType List<T, AllocatorT>::RemoveAt(int32_t Ind
         Platform::GetPlatform().OnFatalError(
             *String::Format("Array: Index {} out of bounds [0, {}].", Index, Size - 1));
         // Make sure compiler is happy about this.
-        return Allocator[0];
+        if constexpr (std::is_copy_constructible_v<DataType>) {
+            return Allocator[0];
+        } else {
+            return DataType(std::move(Allocator[0]));
+        }
     }
     if constexpr (std::is_move_constructible_v<DataType>) {
         DataType RemovedElement(std::move(Allocator[Index]));
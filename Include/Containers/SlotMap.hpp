@@ -0,0 +1,187 @@
+#pragma once
+#include "Containers/List.hpp"
+
+namespace Edvar::Containers {
+
+/**
+ * @brief Handle to an element in a SlotMap. Stays valid until that element is removed, no matter how many other
+ * elements are added or removed in between.
+ */
+struct SlotMapHandle {
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    uint32_t Index = InvalidIndex;
+    uint32_t Generation = 0;
+
+    [[nodiscard]] bool IsValid() const { return Index != InvalidIndex; }
+    bool operator==(const SlotMapHandle& other) const {
+        return Index == other.Index && Generation == other.Generation;
+    }
+    bool operator!=(const SlotMapHandle& other) const { return !((*this) == other); }
+};
+
+/**
+ * @brief Associative container with O(1) add, remove and lookup through generational handles.
+ * @tparam T The element type.
+ *
+ * Values are kept densely packed so iteration is a linear walk over a contiguous array. Removal moves the last value
+ * into the freed place, so iteration order is not stable across removals. Handles are validated by generation, a
+ * handle to a removed element never resolves to a newer element that reuses the same slot.
+ *
+ * Example usage:
+ *   SlotMap<Dependent*> dependents;
+ *   SlotMapHandle handle = dependents.Add(this);
+ *   for (Dependent* dependent : dependents) { ... }
+ *   dependents.Remove(handle);
+ */
+template <typename T> struct SlotMap {
+private:
+    struct Slot {
+        // While occupied: index into Values. While free: next free slot index.
+        uint32_t DenseOrNextFree;
+        // Even while free, odd while occupied.
+        uint32_t Generation;
+    };
+
+public:
+    using DataType = T;
+
+    SlotMap() = default;
+    SlotMap(const SlotMap& other) = default;
+    SlotMap(SlotMap&& other) noexcept = default;
+    SlotMap& operator=(const SlotMap& other) = default;
+    SlotMap& operator=(SlotMap&& other) noexcept = default;
+    ~SlotMap() = default;
+
+    /**
+     * @brief Adds a value to the map.
+     * @return A handle which can be used to access or remove the value.
+     */
+    SlotMapHandle Add(const T& Value)
+        requires(std::is_copy_constructible_v<T>)
+    {
+        const SlotMapHandle handle = AcquireSlot();
+        Values.Add(Value);
+        return handle;
+    }
+    SlotMapHandle Add(T&& Value)
+        requires(std::is_move_constructible_v<T>)
+    {
+        const SlotMapHandle handle = AcquireSlot();
+        Values.Add(std::move(Value));
+        return handle;
+    }
+
+    /**
+     * @brief Removes the value referred by the handle. Does nothing if the handle is stale or invalid.
+     * @return true if a value was removed.
+     */
+    bool Remove(const SlotMapHandle Handle) {
+        if (!Contains(Handle)) {
+            return false;
+        }
+        Slot& removedSlot = Slots[static_cast<int32_t>(Handle.Index)];
+        const int32_t denseIndex = static_cast<int32_t>(removedSlot.DenseOrNextFree);
+        const int32_t lastIndex = Values.Length() - 1;
+        if (denseIndex != lastIndex) {
+            Values[denseIndex] = std::move(Values[lastIndex]);
+            DenseToSlot[denseIndex] = DenseToSlot[lastIndex];
+            Slots[static_cast<int32_t>(DenseToSlot[denseIndex])].DenseOrNextFree = static_cast<uint32_t>(denseIndex);
+        }
+        Values.RemoveAt(lastIndex);
+        DenseToSlot.RemoveAt(lastIndex);
+
+        ++removedSlot.Generation;
+        removedSlot.DenseOrNextFree = FreeListHead;
+        FreeListHead = Handle.Index;
+        return true;
+    }
+
+    /**
+     * @brief Removes every value. All handles given out so far become stale.
+     */
+    void Clear() {
+        while (Values.Length() > 0) {
+            Remove(HandleAt(Values.Length() - 1));
+        }
+    }
+
+    [[nodiscard]] bool Contains(const SlotMapHandle Handle) const {
+        if (Handle.Index >= static_cast<uint32_t>(Slots.Length())) {
+            return false;
+        }
+        const Slot& slot = Slots[static_cast<int32_t>(Handle.Index)];
+        return slot.Generation == Handle.Generation && (slot.Generation & 1u) != 0;
+    }
+
+    /**
+     * @return Pointer to the value, nullptr if the handle is stale or invalid.
+     */
+    T* Find(const SlotMapHandle Handle) { return Contains(Handle) ? &Values[DenseIndexOf(Handle)] : nullptr; }
+    const T* Find(const SlotMapHandle Handle) const {
+        return Contains(Handle) ? &Values[DenseIndexOf(Handle)] : nullptr;
+    }
+
+    T& Get(const SlotMapHandle Handle) {
+        T* value = Find(Handle);
+        if (value == nullptr) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(u"SlotMap: Access through a stale or invalid handle.");
+        }
+        return *value;
+    }
+    const T& Get(const SlotMapHandle Handle) const {
+        const T* value = Find(Handle);
+        if (value == nullptr) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(u"SlotMap: Access through a stale or invalid handle.");
+        }
+        return *value;
+    }
+
+    T& operator[](const SlotMapHandle Handle) { return Get(Handle); }
+    const T& operator[](const SlotMapHandle Handle) const { return Get(Handle); }
+
+    /**
+     * @return The handle of the value stored at the given dense index, for use while iterating over Data().
+     */
+    [[nodiscard]] SlotMapHandle HandleAt(const int32_t DenseIndex) const {
+        const uint32_t slotIndex = DenseToSlot[DenseIndex];
+        return SlotMapHandle{slotIndex, Slots[static_cast<int32_t>(slotIndex)].Generation};
+    }
+
+    [[nodiscard]] int32_t Length() const { return Values.Length(); }
+    [[nodiscard]] bool IsEmpty() const { return Values.Length() == 0; }
+
+    T* Data() { return Values.Data(); }
+    const T* Data() const { return Values.Data(); }
+
+    T* begin() { return Values.Data(); }
+    T* end() { return Values.Data() + Values.Length(); }
+    const T* begin() const { return Values.Data(); }
+    const T* end() const { return Values.Data() + Values.Length(); }
+
+private:
+    [[nodiscard]] int32_t DenseIndexOf(const SlotMapHandle Handle) const {
+        return static_cast<int32_t>(Slots[static_cast<int32_t>(Handle.Index)].DenseOrNextFree);
+    }
+
+    SlotMapHandle AcquireSlot() {
+        uint32_t slotIndex;
+        if (FreeListHead != SlotMapHandle::InvalidIndex) {
+            slotIndex = FreeListHead;
+            FreeListHead = Slots[static_cast<int32_t>(slotIndex)].DenseOrNextFree;
+        } else {
+            slotIndex = static_cast<uint32_t>(Slots.Add(Slot{SlotMapHandle::InvalidIndex, 0}));
+        }
+        Slot& slot = Slots[static_cast<int32_t>(slotIndex)];
+        ++slot.Generation;
+        slot.DenseOrNextFree = static_cast<uint32_t>(Values.Length());
+        DenseToSlot.Add(slotIndex);
+        return SlotMapHandle{slotIndex, slot.Generation};
+    }
+
+    List<T> Values;
+    List<uint32_t> DenseToSlot;
+    List<Slot> Slots;
+    uint32_t FreeListHead = SlotMapHandle::InvalidIndex;
+};
+} // namespace Edvar::Containers
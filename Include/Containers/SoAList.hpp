@@ -0,0 +1,346 @@
+#pragma once
+#include "Containers/Tuple.hpp"
+
+namespace Edvar::Containers {
+
+/**
+ * @brief A struct-of-arrays list. Every field type gets its own contiguous, aligned array while the element count
+ * and capacity are shared across all fields.
+ * @tparam Ts The field types of a row.
+ *
+ * All field arrays live in a single allocation. Each array starts on a FieldAlignment boundary so batch kernels can
+ * use aligned SIMD loads on any field without touching the others.
+ *
+ * Example usage:
+ *   SoAList<Math::Vector3f, Math::Quaternion, Math::Vector3f> transforms;
+ *   transforms.Add(translation, rotation, scale);
+ *   Math::Vector3f* translations = transforms.Data<0>(); // contiguous, only translations
+ *   auto row = transforms[0];                            // Tuple<Vector3f&, Quaternion&, Vector3f&>
+ *   row.Get<0>() += Math::Vector3f(1.0f);
+ */
+template <typename... Ts> struct SoAList {
+    static_assert(sizeof...(Ts) > 0, "SoAList needs at least one field.");
+
+public:
+    /**
+     * Every field array begins on this boundary. 64 bytes covers a cache line and a full AVX-512 register.
+     */
+    static constexpr uint64_t FieldAlignment = 64;
+    static constexpr uint32_t FieldCount = sizeof...(Ts);
+
+    template <int32_t I> using FieldType = TupleElementT<I, Ts...>;
+    using ValueType = Tuple<Ts...>;
+    using RowType = Tuple<Ts&...>;
+    using ConstRowType = Tuple<const Ts&...>;
+
+    SoAList() : Size(0), Capacity(0), Block(nullptr) {
+        for (uint32_t i = 0; i < FieldCount; ++i) {
+            Fields[i] = nullptr;
+        }
+    }
+    SoAList(const SoAList& other)
+        requires((std::is_copy_constructible_v<Ts> && ...))
+        : SoAList() {
+        EnsureCapacity(other.Size);
+        CopyConstructRange(other, Utils::MakeIndexSequence<FieldCount>{});
+        Size = other.Size;
+    }
+    SoAList(SoAList&& other) noexcept : Size(other.Size), Capacity(other.Capacity), Block(other.Block) {
+        for (uint32_t i = 0; i < FieldCount; ++i) {
+            Fields[i] = other.Fields[i];
+            other.Fields[i] = nullptr;
+        }
+        other.Size = 0;
+        other.Capacity = 0;
+        other.Block = nullptr;
+    }
+    ~SoAList() {
+        DestroyRange(0, Size, Utils::MakeIndexSequence<FieldCount>{});
+        FreeBlock();
+    }
+
+    SoAList& operator=(const SoAList& other)
+        requires((std::is_copy_constructible_v<Ts> && ...))
+    {
+        if (this != &other) {
+            Clear();
+            EnsureCapacity(other.Size);
+            CopyConstructRange(other, Utils::MakeIndexSequence<FieldCount>{});
+            Size = other.Size;
+        }
+        return *this;
+    }
+    SoAList& operator=(SoAList&& other) noexcept {
+        if (this != &other) {
+            DestroyRange(0, Size, Utils::MakeIndexSequence<FieldCount>{});
+            FreeBlock();
+            Size = other.Size;
+            Capacity = other.Capacity;
+            Block = other.Block;
+            for (uint32_t i = 0; i < FieldCount; ++i) {
+                Fields[i] = other.Fields[i];
+                other.Fields[i] = nullptr;
+            }
+            other.Size = 0;
+            other.Capacity = 0;
+            other.Block = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Destroys all rows. Capacity is kept so the list can be refilled without reallocating.
+     */
+    void Clear() {
+        DestroyRange(0, Size, Utils::MakeIndexSequence<FieldCount>{});
+        Size = 0;
+    }
+
+    /**
+     * @brief Grows every field array to hold at least NewCapacity rows. Never shrinks.
+     */
+    void EnsureCapacity(const int32_t NewCapacity) {
+        if (NewCapacity <= Capacity) {
+            return;
+        }
+        Reallocate(NewCapacity, Utils::MakeIndexSequence<FieldCount>{});
+    }
+
+    /**
+     * @brief Resizes the list. New rows are default constructed, removed rows are destroyed.
+     */
+    void Resize(const int32_t NewSize)
+        requires((std::is_default_constructible_v<Ts> && ...))
+    {
+        if (NewSize > Size) {
+            AddDefaulted(NewSize - Size);
+        } else if (NewSize < Size) {
+            DestroyRange(NewSize, Size, Utils::MakeIndexSequence<FieldCount>{});
+            Size = NewSize;
+        }
+    }
+
+    /**
+     * @brief Appends a row built from one value per field.
+     * @return Index of the new row.
+     */
+    template <typename... ArgsT>
+    int32_t Add(ArgsT&&... Values)
+        requires(sizeof...(ArgsT) == FieldCount && (std::is_constructible_v<Ts, ArgsT> && ...))
+    {
+        Grow(1);
+        ConstructAt(Size, Utils::MakeIndexSequence<FieldCount>{}, std::forward<ArgsT>(Values)...);
+        return Size++;
+    }
+
+    /**
+     * @brief Appends a row from a value tuple.
+     * @return Index of the new row.
+     */
+    int32_t Add(const ValueType& Row)
+        requires((std::is_copy_constructible_v<Ts> && ...))
+    {
+        Grow(1);
+        ConstructFromTuple(Size, Row, Utils::MakeIndexSequence<FieldCount>{});
+        return Size++;
+    }
+
+    /**
+     * @brief Appends Count default constructed rows.
+     * @return Index of the first new row.
+     */
+    int32_t AddDefaulted(const int32_t Count)
+        requires((std::is_default_constructible_v<Ts> && ...))
+    {
+        Grow(Count);
+        for (int32_t i = 0; i < Count; ++i) {
+            DefaultConstructAt(Size + i, Utils::MakeIndexSequence<FieldCount>{});
+        }
+        Size += Count;
+        return Size - Count;
+    }
+
+    /**
+     * @brief Removes the row at Index, keeping the order of the remaining rows.
+     */
+    void RemoveAt(const int32_t Index) {
+        CheckIndex(Index);
+        ShiftDown(Index, Utils::MakeIndexSequence<FieldCount>{});
+        --Size;
+    }
+
+    /**
+     * @brief Removes the row at Index by moving the last row into its place. O(1), does not keep order.
+     */
+    void RemoveAtSwap(const int32_t Index) {
+        CheckIndex(Index);
+        MoveLastInto(Index, Utils::MakeIndexSequence<FieldCount>{});
+        --Size;
+    }
+
+    [[nodiscard]] int32_t Length() const { return Size; }
+    [[nodiscard]] int32_t GetCapacity() const { return Capacity; }
+    [[nodiscard]] bool IsEmpty() const { return Size == 0; }
+
+    /**
+     * @brief Raw access to the contiguous array of field I. Aligned to FieldAlignment, valid for Length() elements.
+     */
+    template <int32_t I>
+    FieldType<I>* Data()
+        requires(I >= 0 && I < static_cast<int32_t>(FieldCount))
+    {
+        return static_cast<FieldType<I>*>(Fields[I]);
+    }
+    template <int32_t I>
+    const FieldType<I>* Data() const
+        requires(I >= 0 && I < static_cast<int32_t>(FieldCount))
+    {
+        return static_cast<const FieldType<I>*>(Fields[I]);
+    }
+
+    /**
+     * @brief Returns a row proxy whose elements reference the stored fields.
+     */
+    RowType Get(const int32_t Index) { return MakeRow(Index, Utils::MakeIndexSequence<FieldCount>{}); }
+    ConstRowType Get(const int32_t Index) const { return MakeConstRow(Index, Utils::MakeIndexSequence<FieldCount>{}); }
+
+    /**
+     * @brief Copies a row out into a value tuple.
+     */
+    ValueType GetValue(const int32_t Index) const
+        requires((std::is_copy_constructible_v<Ts> && ...))
+    {
+        return MakeValue(Index, Utils::MakeIndexSequence<FieldCount>{});
+    }
+
+    RowType operator[](const int32_t Index) { return Get(Index); }
+    ConstRowType operator[](const int32_t Index) const { return Get(Index); }
+
+private:
+    int32_t Size;
+    int32_t Capacity;
+    void* Block;
+    void* Fields[FieldCount];
+
+    static constexpr uint64_t AlignUp(const uint64_t Value) {
+        return (Value + FieldAlignment - 1) & ~(FieldAlignment - 1);
+    }
+
+    void CheckIndex(const int32_t Index) const {
+        if (Index < 0 || Index >= Size) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(
+                *String::Format(u"SoAList: Index {} out of bounds [0, {}].", Index, Size - 1));
+        }
+    }
+
+    void Grow(const int32_t Count) {
+        if (Size + Count > Capacity) {
+            const int32_t Doubled = Capacity == 0 ? 1 : Capacity * 2;
+            EnsureCapacity(Doubled > Size + Count ? Doubled : Size + Count);
+        }
+    }
+
+    void FreeBlock() {
+        if (Block != nullptr) {
+            ::operator delete(Block, static_cast<std::align_val_t>(FieldAlignment));
+            Block = nullptr;
+        }
+    }
+
+    template <uint32_t... Is> void Reallocate(const int32_t NewCapacity, Utils::IndexSequence<Is...>) {
+        // One block holds all fields, every field array rounded up to the alignment boundary.
+        uint64_t Offsets[FieldCount];
+        uint64_t TotalSize = 0;
+        ((Offsets[Is] = TotalSize, TotalSize += AlignUp(sizeof(Ts) * static_cast<uint64_t>(NewCapacity))), ...);
+
+        auto* NewBlock =
+            static_cast<unsigned char*>(::operator new(TotalSize, static_cast<std::align_val_t>(FieldAlignment)));
+        (RelocateField<Is>(static_cast<void*>(NewBlock + Offsets[Is])), ...);
+
+        FreeBlock();
+        Block = NewBlock;
+        Capacity = NewCapacity;
+    }
+
+    template <uint32_t I> void RelocateField(void* NewStorage) {
+        using FieldT = FieldType<static_cast<int32_t>(I)>;
+        auto* Source = static_cast<FieldT*>(Fields[I]);
+        auto* Destination = static_cast<FieldT*>(NewStorage);
+        for (int32_t i = 0; i < Size; ++i) {
+            if constexpr (std::is_move_constructible_v<FieldT>) {
+                new (Destination + i) FieldT(std::move(Source[i]));
+            } else {
+                new (Destination + i) FieldT(Source[i]);
+            }
+            Source[i].~FieldT();
+        }
+        Fields[I] = NewStorage;
+    }
+
+    template <uint32_t... Is> void DestroyRange(const int32_t Begin, const int32_t End, Utils::IndexSequence<Is...>) {
+        if constexpr (!(std::is_trivially_destructible_v<Ts> && ...)) {
+            for (int32_t i = Begin; i < End; ++i) {
+                (Data<static_cast<int32_t>(Is)>()[i].~Ts(), ...);
+            }
+        }
+    }
+
+    template <uint32_t... Is, typename... ArgsT>
+    void ConstructAt(const int32_t Index, Utils::IndexSequence<Is...>, ArgsT&&... Values) {
+        (new (Data<static_cast<int32_t>(Is)>() + Index) Ts(std::forward<ArgsT>(Values)), ...);
+    }
+
+    template <uint32_t... Is> void DefaultConstructAt(const int32_t Index, Utils::IndexSequence<Is...>) {
+        (new (Data<static_cast<int32_t>(Is)>() + Index) Ts(), ...);
+    }
+
+    template <uint32_t... Is>
+    void ConstructFromTuple(const int32_t Index, const ValueType& Row, Utils::IndexSequence<Is...>) {
+        (new (Data<static_cast<int32_t>(Is)>() + Index) Ts(Row.template Get<static_cast<int32_t>(Is)>()), ...);
+    }
+
+    template <uint32_t... Is> void CopyConstructRange(const SoAList& other, Utils::IndexSequence<Is...>) {
+        for (int32_t i = 0; i < other.Size; ++i) {
+            (new (Data<static_cast<int32_t>(Is)>() + i) Ts(other.template Data<static_cast<int32_t>(Is)>()[i]), ...);
+        }
+    }
+
+    template <uint32_t... Is> void ShiftDown(const int32_t Index, Utils::IndexSequence<Is...>) {
+        (ShiftFieldDown<Is>(Index), ...);
+    }
+
+    template <uint32_t I> void ShiftFieldDown(const int32_t Index) {
+        using FieldT = FieldType<static_cast<int32_t>(I)>;
+        FieldT* FieldData = Data<static_cast<int32_t>(I)>();
+        for (int32_t i = Index; i < Size - 1; ++i) {
+            FieldData[i] = std::move(FieldData[i + 1]);
+        }
+        FieldData[Size - 1].~FieldT();
+    }
+
+    template <uint32_t... Is> void MoveLastInto(const int32_t Index, Utils::IndexSequence<Is...>) {
+        (MoveFieldLastInto<Is>(Index), ...);
+    }
+
+    template <uint32_t I> void MoveFieldLastInto(const int32_t Index) {
+        using FieldT = FieldType<static_cast<int32_t>(I)>;
+        FieldT* FieldData = Data<static_cast<int32_t>(I)>();
+        if (Index != Size - 1) {
+            FieldData[Index] = std::move(FieldData[Size - 1]);
+        }
+        FieldData[Size - 1].~FieldT();
+    }
+
+    template <uint32_t... Is> RowType MakeRow(const int32_t Index, Utils::IndexSequence<Is...>) {
+        return RowType(Data<static_cast<int32_t>(Is)>()[Index]...);
+    }
+
+    template <uint32_t... Is> ConstRowType MakeConstRow(const int32_t Index, Utils::IndexSequence<Is...>) const {
+        return ConstRowType(Data<static_cast<int32_t>(Is)>()[Index]...);
+    }
+
+    template <uint32_t... Is> ValueType MakeValue(const int32_t Index, Utils::IndexSequence<Is...>) const {
+        return ValueType(Data<static_cast<int32_t>(Is)>()[Index]...);
+    }
+};
+} // namespace Edvar::Containers
@@ -185,11 +185,10 @@ struct StringFormatter<T, CharT> {
         if (bufferSize <= 0) {
             return {u"(pointer formatter error)"};
         }
-        auto* buffer = new char16_t[bufferSize];
+        const Memory::ScratchMarker scratch;
+        auto* buffer = scratch.GetAllocator().AllocateArray<char16_t>(bufferSize);
         Utils::CStrings::DataToHexString(address, buffer, bufferSize, true, true, 16);
-        StringBase<CharT> result(buffer);
-        delete[] buffer;
-        return result;
+        return StringBase<CharT>(buffer);
     }
 };
 
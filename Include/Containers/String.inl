@@ -37,10 +37,8 @@ template <typename CharT> StringBase<CharT>& StringBase<CharT>::operator=(String
     return *this;
 }
 template <typename CharT> template <typename OtherCharT> StringBase<OtherCharT> StringBase<CharT>::ConvertTo() const {
-    auto* convertedBuffer = Utils::CStrings::CreateConvertedString<OtherCharT>(Data());
-    StringBase<OtherCharT> result(convertedBuffer);
-    delete[] convertedBuffer;
-    return result;
+    const Memory::ScratchMarker scratch;
+    return StringBase<OtherCharT>(Utils::CStrings::CreateScratchConvertedString<OtherCharT>(Data()));
 }
 template <typename CharT>
 template <typename OtherCharT>
@@ -102,12 +100,11 @@ StringBase<CharT> StringBase<CharT>::Equals(const StringBase& other, bool ignore
     }
 }
 template <typename CharT> StringBase<CharT> StringBase<CharT>::Lower(const I18N::Locale& locale) const {
-    const int32_t size = Utils::CStrings::ToLower(Data(), nullptr, 0, locale);
-    auto* buffer = new char16_t[size + 1];
-    Utils::CStrings::ToLower(Data(), buffer, size + 1, locale);
-    StringBase result(buffer, size);
-    delete[] buffer;
-    return result;
+    const Memory::ScratchMarker scratch;
+    const int32_t size = Utils::CStrings::ToLower(Data(), nullptr, 0, &locale);
+    auto* buffer = scratch.GetAllocator().AllocateArray<char16_t>(size + 1);
+    Utils::CStrings::ToLower(Data(), buffer, size + 1, &locale);
+    return StringBase(buffer, size);
 }
 template <typename CharT> StringBase<CharT> StringBase<CharT>::SubString(int32_t startIndex, int32_t length) const {
     // if startIndex is less than 0 set start as 0
@@ -305,13 +302,12 @@ StringBase<char16_t> StringBase<CharT>::NumberToString(const T& value, const Num
         if (bufferSize <= 0) {
             return {u"(number formatter error)"};
         }
-        auto* buffer = new char16_t[bufferSize];
+        const Memory::ScratchMarker scratch;
+        auto* buffer = scratch.GetAllocator().AllocateArray<char16_t>(bufferSize);
         Memory::ZeroMemory(buffer, bufferSize);
         Utils::CStrings::DataToHexString(static_cast<uint64_t>(value), buffer, bufferSize, FormattingRule.UpperCase,
                                          FormattingRule.UseAlternateForm, FormattingRule.MinimumIntegralDigits);
-        StringBase<char16_t> result(buffer); // -1
-        delete[] buffer;
-        return result;
+        return StringBase<char16_t>(buffer); // -1
     }
     if constexpr (std::is_integral_v<T>) {
         const int32_t bufferLength =
@@ -319,22 +315,20 @@ StringBase<char16_t> StringBase<CharT>::NumberToString(const T& value, const Num
         if (bufferLength <= 0) {
             return {u"(number formatter error)"};
         }
-        auto* buffer = new char16_t[bufferLength];
+        const Memory::ScratchMarker scratch;
+        auto* buffer = scratch.GetAllocator().AllocateArray<char16_t>(bufferLength);
         Utils::CStrings::NumberToString(static_cast<int64_t>(value), buffer, bufferLength, FormattingRule);
-        StringBase<char16_t> result(buffer);
-        delete[] buffer;
-        return result;
+        return StringBase<char16_t>(buffer);
     } else if constexpr (std::is_floating_point_v<T>) {
         const int32_t bufferLength =
             Utils::CStrings::FloatToString(static_cast<double>(value), nullptr, 0, FormattingRule);
         if (bufferLength <= 0) {
             return {u"(number formatter error)"};
         }
-        auto* buffer = new char16_t[bufferLength];
+        const Memory::ScratchMarker scratch;
+        auto* buffer = scratch.GetAllocator().AllocateArray<char16_t>(bufferLength);
         Utils::CStrings::FloatToString(static_cast<double>(value), buffer, bufferLength, FormattingRule);
-        StringBase<char16_t> result(buffer, bufferLength);
-        delete[] buffer;
-        return result;
+        return StringBase<char16_t>(buffer, bufferLength);
     }
 
     return {};
@@ -589,12 +583,12 @@ StringBase<CharT> StringBase<CharT>::ReplaceAll(const StringBase& toFind, const
 }
 template <typename CharT> StringBase<CharT> StringBase<CharT>::PadLeft(int32_t count) const {
     if (count > 0) {
-        auto* buffer = new CharT[count + 1];
-        for (int i = 0; i < count - Length(); i++) {
+        const Memory::ScratchMarker scratch;
+        auto* buffer = scratch.GetAllocator().AllocateArray<CharT>(count);
+        for (int i = 0; i < count; i++) {
             buffer[i] = static_cast<CharT>(' ');
         }
         StringBase<CharT> result(buffer, count);
-        delete[] buffer;
         result += *this;
         return result;
     } else if (count < 0) {
@@ -606,13 +600,13 @@ template <typename CharT> StringBase<CharT> StringBase<CharT>::PadLeft(int32_t c
 }
 template <typename CharT> StringBase<CharT> StringBase<CharT>::PadRight(int32_t count) const {
     if (count > 0) {
-        const CharT* buffer = new CharT[count + 1];
-        for (int i = 0; i < count - Length(); i++) {
+        const Memory::ScratchMarker scratch;
+        auto* buffer = scratch.GetAllocator().AllocateArray<CharT>(count);
+        for (int i = 0; i < count; i++) {
             buffer[i] = static_cast<CharT>(' ');
         }
         StringBase<CharT> result = *this;
         result += StringBase<CharT>(buffer, count);
-        delete[] buffer;
         return result;
     } else if (count < 0) {
         // trim from right
@@ -631,19 +625,18 @@ void StringBase<CharT>::SetDataFromRawString(const FromT* raw_str, const int32_t
     if constexpr (std::is_same_v<FromT, CharT>) {
         Memory::CopyMemory(Buffer.Data(), raw_str, length);
     } else {
-        auto* convertedBuffer = new CharT[length + 1];
+        const Memory::ScratchMarker scratch;
+        auto* convertedBuffer = scratch.GetAllocator().AllocateArray<CharT>(length + 1);
         Utils::CStrings::ConvertString(raw_str, convertedBuffer, length + 1);
         Memory::CopyMemory(Buffer.Data(), convertedBuffer, (length + 1));
-        delete[] convertedBuffer;
     }
 }
 template <typename CharT> StringBase<CharT> StringBase<CharT>::Upper(const I18N::Locale& locale) const {
-    const int32_t size = Utils::CStrings::ToLower(Data(), nullptr, 0, locale);
-    auto* buffer = new char16_t[size + 1];
-    Utils::CStrings::ToUpper(Data(), buffer, size + 1, locale);
-    StringBase result(buffer, size);
-    delete[] buffer;
-    return result;
+    const Memory::ScratchMarker scratch;
+    const int32_t size = Utils::CStrings::ToUpper(Data(), nullptr, 0, &locale);
+    auto* buffer = scratch.GetAllocator().AllocateArray<char16_t>(size + 1);
+    Utils::CStrings::ToUpper(Data(), buffer, size + 1, &locale);
+    return StringBase(buffer, size);
 }
 
 } // namespace Edvar::Containers
\ No newline at end of file
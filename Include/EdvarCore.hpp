@@ -63,10 +63,13 @@ using String = Edvar::Containers::StringBase<char16_t>;
 } // namespace Edvar::Containers
 using String = Edvar::Containers::String;
 
-#include "Platform/IPlatform.hpp" // IWYU pragma: export
-#include "Utils/Meta.hpp"         // IWYU pragma: export
-#include "Memory/Ops.hpp"         // IWYU pragma: export
-#include "Threading/Mutex.hpp"    // IWYU pragma: export
+#include "Platform/IPlatform.hpp"    // IWYU pragma: export
+#include "Platform/CPUFeatures.hpp" // IWYU pragma: export
+#include "Utils/Meta.hpp"           // IWYU pragma: export
+#include "Memory/Ops.hpp"           // IWYU pragma: export
+#include "Threading/Mutex.hpp"      // IWYU pragma: export
+
+#include "Memory/ScratchAllocator.hpp" // IWYU pragma: export
 
 #include "Containers/List.hpp"   // IWYU pragma: export
 #include "Containers/String.hpp" // IWYU pragma: export
@@ -76,7 +79,18 @@ using String = Edvar::Containers::String;
 #include "Utils/Hash.hpp" // IWYU pragma: export
 
 #include "Containers/Tuple.hpp"     // IWYU pragma: export
+#include "Containers/SoAList.hpp"   // IWYU pragma: export
+#include "Containers/SlotMap.hpp"   // IWYU pragma: export
+#include "Containers/BTree.hpp"     // IWYU pragma: export
+#include "Containers/BitArray.hpp"  // IWYU pragma: export
 #include "Memory/SmartPointers.hpp" // IWYU pragma: export
+#include "Memory/Reclamation.hpp"   // IWYU pragma: export
+#include "Memory/Published.hpp"     // IWYU pragma: export
+
+#include "Threading/WaitOnAddress.hpp" // IWYU pragma: export
+#include "Threading/SpinLock.hpp"      // IWYU pragma: export
+#include "Threading/SharedMutex.hpp"   // IWYU pragma: export
+#include "Threading/Signal.hpp"        // IWYU pragma: export
 
 #include "Utils/CString.hpp" // IWYU pragma: export
 
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include "Memory/Published.hpp"
+
 namespace Edvar::I18N {
 class Locale {
 public:
@@ -30,7 +32,11 @@ private:
 
     void* icuLocale = nullptr;
 
-    static Containers::List<Locale*> createdLocales;
-    static Threading::Mutex createdLocalesMutex;
+    struct RegisteredLocale {
+        const Locale* Owner;
+        // Copied out of the owner, readers may still compare against it after the owner was destroyed.
+        const void* IcuLocale;
+    };
+    static Memory::Published<Containers::List<RegisteredLocale>> createdLocales;
 };
 } // namespace Edvar::I18N
\ No newline at end of file
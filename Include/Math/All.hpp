@@ -10,13 +10,21 @@
 #include "Rotator.hpp"    // IWYU pragma: keep
 #include "Transform.hpp"  // IWYU pragma: keep
 #include "Vector.hpp"     // IWYU pragma: keep
+#include "Wide.hpp"       // IWYU pragma: keep
+#include "SIMDMath.hpp"   // IWYU pragma: keep
 
+#include "SIMD.inl"       // IWYU pragma: keep
 #include "Matrix.inl"     // IWYU pragma: keep
 #include "Quaternion.inl" // IWYU pragma: keep
 #include "Rotator.inl"    // IWYU pragma: keep
 #include "Transform.inl"  // IWYU pragma: keep
 #include "Vector.inl"     // IWYU pragma: keep
+#include "Wide.inl"       // IWYU pragma: keep
+#include "SIMDMath.inl"   // IWYU pragma: keep
 
-#include "Color.hpp"     // IWYU pragma: keep
-#include "Random.hpp"    // IWYU pragma: keep
-#include "Shapes.hpp"    // IWYU pragma: keep
\ No newline at end of file
+#include "BatchQuaternion.hpp" // IWYU pragma: keep
+#include "BatchTransform.hpp"  // IWYU pragma: keep
+#include "Color.hpp"           // IWYU pragma: keep
+#include "Random.hpp"          // IWYU pragma: keep
+#include "Shapes.hpp"          // IWYU pragma: keep
+#include "Shapes.inl"          // IWYU pragma: keep
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Vector.hpp"
+
+namespace Edvar::Math {
+// Batch forms of the Quaternion operations, for passes such as animation blending that evaluate thousands of them at
+// once. Elements are loaded eight at a time into Quaternionx8 and friends, so the arithmetic runs on one register per
+// component. A trailing partial group is padded and goes through the same code, every element gets the same result
+// whatever its position in the array. Inputs and out may be the same array but must not otherwise overlap. Disjoint
+// ranges may be processed on different threads, e.g. split with Threading::ParallelFor.
+//
+// Callers that already keep the components in separate arrays can use QuaternionWide directly, its Load and Store
+// take one pointer per component.
+
+/** @brief out[i] = a[i] * b[i]. */
+EDVAR_CPP_CORE_API void MultiplyQuaternions(const Quaternion* a, const Quaternion* b, Quaternion* out, int32_t count);
+/** @brief out[i] = in[i].Normalized(). */
+EDVAR_CPP_CORE_API void NormalizeQuaternions(const Quaternion* in, Quaternion* out, int32_t count);
+/** @brief out[i] = Quaternion::Nlerp(a[i], b[i], alphas[i]). */
+EDVAR_CPP_CORE_API void NlerpQuaternions(const Quaternion* a, const Quaternion* b, const float* alphas,
+                                         Quaternion* out, int32_t count);
+/**
+ * @brief out[i] = Quaternion::Slerp(a[i], b[i], alphas[i]), within 1e-6 for unit inputs.
+ *
+ * See QuaternionWide::Slerp for the approximations used.
+ */
+EDVAR_CPP_CORE_API void SlerpQuaternions(const Quaternion* a, const Quaternion* b, const float* alphas,
+                                         Quaternion* out, int32_t count);
+/** @brief out[i] = rotations[i].RotateVector(in[i]). */
+EDVAR_CPP_CORE_API void RotateVectors(const Quaternion* rotations, const Vector3f* in, Vector3f* out, int32_t count);
+/** @brief out[i] = in[i].ToRotationMatrix4x4(). */
+EDVAR_CPP_CORE_API void ToRotationMatrices(const Quaternion* in, Matrix4x4f* out, int32_t count);
+} // namespace Edvar::Math
@@ -0,0 +1,33 @@
+#pragma once
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+namespace Edvar::Math {
+// Batch forms of Matrix4x4::TransformPoint (w = 1) and Matrix4x4::TransformVector (w = 0). The kernel is picked at
+// runtime for the widest instruction set the machine supports, with AVX2 and FMA eight floats or four doubles are
+// transformed per step. Results may differ from the per-vector functions in the last bit because of fused
+// multiply-adds. In and out may be the same array but must not otherwise overlap. Disjoint ranges may be transformed
+// on different threads, e.g. split with Threading::ParallelFor in chunks of BatchTransformChunkSize.
+
+/** @brief Elements per job that keep the thread pool overhead negligible against the transform itself. */
+static constexpr int32_t BatchTransformChunkSize = 16 * 1024;
+
+EDVAR_CPP_CORE_API void TransformPoints(const Matrix4x4f& matrix, const Vector3f* in, Vector3f* out, int32_t count);
+EDVAR_CPP_CORE_API void TransformPoints(const Matrix4x4d& matrix, const Vector3d* in, Vector3d* out, int32_t count);
+EDVAR_CPP_CORE_API void TransformDirections(const Matrix4x4f& matrix, const Vector3f* in, Vector3f* out,
+                                            int32_t count);
+EDVAR_CPP_CORE_API void TransformDirections(const Matrix4x4d& matrix, const Vector3d* in, Vector3d* out,
+                                            int32_t count);
+
+// Structure of arrays variants, each component in its own array as in an SoAList. These need no shuffles between the
+// loads and the arithmetic.
+EDVAR_CPP_CORE_API void TransformPoints(const Matrix4x4f& matrix, const float* inX, const float* inY, const float* inZ,
+                                        float* outX, float* outY, float* outZ, int32_t count);
+EDVAR_CPP_CORE_API void TransformPoints(const Matrix4x4d& matrix, const double* inX, const double* inY,
+                                        const double* inZ, double* outX, double* outY, double* outZ, int32_t count);
+EDVAR_CPP_CORE_API void TransformDirections(const Matrix4x4f& matrix, const float* inX, const float* inY,
+                                            const float* inZ, float* outX, float* outY, float* outZ, int32_t count);
+EDVAR_CPP_CORE_API void TransformDirections(const Matrix4x4d& matrix, const double* inX, const double* inY,
+                                            const double* inZ, double* outX, double* outY, double* outZ,
+                                            int32_t count);
+} // namespace Edvar::Math
@@ -0,0 +1,122 @@
+#pragma once
+#include "Containers/List.hpp"
+#include "Math/All.hpp"
+#include "Utils/Functional.hpp"
+
+namespace Edvar::Threading {
+class ThreadPool;
+}
+
+namespace Edvar::Math {
+/**
+ * @brief A binary bounding volume hierarchy over a set of boxes, for ray, frustum, overlap and nearest queries that
+ * would otherwise test every box.
+ *
+ * Build splits nodes with the surface area heuristic, evaluated over BinCount bins of the box centers per axis. Given
+ * a thread pool, independent subtrees are built on its workers. Refit updates the boxes of an existing tree in one
+ * pass when objects move, without changing its topology, so the tree slowly loses quality and should be rebuilt once
+ * objects have moved far.
+ *
+ * Queries walk the tree with an explicit stack and test the up to four nodes two levels below the current one at once,
+ * one SIMD::Float_4 lane each. Primitives are identified by their index in the bounds given to Build, the hierarchy
+ * keeps its own copy of their boxes and only reports primitives whose box passes the query.
+ *
+ * Example usage:
+ *   BoundingVolumeHierarchy bvh;
+ *   bvh.Build(bounds.Data(), bounds.Length());
+ *   auto visit = [&](const int32_t primitive) { visible.Add(primitive); };
+ *   bvh.QueryFrustum(Frustum(viewProjection), visit);
+ */
+class EDVAR_CPP_CORE_API BoundingVolumeHierarchy {
+public:
+    static constexpr int32_t InvalidIndex = -1;
+    /** @brief Candidate split positions per axis are the boundaries between this many bins. */
+    static constexpr int32_t BinCount = 16;
+    /** @brief Nodes with more primitives are always split. */
+    static constexpr int32_t MaxLeafSize = 4;
+    /** @brief Smallest subtree handed to a worker on parallel builds. */
+    static constexpr int32_t ParallelBuildThreshold = 4096;
+
+    /**
+     * @brief A 32 byte node, two to a 64 byte cache line.
+     *
+     * Internal nodes have a Count of 0 and their two children at Index and Index + 1. Leaves hold the Count primitives
+     * starting at Index in GetPrimitiveIndices. Children are always stored after their parent, the root is node 0.
+     */
+    struct Node {
+        Vector3f Min;
+        int32_t Index;
+        Vector3f Max;
+        int32_t Count;
+
+        bool IsLeaf() const { return Count > 0; }
+        AABB GetBounds() const { return AABB(Min, Max); }
+    };
+
+    BoundingVolumeHierarchy() = default;
+
+    /** @brief Replaces the hierarchy with one over bounds[0..count), which must all be valid boxes. */
+    void Build(const AABB* bounds, int32_t count);
+    /** @brief As Build, with the subtrees and the binning of large nodes spread over pool. */
+    void Build(const AABB* bounds, int32_t count, Threading::ThreadPool& pool);
+    /**
+     * @brief Moves every box to bounds[primitive] and refits the nodes above it, bounds holding as many boxes as the
+     * last Build. The tree structure is kept.
+     */
+    void Refit(const AABB* bounds);
+    void Clear();
+
+    /**
+     * @brief Finds the first primitive along the ray origin + t * direction with t in [0, maxDistance).
+     *
+     * intersect(primitive, closest) is called for every primitive whose box the ray enters before the closest hit
+     * found so far, and returns the t of its hit, or a negative value or one >= closest for a miss. direction need not
+     * be normalized, distances are in units of its length.
+     *
+     * @return The primitive hit first, InvalidIndex if none. Its t is written to outDistance when given.
+     */
+    int32_t Raycast(const Vector3f& origin, const Vector3f& direction, float maxDistance,
+                    Utils::FunctionRef<float(int32_t primitive, float closest)> intersect,
+                    float* outDistance = nullptr) const;
+    /** @brief Raycast against the primitive boxes themselves. */
+    int32_t Raycast(const Vector3f& origin, const Vector3f& direction, float maxDistance,
+                    float* outDistance = nullptr) const;
+    /** @brief Calls visit(primitive) for every primitive whose box intersects box. */
+    void QueryOverlaps(const AABB& box, Utils::FunctionRef<void(int32_t primitive)> visit) const;
+    /** @brief Calls visit(primitive) for every primitive whose box passes Frustum::Intersects. */
+    void QueryFrustum(const Frustum& frustum, Utils::FunctionRef<void(int32_t primitive)> visit) const;
+    /**
+     * @brief Finds the primitive closest to point within maxDistance.
+     *
+     * distanceSquared(primitive) returns the squared distance from point to the primitive and is only called for
+     * primitives whose box is closer than the best one found so far.
+     *
+     * @return The closest primitive, InvalidIndex if none is within maxDistance. Its squared distance is written to
+     * outDistanceSquared when given.
+     */
+    int32_t FindNearest(const Vector3f& point, float maxDistance,
+                        Utils::FunctionRef<float(int32_t primitive)> distanceSquared,
+                        float* outDistanceSquared = nullptr) const;
+    /** @brief FindNearest measuring the distance to the primitive boxes themselves. */
+    int32_t FindNearest(const Vector3f& point, float maxDistance, float* outDistanceSquared = nullptr) const;
+
+    int32_t GetPrimitiveCount() const { return primitiveIndices.Length(); }
+    int32_t GetNodeCount() const { return nodes.Length(); }
+    /** @brief Number of nodes on the longest path from the root to a leaf, 0 for an empty hierarchy. */
+    int32_t GetDepth() const { return depth; }
+    const Node* GetNodes() const { return nodes.Data(); }
+    /** @brief Primitive indices in leaf order, the ranges of the leaves point into this. */
+    const int32_t* GetPrimitiveIndices() const { return primitiveIndices.Data(); }
+    /** @brief Bounds of the whole hierarchy, the default empty box when it has no primitives. */
+    AABB GetBounds() const;
+
+private:
+    Containers::List<Node> nodes;
+    Containers::List<int32_t> primitiveIndices;
+    // Boxes of the primitives in the order of primitiveIndices
+    Containers::List<AABB> primitiveBounds;
+    int32_t depth = 0;
+
+    void BuildInternal(const AABB* bounds, int32_t count, Threading::ThreadPool* pool);
+};
+} // namespace Edvar::Math
@@ -1,5 +1,49 @@
 #pragma once
 
+#ifndef EDVAR_CPP_CORE_MATH_ALLOW_SIMD
+#    define EDVAR_CPP_CORE_MATH_ALLOW_SIMD 1 // Enable SIMD by default, this can be disabled
+#endif
+
+#ifndef EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX
+#    define EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX 1 // Enable AVX by default, this can be disabled
+#endif
+
+// The SIMD wrappers are implemented in SIMD.inl, so the backend is chosen per translation unit from these macros.
+#if EDVAR_CPP_CORE_MATH_ALLOW_SIMD && (defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64) ||                    \
+                                       (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define EDVAR_CPP_CORE_MATH_X86_SIMD 1
+#    define EDVAR_CPP_CORE_MATH_ARM64_SIMD 0
+#elif EDVAR_CPP_CORE_MATH_ALLOW_SIMD && (defined(_M_ARM64) || defined(__aarch64__))
+#    define EDVAR_CPP_CORE_MATH_X86_SIMD 0
+#    define EDVAR_CPP_CORE_MATH_ARM64_SIMD 1
+#else
+#    define EDVAR_CPP_CORE_MATH_X86_SIMD 0
+#    define EDVAR_CPP_CORE_MATH_ARM64_SIMD 0
+#endif
+
+// MSVC exposes every intrinsic regardless of /arch, GCC and Clang only the ones enabled for the target.
+#if EDVAR_CPP_CORE_MATH_X86_SIMD && EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX && (defined(_MSC_VER) || defined(__AVX__))
+#    define EDVAR_CPP_CORE_MATH_X86_AVX 1
+#else
+#    define EDVAR_CPP_CORE_MATH_X86_AVX 0
+#endif
+#if EDVAR_CPP_CORE_MATH_X86_AVX && defined(__AVX2__)
+#    define EDVAR_CPP_CORE_MATH_X86_AVX2 1
+#else
+#    define EDVAR_CPP_CORE_MATH_X86_AVX2 0
+#endif
+#if EDVAR_CPP_CORE_MATH_X86_SIMD && (defined(_MSC_VER) || defined(__SSE4_1__))
+#    define EDVAR_CPP_CORE_MATH_X86_SSE41 1
+#else
+#    define EDVAR_CPP_CORE_MATH_X86_SSE41 0
+#endif
+
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+#    include <immintrin.h>
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+#    include <arm_neon.h>
+#endif
+
 namespace Edvar::Math {
 static constexpr double PI = 3.14159265358979323846;
 static constexpr double TWO_PI = 2.0 * PI;
@@ -352,6 +396,8 @@ struct alignas(16) Float_4 {
     Float_4 LessThan(const Float_4& other) const;
     Float_4 GreaterThan(const Float_4& other) const;
     Float_4 Equal(const Float_4& other) const;
+    /** @return Bit i is set when lane i of this comparison result is set. */
+    int32_t GetMaskBits() const;
 
     Float_4 HorizontalAdd(const Float_4& other) const;
     Float_4 Min(const Float_4& other) const;
@@ -382,6 +428,15 @@ struct alignas(16) Float_4 {
     Float_4 MoveOtherLowerToHigher(const Float_4& other) const;
 
     static void MatrixMultiply4x4(const Float_4 matrix[4], const Float_4 otherTransposedMatrix[4], Float_4 result[4]);
+    /** @brief result = matrix * other for row-major 4x4 matrices, other given as rows. */
+    static void MatrixMultiplyRows4x4(const Float_4 matrix[4], const Float_4 other[4], Float_4 result[4]);
+    static void MatrixTranspose4x4(const Float_4 matrix[4], Float_4 result[4]);
+    /**
+     * @brief Inverts a row-major 4x4 matrix with the 2x2 block method.
+     * @return The determinant, result is only written when its magnitude is at least VERY_SMALL_NUMBER.
+     */
+    static float MatrixInverse4x4(const Float_4 matrix[4], Float_4 result[4]);
+    static float MatrixDeterminant4x4(const Float_4 matrix[4]);
 
     DECLARE_4COMPONENT_SHUFFLES(Float_4);
     DECLARE_4COMPONENT_SELF_SHUFFLES_USENONSELF(Float_4);
@@ -473,6 +528,8 @@ struct alignas(16) Double_2 {
     Double_2 LessThan(const Double_2& other) const;
     Double_2 GreaterThan(const Double_2& other) const;
     Double_2 Equal(const Double_2& other) const;
+    /** @return Bit i is set when lane i of this comparison result is set. */
+    int32_t GetMaskBits() const;
 
     Double_2 HorizontalAdd(const Double_2& other) const;
     Double_2 Min(const Double_2& other) const;
@@ -517,12 +574,10 @@ struct alignas(32) Double_4 {
             double X, Y, Z, W;
         };
         double XYZW[4];
-#if !EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX
         struct {
             Double_2 XY_Double2;
             Double_2 ZW_Double2;
         };
-#endif
     };
 
     template <int32_t Index> double Get() const {
@@ -608,6 +663,8 @@ struct alignas(32) Double_4 {
     Double_4 LessThan(const Double_4& other) const;
     Double_4 GreaterThan(const Double_4& other) const;
     Double_4 Equal(const Double_4& other) const;
+    /** @return Bit i is set when lane i of this comparison result is set. */
+    int32_t GetMaskBits() const;
 
     Double_4 HorizontalAdd(const Double_4& other) const;
     Double_4 Min(const Double_4& other) const;
@@ -639,10 +696,58 @@ struct alignas(32) Double_4 {
 
     static void MatrixMultiply4x4(const Double_4 matrix[4], const Double_4 otherTransposedMatrix[4],
                                   Double_4 result[4]);
+    /** @brief result = matrix * other for row-major 4x4 matrices, other given as rows. */
+    static void MatrixMultiplyRows4x4(const Double_4 matrix[4], const Double_4 other[4], Double_4 result[4]);
+    static void MatrixTranspose4x4(const Double_4 matrix[4], Double_4 result[4]);
+    /**
+     * @brief Inverts a row-major 4x4 matrix with the 2x2 block method.
+     * @return The determinant, result is only written when its magnitude is at least VERY_SMALL_NUMBER.
+     */
+    static double MatrixInverse4x4(const Double_4 matrix[4], Double_4 result[4]);
+    static double MatrixDeterminant4x4(const Double_4 matrix[4]);
 
     DECLARE_4COMPONENT_SHUFFLES(Double_4);
     DECLARE_4COMPONENT_SELF_SHUFFLES_USENONSELF(Double_4);
 };
+/**
+ * @brief Eight floats, one AVX register or two Float_4 halves. Only has the lane-wise operations, it is the register
+ * type of the 8-wide types in Wide.hpp rather than a vector in its own right.
+ */
+struct alignas(32) Float_8 {
+    Float_8() = default;
+    explicit Float_8(float value) : Low(value, value, value, value), High(value, value, value, value) {}
+    Float_8(const Float_4& low, const Float_4& high) : Low(low), High(high) {}
+    /** Lanes 0-3 and 4-7, contiguous in memory. */
+    Float_4 Low, High;
+
+    static constexpr int32_t ElementCount = 8;
+    static constexpr int32_t PerElementSize = sizeof(float);
+
+    /** @param ptr Must be 32-byte aligned, 8 floats will be read. */
+    static Float_8 LoadAligned(const float* ptr);
+    static Float_8 LoadUnaligned(const float* ptr);
+    /** @param ptr Must be 32-byte aligned, 8 floats will be written. */
+    void StoreAligned(float* ptr) const;
+    void StoreUnaligned(float* ptr) const;
+
+    Float_8 operator+(const Float_8& other) const;
+    Float_8 operator-(const Float_8& other) const;
+    Float_8 operator*(const Float_8& other) const;
+    Float_8 operator/(const Float_8& other) const;
+    Float_8 operator|(const Float_8& other) const;
+    Float_8 operator&(const Float_8& other) const;
+    Float_8 operator^(const Float_8& other) const;
+
+    Float_8 LessThan(const Float_8& other) const;
+    Float_8 GreaterThan(const Float_8& other) const;
+    Float_8 Equal(const Float_8& other) const;
+    /** @return Bit i is set when lane i of this comparison result is set. */
+    int32_t GetMaskBits() const;
+
+    Float_8 Min(const Float_8& other) const;
+    Float_8 Max(const Float_8& other) const;
+    Float_8 SquareRoot() const;
+};
 struct alignas(16) Int32_4 {
     Int32_4() : X(0), Y(0), Z(0), W(0) {}
     Int32_4(int32_t x, int32_t y, int32_t z, int32_t w) : X(x), Y(y), Z(z), W(w) {}
@@ -144,6 +144,21 @@ struct alignas(std::is_same_v<T, double> ? 32 : 16) Matrix4x4 {
     /** Check if matrix is invertible */
     bool IsInvertible(T epsilon = static_cast<T>(SMALL_NUMBER)) const;
 
+    /**
+     * Inverse of an affine matrix, bottom row (0, 0, 0, 1), e.g. any TRS. Only inverts the 3x3 part and the
+     * translation, cheaper than Inverse. Returns identity if the 3x3 part is singular.
+     */
+    Matrix4x4<T> InverseAffine() const;
+
+    /** Inverse of a rotation and translation without scale or shear, transposes the rotation instead of inverting */
+    Matrix4x4<T> InverseOrthonormal() const;
+
+    /**
+     * Running products along a chain: results[0] = matrices[0], results[i] = results[i - 1] * matrices[i], e.g. the
+     * world matrices of a parent-to-child path of local matrices. results may be matrices.
+     */
+    static void MultiplyChain(const Matrix4x4<T>* matrices, Matrix4x4<T>* results, int32_t count);
+
     // ========================================================================
     // Transformation factories (Left-Handed Z-Up)
     // ========================================================================
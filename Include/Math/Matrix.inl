@@ -145,9 +145,6 @@ template <typename T>
 Matrix4x4<T> Matrix4x4<T>::operator*(const Matrix4x4<T>& other) const {
     Matrix4x4<T> result;
 
-    // SIMD::MatrixMultiply4x4 expects the second matrix to be transposed
-    // We handle the transpose internally for a cleaner API
-    Matrix4x4<T> otherTransposed = other.Transpose();
     if constexpr (std::is_integral_v<T>) {
         // integer types should use the specialized integer multiplication
         for (int i = 0; i < 4; ++i) {
@@ -160,7 +157,7 @@ Matrix4x4<T> Matrix4x4<T>::operator*(const Matrix4x4<T>& other) const {
             }
         }
     } else {
-        SIMDType::MatrixMultiply4x4(Rows, otherTransposed.Rows, result.Rows);
+        SIMDType::MatrixMultiplyRows4x4(Rows, other.Rows, result.Rows);
     }
 
     return result;
@@ -295,12 +292,14 @@ template <typename T>
 Matrix4x4<T> Matrix4x4<T>::Transpose() const {
     Matrix4x4<T> result;
 
-    // Transpose using SIMD shuffles for better performance
-    // For now, use scalar path (can be optimized later with SIMD shuffles)
-    for (int i = 0; i < 4; ++i) {
-        for (int j = 0; j < 4; ++j) {
-            result.M[i][j] = M[j][i];
+    if constexpr (std::is_integral_v<T>) {
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                result.M[i][j] = M[j][i];
+            }
         }
+    } else {
+        SIMDType::MatrixTranspose4x4(Rows, result.Rows);
     }
 
     return result;
@@ -309,80 +308,183 @@ Matrix4x4<T> Matrix4x4<T>::Transpose() const {
 template <typename T>
     requires(std::is_arithmetic_v<T> && SIMD::IsSIMDTypeSupported<T>)
 T Matrix4x4<T>::Determinant() const {
-    // Calculate 4x4 determinant using cofactor expansion
-    T a00 = M[0][0], a01 = M[0][1], a02 = M[0][2], a03 = M[0][3];
-    T a10 = M[1][0], a11 = M[1][1], a12 = M[1][2], a13 = M[1][3];
-    T a20 = M[2][0], a21 = M[2][1], a22 = M[2][2], a23 = M[2][3];
-    T a30 = M[3][0], a31 = M[3][1], a32 = M[3][2], a33 = M[3][3];
+    if constexpr (!std::is_integral_v<T>) {
+        return SIMDType::MatrixDeterminant4x4(Rows);
+    } else {
+        // Calculate 4x4 determinant using cofactor expansion
+        T a00 = M[0][0], a01 = M[0][1], a02 = M[0][2], a03 = M[0][3];
+        T a10 = M[1][0], a11 = M[1][1], a12 = M[1][2], a13 = M[1][3];
+        T a20 = M[2][0], a21 = M[2][1], a22 = M[2][2], a23 = M[2][3];
+        T a30 = M[3][0], a31 = M[3][1], a32 = M[3][2], a33 = M[3][3];
+
+        // Calculate 2x2 sub-determinants
+        T det0 = a22 * a33 - a23 * a32;
+        T det1 = a21 * a33 - a23 * a31;
+        T det2 = a21 * a32 - a22 * a31;
+        T det3 = a20 * a33 - a23 * a30;
+        T det4 = a20 * a32 - a22 * a30;
+        T det5 = a20 * a31 - a21 * a30;
+
+        // Calculate 3x3 cofactors
+        T cof0 = a11 * det0 - a12 * det1 + a13 * det2;
+        T cof1 = a10 * det0 - a12 * det3 + a13 * det4;
+        T cof2 = a10 * det1 - a11 * det3 + a13 * det5;
+        T cof3 = a10 * det2 - a11 * det4 + a12 * det5;
+
+        // Calculate 4x4 determinant
+        return a00 * cof0 - a01 * cof1 + a02 * cof2 - a03 * cof3;
+    }
+}
+
+template <typename T>
+    requires(std::is_arithmetic_v<T> && SIMD::IsSIMDTypeSupported<T>)
+Matrix4x4<T> Matrix4x4<T>::Inverse() const {
+    if constexpr (!std::is_integral_v<T>) {
+        Matrix4x4<T> result;
+        if (Abs(SIMDType::MatrixInverse4x4(Rows, result.Rows)) < static_cast<T>(VERY_SMALL_NUMBER)) {
+            // Matrix is singular, return identity
+            return Identity;
+        }
+        return result;
+    } else {
+        T det = Determinant();
+
+        if (Abs(det) < static_cast<T>(VERY_SMALL_NUMBER)) {
+            // Matrix is singular, return identity
+            return Identity;
+        }
 
-    // Calculate 2x2 sub-determinants
-    T det0 = a22 * a33 - a23 * a32;
-    T det1 = a21 * a33 - a23 * a31;
-    T det2 = a21 * a32 - a22 * a31;
-    T det3 = a20 * a33 - a23 * a30;
-    T det4 = a20 * a32 - a22 * a30;
-    T det5 = a20 * a31 - a21 * a30;
+        // Calculate inverse using adjugate method
+        Matrix4x4<T> result;
 
-    // Calculate 3x3 cofactors
-    T cof0 = a11 * det0 - a12 * det1 + a13 * det2;
-    T cof1 = a10 * det0 - a12 * det3 + a13 * det4;
-    T cof2 = a10 * det1 - a11 * det3 + a13 * det5;
-    T cof3 = a10 * det2 - a11 * det4 + a12 * det5;
+        T a00 = M[0][0], a01 = M[0][1], a02 = M[0][2], a03 = M[0][3];
+        T a10 = M[1][0], a11 = M[1][1], a12 = M[1][2], a13 = M[1][3];
+        T a20 = M[2][0], a21 = M[2][1], a22 = M[2][2], a23 = M[2][3];
+        T a30 = M[3][0], a31 = M[3][1], a32 = M[3][2], a33 = M[3][3];
+
+        // Calculate cofactor matrix (transposed)
+        result.M[0][0] =
+            (a11 * (a22 * a33 - a23 * a32) - a12 * (a21 * a33 - a23 * a31) + a13 * (a21 * a32 - a22 * a31));
+        result.M[0][1] =
+            -(a01 * (a22 * a33 - a23 * a32) - a02 * (a21 * a33 - a23 * a31) + a03 * (a21 * a32 - a22 * a31));
+        result.M[0][2] =
+            (a01 * (a12 * a33 - a13 * a32) - a02 * (a11 * a33 - a13 * a31) + a03 * (a11 * a32 - a12 * a31));
+        result.M[0][3] =
+            -(a01 * (a12 * a23 - a13 * a22) - a02 * (a11 * a23 - a13 * a21) + a03 * (a11 * a22 - a12 * a21));
+
+        result.M[1][0] =
+            -(a10 * (a22 * a33 - a23 * a32) - a12 * (a20 * a33 - a23 * a30) + a13 * (a20 * a32 - a22 * a30));
+        result.M[1][1] =
+            (a00 * (a22 * a33 - a23 * a32) - a02 * (a20 * a33 - a23 * a30) + a03 * (a20 * a32 - a22 * a30));
+        result.M[1][2] =
+            -(a00 * (a12 * a33 - a13 * a32) - a02 * (a10 * a33 - a13 * a30) + a03 * (a10 * a32 - a12 * a30));
+        result.M[1][3] =
+            (a00 * (a12 * a23 - a13 * a22) - a02 * (a10 * a23 - a13 * a20) + a03 * (a10 * a22 - a12 * a20));
+
+        result.M[2][0] =
+            (a10 * (a21 * a33 - a23 * a31) - a11 * (a20 * a33 - a23 * a30) + a13 * (a20 * a31 - a21 * a30));
+        result.M[2][1] =
+            -(a00 * (a21 * a33 - a23 * a31) - a01 * (a20 * a33 - a23 * a30) + a03 * (a20 * a31 - a21 * a30));
+        result.M[2][2] =
+            (a00 * (a11 * a33 - a13 * a31) - a01 * (a10 * a33 - a13 * a30) + a03 * (a10 * a31 - a11 * a30));
+        result.M[2][3] =
+            -(a00 * (a11 * a23 - a13 * a21) - a01 * (a10 * a23 - a13 * a20) + a03 * (a10 * a21 - a11 * a20));
+
+        result.M[3][0] =
+            -(a10 * (a21 * a32 - a22 * a31) - a11 * (a20 * a32 - a22 * a30) + a12 * (a20 * a31 - a21 * a30));
+        result.M[3][1] =
+            (a00 * (a21 * a32 - a22 * a31) - a01 * (a20 * a32 - a22 * a30) + a02 * (a20 * a31 - a21 * a30));
+        result.M[3][2] =
+            -(a00 * (a11 * a32 - a12 * a31) - a01 * (a10 * a32 - a12 * a30) + a02 * (a10 * a31 - a11 * a30));
+        result.M[3][3] =
+            (a00 * (a11 * a22 - a12 * a21) - a01 * (a10 * a22 - a12 * a20) + a02 * (a10 * a21 - a11 * a20));
+
+        // Divide by determinant
+        T invDet = static_cast<T>(1) / det;
+        result *= invDet;
 
-    // Calculate 4x4 determinant
-    return a00 * cof0 - a01 * cof1 + a02 * cof2 - a03 * cof3;
+        return result;
+    }
 }
 
 template <typename T>
     requires(std::is_arithmetic_v<T> && SIMD::IsSIMDTypeSupported<T>)
-Matrix4x4<T> Matrix4x4<T>::Inverse() const {
-    T det = Determinant();
+bool Matrix4x4<T>::IsInvertible(T epsilon) const {
+    return Abs(Determinant()) > epsilon;
+}
 
-    if (Abs(det) < static_cast<T>(VERY_SMALL_NUMBER)) {
-        // Matrix is singular, return identity
-        return Identity;
+template <typename T>
+    requires(std::is_arithmetic_v<T> && SIMD::IsSIMDTypeSupported<T>)
+Matrix4x4<T> Matrix4x4<T>::InverseAffine() const {
+    if constexpr (std::is_integral_v<T>) {
+        return Inverse();
+    } else {
+        const Vector3<T> row0(M[0][0], M[0][1], M[0][2]);
+        const Vector3<T> row1(M[1][0], M[1][1], M[1][2]);
+        const Vector3<T> row2(M[2][0], M[2][1], M[2][2]);
+
+        // The columns of the 3x3 adjugate are cross products of the rows
+        const Vector3<T> cross12 = row1.Cross(row2);
+        const T det = row0.Dot(cross12);
+        if (Abs(det) < static_cast<T>(VERY_SMALL_NUMBER)) {
+            return Identity;
+        }
+        const T invDet = static_cast<T>(1) / det;
+        const Vector3<T> column0 = cross12 * invDet;
+        const Vector3<T> column1 = row2.Cross(row0) * invDet;
+        const Vector3<T> column2 = row0.Cross(row1) * invDet;
+
+        // Inverse translation is -R^-1 * t
+        const Vector3<T> translation = GetTranslation();
+        const Vector3<T> inverseTranslation =
+            -(column0 * translation.X + column1 * translation.Y + column2 * translation.Z);
+
+        Matrix4x4<T> result = Identity;
+        result.M[0][0] = column0.X;
+        result.M[0][1] = column1.X;
+        result.M[0][2] = column2.X;
+        result.M[1][0] = column0.Y;
+        result.M[1][1] = column1.Y;
+        result.M[1][2] = column2.Y;
+        result.M[2][0] = column0.Z;
+        result.M[2][1] = column1.Z;
+        result.M[2][2] = column2.Z;
+        result.SetTranslation(inverseTranslation);
+        return result;
     }
+}
 
-    // Calculate inverse using adjugate method
-    Matrix4x4<T> result;
-
-    T a00 = M[0][0], a01 = M[0][1], a02 = M[0][2], a03 = M[0][3];
-    T a10 = M[1][0], a11 = M[1][1], a12 = M[1][2], a13 = M[1][3];
-    T a20 = M[2][0], a21 = M[2][1], a22 = M[2][2], a23 = M[2][3];
-    T a30 = M[3][0], a31 = M[3][1], a32 = M[3][2], a33 = M[3][3];
-
-    // Calculate cofactor matrix (transposed)
-    result.M[0][0] = (a11 * (a22 * a33 - a23 * a32) - a12 * (a21 * a33 - a23 * a31) + a13 * (a21 * a32 - a22 * a31));
-    result.M[0][1] = -(a01 * (a22 * a33 - a23 * a32) - a02 * (a21 * a33 - a23 * a31) + a03 * (a21 * a32 - a22 * a31));
-    result.M[0][2] = (a01 * (a12 * a33 - a13 * a32) - a02 * (a11 * a33 - a13 * a31) + a03 * (a11 * a32 - a12 * a31));
-    result.M[0][3] = -(a01 * (a12 * a23 - a13 * a22) - a02 * (a11 * a23 - a13 * a21) + a03 * (a11 * a22 - a12 * a21));
-
-    result.M[1][0] = -(a10 * (a22 * a33 - a23 * a32) - a12 * (a20 * a33 - a23 * a30) + a13 * (a20 * a32 - a22 * a30));
-    result.M[1][1] = (a00 * (a22 * a33 - a23 * a32) - a02 * (a20 * a33 - a23 * a30) + a03 * (a20 * a32 - a22 * a30));
-    result.M[1][2] = -(a00 * (a12 * a33 - a13 * a32) - a02 * (a10 * a33 - a13 * a30) + a03 * (a10 * a32 - a12 * a30));
-    result.M[1][3] = (a00 * (a12 * a23 - a13 * a22) - a02 * (a10 * a23 - a13 * a20) + a03 * (a10 * a22 - a12 * a20));
-
-    result.M[2][0] = (a10 * (a21 * a33 - a23 * a31) - a11 * (a20 * a33 - a23 * a30) + a13 * (a20 * a31 - a21 * a30));
-    result.M[2][1] = -(a00 * (a21 * a33 - a23 * a31) - a01 * (a20 * a33 - a23 * a30) + a03 * (a20 * a31 - a21 * a30));
-    result.M[2][2] = (a00 * (a11 * a33 - a13 * a31) - a01 * (a10 * a33 - a13 * a30) + a03 * (a10 * a31 - a11 * a30));
-    result.M[2][3] = -(a00 * (a11 * a23 - a13 * a21) - a01 * (a10 * a23 - a13 * a20) + a03 * (a10 * a21 - a11 * a20));
-
-    result.M[3][0] = -(a10 * (a21 * a32 - a22 * a31) - a11 * (a20 * a32 - a22 * a30) + a12 * (a20 * a31 - a21 * a30));
-    result.M[3][1] = (a00 * (a21 * a32 - a22 * a31) - a01 * (a20 * a32 - a22 * a30) + a02 * (a20 * a31 - a21 * a30));
-    result.M[3][2] = -(a00 * (a11 * a32 - a12 * a31) - a01 * (a10 * a32 - a12 * a30) + a02 * (a10 * a31 - a11 * a30));
-    result.M[3][3] = (a00 * (a11 * a22 - a12 * a21) - a01 * (a10 * a22 - a12 * a20) + a02 * (a10 * a21 - a11 * a20));
-
-    // Divide by determinant
-    T invDet = static_cast<T>(1) / det;
-    result *= invDet;
+template <typename T>
+    requires(std::is_arithmetic_v<T> && SIMD::IsSIMDTypeSupported<T>)
+Matrix4x4<T> Matrix4x4<T>::InverseOrthonormal() const {
+    // Inverse is [R^T, -R^T * t], the rows of R^T are the axes
+    const Vector3<T> axisX = GetAxisX();
+    const Vector3<T> axisY = GetAxisY();
+    const Vector3<T> axisZ = GetAxisZ();
+    const Vector3<T> translation = GetTranslation();
 
+    Matrix4x4<T> result = Identity;
+    result.SetRow(0, Vector4<T>(axisX.X, axisX.Y, axisX.Z, -axisX.Dot(translation)));
+    result.SetRow(1, Vector4<T>(axisY.X, axisY.Y, axisY.Z, -axisY.Dot(translation)));
+    result.SetRow(2, Vector4<T>(axisZ.X, axisZ.Y, axisZ.Z, -axisZ.Dot(translation)));
     return result;
 }
 
 template <typename T>
     requires(std::is_arithmetic_v<T> && SIMD::IsSIMDTypeSupported<T>)
-bool Matrix4x4<T>::IsInvertible(T epsilon) const {
-    return Abs(Determinant()) > epsilon;
+void Matrix4x4<T>::MultiplyChain(const Matrix4x4<T>* matrices, Matrix4x4<T>* results, const int32_t count) {
+    if (count <= 0) {
+        return;
+    }
+    results[0] = matrices[0];
+    for (int32_t i = 1; i < count; ++i) {
+        if constexpr (std::is_integral_v<T>) {
+            results[i] = results[i - 1] * matrices[i];
+        } else {
+            // Straight on the rows, no temporary matrix per step
+            SIMDType::MatrixMultiplyRows4x4(results[i - 1].Rows, matrices[i].Rows, results[i].Rows);
+        }
+    }
 }
 
 // ========================================================================
@@ -594,7 +696,7 @@ Matrix4x4<T> Matrix4x4<T>::PerspectiveFov_ReverseZ(T fovYRadians, T aspectRatio,
     result.M[0][0] = static_cast<T>(1) / (aspectRatio * tanHalfFovy);
     result.M[1][1] = static_cast<T>(1) / tanHalfFovy;
     result.M[2][2] = nearZ / (nearZ - farZ);
-    result.M[2][3] = (farZ * nearZ) / (nearZ - farZ);
+    result.M[2][3] = -(farZ * nearZ) / (nearZ - farZ);
     result.M[3][2] = static_cast<T>(1);
     result.M[3][3] = static_cast<T>(0);
 
@@ -0,0 +1,1368 @@
+#pragma once
+#include "Math/Math.hpp"
+#include <bit>
+#include <cmath>
+
+// Implementations of the SIMD wrappers declared in Math.hpp. They live in the header so that every operation inlines
+// into the caller and vectors stay in registers across chained operations.
+
+namespace Edvar::Math::SIMD {
+namespace _z__Private {
+EDVAR_CPP_CORE_FORCE_INLINE float FloatMask(const bool condition) {
+    return std::bit_cast<float>(condition ? ~uint32_t(0) : uint32_t(0));
+}
+EDVAR_CPP_CORE_FORCE_INLINE double DoubleMask(const bool condition) {
+    return std::bit_cast<double>(condition ? ~uint64_t(0) : uint64_t(0));
+}
+
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+EDVAR_CPP_CORE_FORCE_INLINE __m128 ToNative(const Float_4& value) { return _mm_load_ps(value.XYZW); }
+EDVAR_CPP_CORE_FORCE_INLINE __m128d ToNative(const Double_2& value) { return _mm_load_pd(value.XY); }
+EDVAR_CPP_CORE_FORCE_INLINE __m128i ToNative(const Int32_4& value) {
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(value.XYZW));
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 FromNative(const __m128 value) {
+    Float_4 result;
+    _mm_store_ps(result.XYZW, value);
+    return result;
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 FromNative(const __m128d value) {
+    Double_2 result;
+    _mm_store_pd(result.XY, value);
+    return result;
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 FromNative(const __m128i value) {
+    Int32_4 result;
+    _mm_store_si128(reinterpret_cast<__m128i*>(result.XYZW), value);
+    return result;
+}
+
+// Sums the four products into every lane, SSE2 only and shorter latency than _mm_dp_ps.
+EDVAR_CPP_CORE_FORCE_INLINE __m128 DotSplat(const __m128 a, const __m128 b) {
+    const __m128 product = _mm_mul_ps(a, b);
+    const __m128 pairs = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm_add_ps(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+EDVAR_CPP_CORE_FORCE_INLINE __m128d DotSplat(const __m128d a, const __m128d b) {
+    const __m128d product = _mm_mul_pd(a, b);
+    return _mm_add_pd(product, _mm_shuffle_pd(product, product, 0x1));
+}
+
+template <int32_t Mask> EDVAR_CPP_CORE_FORCE_INLINE __m128i ShuffleInt32(const __m128i a, const __m128i b) {
+    return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), Mask));
+}
+EDVAR_CPP_CORE_FORCE_INLINE __m128i SelectInt32(const __m128i mask, const __m128i ifSet, const __m128i ifClear) {
+    return _mm_or_si128(_mm_and_si128(mask, ifSet), _mm_andnot_si128(mask, ifClear));
+}
+#endif
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+EDVAR_CPP_CORE_FORCE_INLINE __m256d ToNative(const Double_4& value) { return _mm256_load_pd(value.XYZW); }
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 FromNative(const __m256d value) {
+    Double_4 result;
+    _mm256_store_pd(result.XYZW, value);
+    return result;
+}
+EDVAR_CPP_CORE_FORCE_INLINE __m256 ToNative(const Float_8& value) { return _mm256_load_ps(value.Low.XYZW); }
+EDVAR_CPP_CORE_FORCE_INLINE Float_8 FromNative(const __m256 value) {
+    Float_8 result;
+    _mm256_store_ps(result.Low.XYZW, value);
+    return result;
+}
+EDVAR_CPP_CORE_FORCE_INLINE __m256d DotSplat(const __m256d a, const __m256d b) {
+    const __m256d product = _mm256_mul_pd(a, b);
+    const __m256d pairs = _mm256_add_pd(product, _mm256_permute_pd(product, 0x5));
+    return _mm256_add_pd(pairs, _mm256_permute2f128_pd(pairs, pairs, 0x01));
+}
+#endif
+#if EDVAR_CPP_CORE_MATH_ARM64_SIMD
+EDVAR_CPP_CORE_FORCE_INLINE float32x4_t ToNative(const Float_4& value) { return vld1q_f32(value.XYZW); }
+EDVAR_CPP_CORE_FORCE_INLINE float64x2_t ToNative(const Double_2& value) { return vld1q_f64(value.XY); }
+EDVAR_CPP_CORE_FORCE_INLINE int32x4_t ToNative(const Int32_4& value) { return vld1q_s32(value.XYZW); }
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 FromNative(const float32x4_t value) {
+    Float_4 result;
+    vst1q_f32(result.XYZW, value);
+    return result;
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 FromNative(const float64x2_t value) {
+    Double_2 result;
+    vst1q_f64(result.XY, value);
+    return result;
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 FromNative(const int32x4_t value) {
+    Int32_4 result;
+    vst1q_s32(result.XYZW, value);
+    return result;
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 FromNative(const uint32x4_t mask) {
+    return FromNative(vreinterpretq_f32_u32(mask));
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 FromNative(const uint64x2_t mask) {
+    return FromNative(vreinterpretq_f64_u64(mask));
+}
+EDVAR_CPP_CORE_FORCE_INLINE uint32x4_t ToBits(const Float_4& value) { return vreinterpretq_u32_f32(ToNative(value)); }
+EDVAR_CPP_CORE_FORCE_INLINE uint64x2_t ToBits(const Double_2& value) {
+    return vreinterpretq_u64_f64(ToNative(value));
+}
+#endif
+
+// {a[A], a[B], b[C], b[D]}, the general form of the named shuffles for code that needs other lane patterns.
+template <int32_t A, int32_t B, int32_t C, int32_t D>
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Shuffle(const Float_4& a, const Float_4& b) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return FromNative(_mm_shuffle_ps(ToNative(a), ToNative(b), _MM_SHUFFLE(D, C, B, A)));
+#else
+    return Float_4{a.XYZW[A], a.XYZW[B], b.XYZW[C], b.XYZW[D]};
+#endif
+}
+template <int32_t A, int32_t B, int32_t C, int32_t D>
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Shuffle(const Double_4& a, const Double_4& b) {
+    return Double_4{a.XYZW[A], a.XYZW[B], b.XYZW[C], b.XYZW[D]};
+}
+
+// 2x2 matrices held row-major in the four lanes of a vector, the building blocks of the 4x4 block inverse.
+template <typename VectorT> EDVAR_CPP_CORE_FORCE_INLINE VectorT Matrix2x2Multiply(const VectorT& a, const VectorT& b) {
+    return a * Shuffle<0, 3, 0, 3>(b, b) + Shuffle<1, 0, 3, 2>(a, a) * Shuffle<2, 1, 2, 1>(b, b);
+}
+// adj(a) * b
+template <typename VectorT>
+EDVAR_CPP_CORE_FORCE_INLINE VectorT Matrix2x2AdjugateMultiply(const VectorT& a, const VectorT& b) {
+    return Shuffle<3, 3, 0, 0>(a, a) * b - Shuffle<1, 1, 2, 2>(a, a) * Shuffle<2, 3, 0, 1>(b, b);
+}
+// a * adj(b)
+template <typename VectorT>
+EDVAR_CPP_CORE_FORCE_INLINE VectorT Matrix2x2MultiplyAdjugate(const VectorT& a, const VectorT& b) {
+    return a * Shuffle<3, 0, 3, 0>(b, b) - Shuffle<1, 0, 3, 2>(a, a) * Shuffle<2, 1, 2, 1>(b, b);
+}
+
+// Splits the matrix into the 2x2 blocks [A B; C D]. With # the adjugate:
+//   |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+//   M^-1 = 1/|M| [(|D|A - B(D#C))#  (|B|C - D(A#B)#)#; (|C|B - A(D#C)#)#  (|A|D - C(A#B))#]
+template <typename VectorT, typename ScalarT> struct Matrix4x4Blocks {
+    VectorT A, B, C, D;
+    VectorT Determinants; // |A| |B| |C| |D|
+    VectorT AdjAB, AdjDC; // A#B and D#C
+    ScalarT Determinant;
+
+    explicit Matrix4x4Blocks(const VectorT matrix[4])
+        : A(Shuffle<0, 1, 0, 1>(matrix[0], matrix[1])), B(Shuffle<2, 3, 2, 3>(matrix[0], matrix[1])),
+          C(Shuffle<0, 1, 0, 1>(matrix[2], matrix[3])), D(Shuffle<2, 3, 2, 3>(matrix[2], matrix[3])) {
+        Determinants = Shuffle<0, 2, 0, 2>(matrix[0], matrix[2]) * Shuffle<1, 3, 1, 3>(matrix[1], matrix[3]) -
+                       Shuffle<1, 3, 1, 3>(matrix[0], matrix[2]) * Shuffle<0, 2, 0, 2>(matrix[1], matrix[3]);
+        AdjAB = Matrix2x2AdjugateMultiply(A, B);
+        AdjDC = Matrix2x2AdjugateMultiply(D, C);
+        const VectorT trace = AdjAB * Shuffle<0, 2, 1, 3>(AdjDC, AdjDC);
+        Determinant = Determinants.X * Determinants.W + Determinants.Y * Determinants.Z -
+                      ((trace.X + trace.Y) + (trace.Z + trace.W));
+    }
+
+    void Invert(VectorT result[4]) const {
+        const VectorT detA = Determinants.ShuffleXXXX(), detB = Determinants.ShuffleYYYY();
+        const VectorT detC = Determinants.ShuffleZZZZ(), detD = Determinants.ShuffleWWWW();
+        const ScalarT inverse = static_cast<ScalarT>(1) / Determinant;
+        // The signs turn each adjugate block into its cofactor form, the shuffles below transpose it back.
+        const VectorT scale{inverse, -inverse, -inverse, inverse};
+        const VectorT x = (detD * A - Matrix2x2Multiply(B, AdjDC)) * scale;
+        const VectorT y = (detB * C - Matrix2x2MultiplyAdjugate(D, AdjAB)) * scale;
+        const VectorT z = (detC * B - Matrix2x2MultiplyAdjugate(A, AdjDC)) * scale;
+        const VectorT w = (detA * D - Matrix2x2Multiply(C, AdjAB)) * scale;
+        result[0] = Shuffle<3, 1, 3, 1>(x, y);
+        result[1] = Shuffle<2, 0, 2, 0>(x, y);
+        result[2] = Shuffle<3, 1, 3, 1>(z, w);
+        result[3] = Shuffle<2, 0, 2, 0>(z, w);
+    }
+};
+} // namespace _z__Private
+
+// Name and the lanes it picks, the first two from this and the last two from other.
+#define EDVAR_CPP_CORE_MATH_4COMPONENT_SHUFFLE_LIST(Op)                                                                \
+    Op(XYZW, 0, 1, 2, 3) Op(YWZX, 1, 3, 2, 0) Op(ZWXY, 2, 3, 0, 1) Op(WXYZ, 3, 0, 1, 2) Op(XXYY, 0, 0, 1, 1)           \
+        Op(ZZWW, 2, 2, 3, 3) Op(XZXZ, 0, 2, 0, 2) Op(YZYZ, 1, 2, 1, 2) Op(WYWY, 3, 1, 3, 1) Op(XYXY, 0, 1, 0, 1)       \
+            Op(ZWZW, 2, 3, 2, 3) Op(XXXX, 0, 0, 0, 0) Op(YYYY, 1, 1, 1, 1) Op(ZZZZ, 2, 2, 2, 2) Op(WWWW, 3, 3, 3, 3)
+
+// ========================================================================
+// Float_4
+// ========================================================================
+
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::LoadAligned(const float* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_load_ps(ptr));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vld1q_f32(ptr));
+#else
+    return Float_4{ptr[0], ptr[1], ptr[2], ptr[3]};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::LoadUnaligned(const float* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_loadu_ps(ptr));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vld1q_f32(ptr));
+#else
+    return Float_4{ptr[0], ptr[1], ptr[2], ptr[3]};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Float_4::StoreAligned(float* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    _mm_store_ps(ptr, _z__Private::ToNative(*this));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    vst1q_f32(ptr, _z__Private::ToNative(*this));
+#else
+    ptr[0] = X;
+    ptr[1] = Y;
+    ptr[2] = Z;
+    ptr[3] = W;
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Float_4::StoreUnaligned(float* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    _mm_storeu_ps(ptr, _z__Private::ToNative(*this));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    vst1q_f32(ptr, _z__Private::ToNative(*this));
+#else
+    ptr[0] = X;
+    ptr[1] = Y;
+    ptr[2] = Z;
+    ptr[3] = W;
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::operator+(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_add_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vaddq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{X + other.X, Y + other.Y, Z + other.Z, W + other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::operator-(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_sub_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vsubq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{X - other.X, Y - other.Y, Z - other.Z, W - other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::operator*(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_mul_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vmulq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{X * other.X, Y * other.Y, Z * other.Z, W * other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::operator/(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_div_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vdivq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{X / other.X, Y / other.Y, Z / other.Z, W / other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::operator|(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_or_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vorrq_u32(_z__Private::ToBits(*this), _z__Private::ToBits(other)));
+#else
+    return Float_4{std::bit_cast<float>(std::bit_cast<uint32_t>(X) | std::bit_cast<uint32_t>(other.X)),
+                   std::bit_cast<float>(std::bit_cast<uint32_t>(Y) | std::bit_cast<uint32_t>(other.Y)),
+                   std::bit_cast<float>(std::bit_cast<uint32_t>(Z) | std::bit_cast<uint32_t>(other.Z)),
+                   std::bit_cast<float>(std::bit_cast<uint32_t>(W) | std::bit_cast<uint32_t>(other.W))};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::operator&(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_and_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vandq_u32(_z__Private::ToBits(*this), _z__Private::ToBits(other)));
+#else
+    return Float_4{std::bit_cast<float>(std::bit_cast<uint32_t>(X) & std::bit_cast<uint32_t>(other.X)),
+                   std::bit_cast<float>(std::bit_cast<uint32_t>(Y) & std::bit_cast<uint32_t>(other.Y)),
+                   std::bit_cast<float>(std::bit_cast<uint32_t>(Z) & std::bit_cast<uint32_t>(other.Z)),
+                   std::bit_cast<float>(std::bit_cast<uint32_t>(W) & std::bit_cast<uint32_t>(other.W))};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::operator^(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_xor_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(veorq_u32(_z__Private::ToBits(*this), _z__Private::ToBits(other)));
+#else
+    return Float_4{std::bit_cast<float>(std::bit_cast<uint32_t>(X) ^ std::bit_cast<uint32_t>(other.X)),
+                   std::bit_cast<float>(std::bit_cast<uint32_t>(Y) ^ std::bit_cast<uint32_t>(other.Y)),
+                   std::bit_cast<float>(std::bit_cast<uint32_t>(Z) ^ std::bit_cast<uint32_t>(other.Z)),
+                   std::bit_cast<float>(std::bit_cast<uint32_t>(W) ^ std::bit_cast<uint32_t>(other.W))};
+#endif
+}
+
+// Comparisons set every bit of a lane where they hold, so the result can be used as a mask with & and |.
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::LessThan(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_cmplt_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vcltq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{_z__Private::FloatMask(X < other.X), _z__Private::FloatMask(Y < other.Y),
+                   _z__Private::FloatMask(Z < other.Z), _z__Private::FloatMask(W < other.W)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::GreaterThan(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_cmpgt_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vcgtq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{_z__Private::FloatMask(X > other.X), _z__Private::FloatMask(Y > other.Y),
+                   _z__Private::FloatMask(Z > other.Z), _z__Private::FloatMask(W > other.W)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::Equal(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_cmpeq_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vceqq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{_z__Private::FloatMask(X == other.X), _z__Private::FloatMask(Y == other.Y),
+                   _z__Private::FloatMask(Z == other.Z), _z__Private::FloatMask(W == other.W)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE int32_t Float_4::GetMaskBits() const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _mm_movemask_ps(_z__Private::ToNative(*this));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    const int32x4_t positions = {0, 1, 2, 3};
+    return static_cast<int32_t>(vaddvq_u32(vshlq_u32(vshrq_n_u32(_z__Private::ToBits(*this), 31), positions)));
+#else
+    return static_cast<int32_t>((std::bit_cast<uint32_t>(X) >> 31) | ((std::bit_cast<uint32_t>(Y) >> 31) << 1) |
+                                ((std::bit_cast<uint32_t>(Z) >> 31) << 2) | ((std::bit_cast<uint32_t>(W) >> 31) << 3));
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::HorizontalAdd(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    const __m128 a = _z__Private::ToNative(*this);
+    const __m128 b = _z__Private::ToNative(other);
+    return _z__Private::FromNative(
+        _mm_add_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vpaddq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{(X + Y), (Z + W), (other.X + other.Y), (other.Z + other.W)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::Min(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_min_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vminq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{(X < other.X) ? X : other.X, (Y < other.Y) ? Y : other.Y, (Z < other.Z) ? Z : other.Z,
+                   (W < other.W) ? W : other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::Max(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_max_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vmaxq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{(X > other.X) ? X : other.X, (Y > other.Y) ? Y : other.Y, (Z > other.Z) ? Z : other.Z,
+                   (W > other.W) ? W : other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::Dot(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_z__Private::DotSplat(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(
+        vdupq_n_f32(vaddvq_f32(vmulq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)))));
+#else
+    const float dotProduct = (X * other.X) + (Y * other.Y) + (Z * other.Z) + (W * other.W);
+    return Float_4{dotProduct, dotProduct, dotProduct, dotProduct};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::DotLane0(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    const __m128 dot = _z__Private::DotSplat(_z__Private::ToNative(*this), _z__Private::ToNative(other));
+    return _z__Private::FromNative(_mm_move_ss(_mm_setzero_ps(), dot));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    const float dot = vaddvq_f32(vmulq_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+    return _z__Private::FromNative(vsetq_lane_f32(dot, vdupq_n_f32(0.0f), 0));
+#else
+    const float dot = (X * other.X) + (Y * other.Y) + (Z * other.Z) + (W * other.W);
+    return Float_4{dot, 0.0f, 0.0f, 0.0f};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::SquareRoot() const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_sqrt_ps(_z__Private::ToNative(*this)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vsqrtq_f32(_z__Private::ToNative(*this)));
+#else
+    return Float_4{std::sqrt(X), std::sqrt(Y), std::sqrt(Z), std::sqrt(W)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::Normalize() const { return (*this) / Length(); }
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::Length() const { return LengthSquared().SquareRoot(); }
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::LengthSquared() const { return Dot(*this); }
+
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::UnpackInterleaveLowHalf(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_unpacklo_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vzip1q_f32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Float_4{X, other.X, Y, other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::MoveOtherLowerToHigher(const Float_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_movelh_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(
+        vcombine_f32(vget_low_f32(_z__Private::ToNative(*this)), vget_low_f32(_z__Private::ToNative(other))));
+#else
+    return Float_4{X, Y, other.X, other.Y};
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void Float_4::MatrixTranspose4x4(const Float_4 matrix[4], Float_4 result[4]) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    __m128 row0 = _z__Private::ToNative(matrix[0]);
+    __m128 row1 = _z__Private::ToNative(matrix[1]);
+    __m128 row2 = _z__Private::ToNative(matrix[2]);
+    __m128 row3 = _z__Private::ToNative(matrix[3]);
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+    result[0] = _z__Private::FromNative(row0);
+    result[1] = _z__Private::FromNative(row1);
+    result[2] = _z__Private::FromNative(row2);
+    result[3] = _z__Private::FromNative(row3);
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    const float32x4x2_t low = vtrnq_f32(_z__Private::ToNative(matrix[0]), _z__Private::ToNative(matrix[1]));
+    const float32x4x2_t high = vtrnq_f32(_z__Private::ToNative(matrix[2]), _z__Private::ToNative(matrix[3]));
+    result[0] = _z__Private::FromNative(vcombine_f32(vget_low_f32(low.val[0]), vget_low_f32(high.val[0])));
+    result[1] = _z__Private::FromNative(vcombine_f32(vget_low_f32(low.val[1]), vget_low_f32(high.val[1])));
+    result[2] = _z__Private::FromNative(vcombine_f32(vget_high_f32(low.val[0]), vget_high_f32(high.val[0])));
+    result[3] = _z__Private::FromNative(vcombine_f32(vget_high_f32(low.val[1]), vget_high_f32(high.val[1])));
+#else
+    const Float_4 source[4] = {matrix[0], matrix[1], matrix[2], matrix[3]};
+    for (int i = 0; i < 4; ++i) {
+        result[i] = Float_4{source[0].XYZW[i], source[1].XYZW[i], source[2].XYZW[i], source[3].XYZW[i]};
+    }
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void Float_4::MatrixMultiplyRows4x4(const Float_4 matrix[4], const Float_4 other[4],
+                                                                Float_4 result[4]) {
+    // Each result row is a sum of broadcasts times rows of other, which needs no horizontal adds. The rows of other are
+    // read up front so result may alias either input.
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    const __m128 row0 = _z__Private::ToNative(other[0]);
+    const __m128 row1 = _z__Private::ToNative(other[1]);
+    const __m128 row2 = _z__Private::ToNative(other[2]);
+    const __m128 row3 = _z__Private::ToNative(other[3]);
+    for (int i = 0; i < 4; ++i) {
+        const __m128 row = _z__Private::ToNative(matrix[i]);
+        __m128 sum = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), row3));
+        result[i] = _z__Private::FromNative(sum);
+    }
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    const float32x4_t row0 = _z__Private::ToNative(other[0]);
+    const float32x4_t row1 = _z__Private::ToNative(other[1]);
+    const float32x4_t row2 = _z__Private::ToNative(other[2]);
+    const float32x4_t row3 = _z__Private::ToNative(other[3]);
+    for (int i = 0; i < 4; ++i) {
+        const float32x4_t row = _z__Private::ToNative(matrix[i]);
+        float32x4_t sum = vmulq_laneq_f32(row0, row, 0);
+        sum = vaddq_f32(sum, vmulq_laneq_f32(row1, row, 1));
+        sum = vaddq_f32(sum, vmulq_laneq_f32(row2, row, 2));
+        sum = vaddq_f32(sum, vmulq_laneq_f32(row3, row, 3));
+        result[i] = _z__Private::FromNative(sum);
+    }
+#else
+    const Float_4 rows[4] = {other[0], other[1], other[2], other[3]};
+    for (int i = 0; i < 4; ++i) {
+        const Float_4 row = matrix[i];
+        result[i] = row.ShuffleXXXX() * rows[0] + row.ShuffleYYYY() * rows[1] + row.ShuffleZZZZ() * rows[2] +
+                    row.ShuffleWWWW() * rows[3];
+    }
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void Float_4::MatrixMultiply4x4(const Float_4 matrix[4],
+                                                            const Float_4 otherTransposedMatrix[4], Float_4 result[4]) {
+    Float_4 other[4];
+    MatrixTranspose4x4(otherTransposedMatrix, other);
+    MatrixMultiplyRows4x4(matrix, other, result);
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE float Float_4::MatrixInverse4x4(const Float_4 matrix[4], Float_4 result[4]) {
+    const _z__Private::Matrix4x4Blocks<Float_4, float> blocks(matrix);
+    if (Abs(blocks.Determinant) >= static_cast<float>(VERY_SMALL_NUMBER)) {
+        blocks.Invert(result);
+    }
+    return blocks.Determinant;
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE float Float_4::MatrixDeterminant4x4(const Float_4 matrix[4]) {
+    return _z__Private::Matrix4x4Blocks<Float_4, float>(matrix).Determinant;
+}
+
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+#    define EDVAR_CPP_CORE_MATH_FLOAT_4_SHUFFLE(Name, A, B, C, D)                                                      \
+        EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::Shuffle##Name(const Float_4& other) const {                      \
+            return _z__Private::FromNative(                                                                            \
+                _mm_shuffle_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other), _MM_SHUFFLE(D, C, B, A)));  \
+        }
+#else
+#    define EDVAR_CPP_CORE_MATH_FLOAT_4_SHUFFLE(Name, A, B, C, D)                                                      \
+        EDVAR_CPP_CORE_FORCE_INLINE Float_4 Float_4::Shuffle##Name(const Float_4& other) const {                      \
+            return Float_4{XYZW[A], XYZW[B], other.XYZW[C], other.XYZW[D]};                                            \
+        }
+#endif
+EDVAR_CPP_CORE_MATH_4COMPONENT_SHUFFLE_LIST(EDVAR_CPP_CORE_MATH_FLOAT_4_SHUFFLE)
+#undef EDVAR_CPP_CORE_MATH_FLOAT_4_SHUFFLE
+
+// ========================================================================
+// Double_2
+// ========================================================================
+
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::LoadAligned(const double* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_load_pd(ptr));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vld1q_f64(ptr));
+#else
+    return Double_2{ptr[0], ptr[1]};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::LoadUnaligned(const double* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_loadu_pd(ptr));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vld1q_f64(ptr));
+#else
+    return Double_2{ptr[0], ptr[1]};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Double_2::StoreAligned(double* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    _mm_store_pd(ptr, _z__Private::ToNative(*this));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    vst1q_f64(ptr, _z__Private::ToNative(*this));
+#else
+    ptr[0] = X;
+    ptr[1] = Y;
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Double_2::StoreUnaligned(double* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    _mm_storeu_pd(ptr, _z__Private::ToNative(*this));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    vst1q_f64(ptr, _z__Private::ToNative(*this));
+#else
+    ptr[0] = X;
+    ptr[1] = Y;
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::operator+(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_add_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vaddq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{X + other.X, Y + other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::operator-(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_sub_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vsubq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{X - other.X, Y - other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::operator*(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_mul_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vmulq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{X * other.X, Y * other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::operator/(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_div_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vdivq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{X / other.X, Y / other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::operator|(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_or_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vorrq_u64(_z__Private::ToBits(*this), _z__Private::ToBits(other)));
+#else
+    return Double_2{std::bit_cast<double>(std::bit_cast<uint64_t>(X) | std::bit_cast<uint64_t>(other.X)),
+                    std::bit_cast<double>(std::bit_cast<uint64_t>(Y) | std::bit_cast<uint64_t>(other.Y))};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::operator&(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_and_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vandq_u64(_z__Private::ToBits(*this), _z__Private::ToBits(other)));
+#else
+    return Double_2{std::bit_cast<double>(std::bit_cast<uint64_t>(X) & std::bit_cast<uint64_t>(other.X)),
+                    std::bit_cast<double>(std::bit_cast<uint64_t>(Y) & std::bit_cast<uint64_t>(other.Y))};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::operator^(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_xor_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(veorq_u64(_z__Private::ToBits(*this), _z__Private::ToBits(other)));
+#else
+    return Double_2{std::bit_cast<double>(std::bit_cast<uint64_t>(X) ^ std::bit_cast<uint64_t>(other.X)),
+                    std::bit_cast<double>(std::bit_cast<uint64_t>(Y) ^ std::bit_cast<uint64_t>(other.Y))};
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::LessThan(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_cmplt_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vcltq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{_z__Private::DoubleMask(X < other.X), _z__Private::DoubleMask(Y < other.Y)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::GreaterThan(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_cmpgt_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vcgtq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{_z__Private::DoubleMask(X > other.X), _z__Private::DoubleMask(Y > other.Y)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::Equal(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_cmpeq_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vceqq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{_z__Private::DoubleMask(X == other.X), _z__Private::DoubleMask(Y == other.Y)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE int32_t Double_2::GetMaskBits() const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _mm_movemask_pd(_z__Private::ToNative(*this));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    const uint64x2_t signs = vshrq_n_u64(_z__Private::ToBits(*this), 63);
+    return static_cast<int32_t>(vgetq_lane_u64(signs, 0) | (vgetq_lane_u64(signs, 1) << 1));
+#else
+    return static_cast<int32_t>((std::bit_cast<uint64_t>(X) >> 63) | ((std::bit_cast<uint64_t>(Y) >> 63) << 1));
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::HorizontalAdd(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    const __m128d a = _z__Private::ToNative(*this);
+    const __m128d b = _z__Private::ToNative(other);
+    return _z__Private::FromNative(_mm_add_pd(_mm_unpacklo_pd(a, b), _mm_unpackhi_pd(a, b)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vpaddq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{(X + Y), (other.X + other.Y)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::Min(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_min_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vminq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{(X < other.X) ? X : other.X, (Y < other.Y) ? Y : other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::Max(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_max_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vmaxq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{(X > other.X) ? X : other.X, (Y > other.Y) ? Y : other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::Dot(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_z__Private::DotSplat(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(
+        vdupq_n_f64(vaddvq_f64(vmulq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)))));
+#else
+    const double dotProduct = (X * other.X) + (Y * other.Y);
+    return Double_2{dotProduct, dotProduct};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::DotLane0(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    const __m128d dot = _z__Private::DotSplat(_z__Private::ToNative(*this), _z__Private::ToNative(other));
+    return _z__Private::FromNative(_mm_move_sd(_mm_setzero_pd(), dot));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    const double dot = vaddvq_f64(vmulq_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+    return _z__Private::FromNative(vsetq_lane_f64(dot, vdupq_n_f64(0.0), 0));
+#else
+    const double dot = (X * other.X) + (Y * other.Y);
+    return Double_2{dot, 0.0};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::SquareRoot() const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_sqrt_pd(_z__Private::ToNative(*this)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vsqrtq_f64(_z__Private::ToNative(*this)));
+#else
+    return Double_2{std::sqrt(X), std::sqrt(Y)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::Normalize() const { return (*this) / Length(); }
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::Length() const { return LengthSquared().SquareRoot(); }
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::LengthSquared() const { return Dot(*this); }
+
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::UnpackInterleaveLowHalf(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_unpacklo_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vzip1q_f64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Double_2{X, other.X};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::MoveOtherLowerToHigher(const Double_2& other) const {
+    // With a single lane per half this is the same as interleaving the low halves.
+    return UnpackInterleaveLowHalf(other);
+}
+
+// _mm_shuffle_pd picks lane 0 from this with bit 0 of the immediate and lane 1 from other with bit 1.
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::ShuffleXY(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_shuffle_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other), 0x2));
+#else
+    return Double_2{X, other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::ShuffleXX(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_shuffle_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other), 0x0));
+#else
+    return Double_2{X, other.X};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::ShuffleYY(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_shuffle_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other), 0x3));
+#else
+    return Double_2{Y, other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_2 Double_2::ShuffleYX(const Double_2& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_shuffle_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other), 0x1));
+#else
+    return Double_2{Y, other.X};
+#endif
+}
+
+// ========================================================================
+// Double_4, AVX or two Double_2 halves
+// ========================================================================
+
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::LoadAligned(const double* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(_mm256_load_pd(ptr));
+#else
+    Double_4 result;
+    result.XY_Double2 = Double_2::LoadAligned(ptr);
+    result.ZW_Double2 = Double_2::LoadAligned(ptr + 2);
+    return result;
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::LoadUnaligned(const double* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(_mm256_loadu_pd(ptr));
+#else
+    Double_4 result;
+    result.XY_Double2 = Double_2::LoadUnaligned(ptr);
+    result.ZW_Double2 = Double_2::LoadUnaligned(ptr + 2);
+    return result;
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Double_4::StoreAligned(double* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    _mm256_store_pd(ptr, _z__Private::ToNative(*this));
+#else
+    XY_Double2.StoreAligned(ptr);
+    ZW_Double2.StoreAligned(ptr + 2);
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Double_4::StoreUnaligned(double* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    _mm256_storeu_pd(ptr, _z__Private::ToNative(*this));
+#else
+    XY_Double2.StoreUnaligned(ptr);
+    ZW_Double2.StoreUnaligned(ptr + 2);
+#endif
+}
+
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+#    define EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(Declaration, Intrinsic, Half)                                          \
+        EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::Declaration(const Double_4& other) const {                     \
+            return _z__Private::FromNative(Intrinsic(_z__Private::ToNative(*this), _z__Private::ToNative(other)));     \
+        }
+#else
+#    define EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(Declaration, Intrinsic, Half)                                          \
+        EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::Declaration(const Double_4& other) const {                     \
+            Double_4 result;                                                                                           \
+            result.XY_Double2 = XY_Double2.Half(other.XY_Double2);                                                     \
+            result.ZW_Double2 = ZW_Double2.Half(other.ZW_Double2);                                                     \
+            return result;                                                                                             \
+        }
+#endif
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(operator+, _mm256_add_pd, operator+)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(operator-, _mm256_sub_pd, operator-)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(operator*, _mm256_mul_pd, operator*)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(operator/, _mm256_div_pd, operator/)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(operator|, _mm256_or_pd, operator|)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(operator&, _mm256_and_pd, operator&)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(operator^, _mm256_xor_pd, operator^)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(HorizontalAdd, _mm256_hadd_pd, HorizontalAdd)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(Min, _mm256_min_pd, Min)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(Max, _mm256_max_pd, Max)
+EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY(UnpackInterleaveLowHalf, _mm256_unpacklo_pd, UnpackInterleaveLowHalf)
+#undef EDVAR_CPP_CORE_MATH_DOUBLE_4_BINARY
+
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::LessThan(const Double_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(
+        _mm256_cmp_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other), _CMP_LT_OQ));
+#else
+    Double_4 result;
+    result.XY_Double2 = XY_Double2.LessThan(other.XY_Double2);
+    result.ZW_Double2 = ZW_Double2.LessThan(other.ZW_Double2);
+    return result;
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::GreaterThan(const Double_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(
+        _mm256_cmp_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other), _CMP_GT_OQ));
+#else
+    Double_4 result;
+    result.XY_Double2 = XY_Double2.GreaterThan(other.XY_Double2);
+    result.ZW_Double2 = ZW_Double2.GreaterThan(other.ZW_Double2);
+    return result;
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::Equal(const Double_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(
+        _mm256_cmp_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other), _CMP_EQ_OQ));
+#else
+    Double_4 result;
+    result.XY_Double2 = XY_Double2.Equal(other.XY_Double2);
+    result.ZW_Double2 = ZW_Double2.Equal(other.ZW_Double2);
+    return result;
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE int32_t Double_4::GetMaskBits() const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _mm256_movemask_pd(_z__Private::ToNative(*this));
+#else
+    return XY_Double2.GetMaskBits() | (ZW_Double2.GetMaskBits() << 2);
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::Dot(const Double_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(_z__Private::DotSplat(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    const double dot = (X * other.X) + (Y * other.Y) + (Z * other.Z) + (W * other.W);
+    return Double_4{dot, dot, dot, dot};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::DotLane0(const Double_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(_mm256_blend_pd(
+        _mm256_setzero_pd(), _z__Private::DotSplat(_z__Private::ToNative(*this), _z__Private::ToNative(other)), 0x1));
+#else
+    const double dot = (X * other.X) + (Y * other.Y) + (Z * other.Z) + (W * other.W);
+    return Double_4{dot, 0.0, 0.0, 0.0};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::SquareRoot() const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(_mm256_sqrt_pd(_z__Private::ToNative(*this)));
+#else
+    Double_4 result;
+    result.XY_Double2 = XY_Double2.SquareRoot();
+    result.ZW_Double2 = ZW_Double2.SquareRoot();
+    return result;
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::Normalize() const { return (*this) / Length(); }
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::Length() const { return LengthSquared().SquareRoot(); }
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::LengthSquared() const { return Dot(*this); }
+
+EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::MoveOtherLowerToHigher(const Double_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(
+        _mm256_permute2f128_pd(_z__Private::ToNative(*this), _z__Private::ToNative(other), 0x20));
+#else
+    Double_4 result;
+    result.XY_Double2 = XY_Double2;
+    result.ZW_Double2 = other.XY_Double2;
+    return result;
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void Double_4::MatrixTranspose4x4(const Double_4 matrix[4], Double_4 result[4]) {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    const __m256d row0 = _z__Private::ToNative(matrix[0]);
+    const __m256d row1 = _z__Private::ToNative(matrix[1]);
+    const __m256d row2 = _z__Private::ToNative(matrix[2]);
+    const __m256d row3 = _z__Private::ToNative(matrix[3]);
+    const __m256d low01 = _mm256_unpacklo_pd(row0, row1);
+    const __m256d high01 = _mm256_unpackhi_pd(row0, row1);
+    const __m256d low23 = _mm256_unpacklo_pd(row2, row3);
+    const __m256d high23 = _mm256_unpackhi_pd(row2, row3);
+    result[0] = _z__Private::FromNative(_mm256_permute2f128_pd(low01, low23, 0x20));
+    result[1] = _z__Private::FromNative(_mm256_permute2f128_pd(high01, high23, 0x20));
+    result[2] = _z__Private::FromNative(_mm256_permute2f128_pd(low01, low23, 0x31));
+    result[3] = _z__Private::FromNative(_mm256_permute2f128_pd(high01, high23, 0x31));
+#else
+    const Double_4 source[4] = {matrix[0], matrix[1], matrix[2], matrix[3]};
+    for (int i = 0; i < 4; ++i) {
+        result[i] = Double_4{source[0].XYZW[i], source[1].XYZW[i], source[2].XYZW[i], source[3].XYZW[i]};
+    }
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void Double_4::MatrixMultiplyRows4x4(const Double_4 matrix[4], const Double_4 other[4],
+                                                                 Double_4 result[4]) {
+    // Same scheme as Float_4, accumulate broadcasts times rows of other.
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    const __m256d row0 = _z__Private::ToNative(other[0]);
+    const __m256d row1 = _z__Private::ToNative(other[1]);
+    const __m256d row2 = _z__Private::ToNative(other[2]);
+    const __m256d row3 = _z__Private::ToNative(other[3]);
+    for (int i = 0; i < 4; ++i) {
+        const double* row = matrix[i].XYZW;
+        __m256d sum = _mm256_mul_pd(_mm256_broadcast_sd(row + 0), row0);
+        sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(row + 1), row1));
+        sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(row + 2), row2));
+        sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_broadcast_sd(row + 3), row3));
+        result[i] = _z__Private::FromNative(sum);
+    }
+#else
+    // On the Double_2 halves, which are still vector registers on SSE2 and NEON.
+    const Double_4 rows[4] = {other[0], other[1], other[2], other[3]};
+    for (int i = 0; i < 4; ++i) {
+        const Double_4 row = matrix[i];
+        Double_4 sum;
+        sum.XY_Double2 = Double_2{row.X, row.X} * rows[0].XY_Double2;
+        sum.ZW_Double2 = Double_2{row.X, row.X} * rows[0].ZW_Double2;
+        for (int k = 1; k < 4; ++k) {
+            const Double_2 factor{row.XYZW[k], row.XYZW[k]};
+            sum.XY_Double2 = sum.XY_Double2 + factor * rows[k].XY_Double2;
+            sum.ZW_Double2 = sum.ZW_Double2 + factor * rows[k].ZW_Double2;
+        }
+        result[i] = sum;
+    }
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void Double_4::MatrixMultiply4x4(const Double_4 matrix[4],
+                                                             const Double_4 otherTransposedMatrix[4],
+                                                             Double_4 result[4]) {
+    Double_4 other[4];
+    MatrixTranspose4x4(otherTransposedMatrix, other);
+    MatrixMultiplyRows4x4(matrix, other, result);
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE double Double_4::MatrixInverse4x4(const Double_4 matrix[4], Double_4 result[4]) {
+    const _z__Private::Matrix4x4Blocks<Double_4, double> blocks(matrix);
+    if (Abs(blocks.Determinant) >= VERY_SMALL_NUMBER) {
+        blocks.Invert(result);
+    }
+    return blocks.Determinant;
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE double Double_4::MatrixDeterminant4x4(const Double_4 matrix[4]) {
+    return _z__Private::Matrix4x4Blocks<Double_4, double>(matrix).Determinant;
+}
+
+#define EDVAR_CPP_CORE_MATH_DOUBLE_4_SHUFFLE(Name, A, B, C, D)                                                         \
+    EDVAR_CPP_CORE_FORCE_INLINE Double_4 Double_4::Shuffle##Name(const Double_4& other) const {                       \
+        return Double_4{XYZW[A], XYZW[B], other.XYZW[C], other.XYZW[D]};                                               \
+    }
+EDVAR_CPP_CORE_MATH_4COMPONENT_SHUFFLE_LIST(EDVAR_CPP_CORE_MATH_DOUBLE_4_SHUFFLE)
+#undef EDVAR_CPP_CORE_MATH_DOUBLE_4_SHUFFLE
+
+// ========================================================================
+// Float_8, AVX or two Float_4 halves
+// ========================================================================
+
+EDVAR_CPP_CORE_FORCE_INLINE Float_8 Float_8::LoadAligned(const float* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(_mm256_load_ps(ptr));
+#else
+    return Float_8{Float_4::LoadAligned(ptr), Float_4::LoadAligned(ptr + 4)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_8 Float_8::LoadUnaligned(const float* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(_mm256_loadu_ps(ptr));
+#else
+    return Float_8{Float_4::LoadUnaligned(ptr), Float_4::LoadUnaligned(ptr + 4)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Float_8::StoreAligned(float* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    _mm256_store_ps(ptr, _z__Private::ToNative(*this));
+#else
+    Low.StoreAligned(ptr);
+    High.StoreAligned(ptr + 4);
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Float_8::StoreUnaligned(float* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    _mm256_storeu_ps(ptr, _z__Private::ToNative(*this));
+#else
+    Low.StoreUnaligned(ptr);
+    High.StoreUnaligned(ptr + 4);
+#endif
+}
+
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+#    define EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(Declaration, Intrinsic, Half)                                           \
+        EDVAR_CPP_CORE_FORCE_INLINE Float_8 Float_8::Declaration(const Float_8& other) const {                         \
+            return _z__Private::FromNative(Intrinsic(_z__Private::ToNative(*this), _z__Private::ToNative(other)));     \
+        }
+#else
+#    define EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(Declaration, Intrinsic, Half)                                           \
+        EDVAR_CPP_CORE_FORCE_INLINE Float_8 Float_8::Declaration(const Float_8& other) const {                         \
+            return Float_8{Low.Half(other.Low), High.Half(other.High)};                                                \
+        }
+#endif
+EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(operator+, _mm256_add_ps, operator+)
+EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(operator-, _mm256_sub_ps, operator-)
+EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(operator*, _mm256_mul_ps, operator*)
+EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(operator/, _mm256_div_ps, operator/)
+EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(operator|, _mm256_or_ps, operator|)
+EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(operator&, _mm256_and_ps, operator&)
+EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(operator^, _mm256_xor_ps, operator^)
+EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(Min, _mm256_min_ps, Min)
+EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY(Max, _mm256_max_ps, Max)
+#undef EDVAR_CPP_CORE_MATH_FLOAT_8_BINARY
+
+EDVAR_CPP_CORE_FORCE_INLINE Float_8 Float_8::LessThan(const Float_8& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(
+        _mm256_cmp_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other), _CMP_LT_OQ));
+#else
+    return Float_8{Low.LessThan(other.Low), High.LessThan(other.High)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_8 Float_8::GreaterThan(const Float_8& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(
+        _mm256_cmp_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other), _CMP_GT_OQ));
+#else
+    return Float_8{Low.GreaterThan(other.Low), High.GreaterThan(other.High)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_8 Float_8::Equal(const Float_8& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(
+        _mm256_cmp_ps(_z__Private::ToNative(*this), _z__Private::ToNative(other), _CMP_EQ_OQ));
+#else
+    return Float_8{Low.Equal(other.Low), High.Equal(other.High)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE int32_t Float_8::GetMaskBits() const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _mm256_movemask_ps(_z__Private::ToNative(*this));
+#else
+    return Low.GetMaskBits() | (High.GetMaskBits() << 4);
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Float_8 Float_8::SquareRoot() const {
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+    return _z__Private::FromNative(_mm256_sqrt_ps(_z__Private::ToNative(*this)));
+#else
+    return Float_8{Low.SquareRoot(), High.SquareRoot()};
+#endif
+}
+
+// ========================================================================
+// Int32_4
+// ========================================================================
+
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::LoadAligned(const int32_t* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_load_si128(reinterpret_cast<const __m128i*>(ptr)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vld1q_s32(ptr));
+#else
+    return Int32_4{ptr[0], ptr[1], ptr[2], ptr[3]};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::LoadUnaligned(const int32_t* ptr) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vld1q_s32(ptr));
+#else
+    return Int32_4{ptr[0], ptr[1], ptr[2], ptr[3]};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Int32_4::StoreAligned(int32_t* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    _mm_store_si128(reinterpret_cast<__m128i*>(ptr), _z__Private::ToNative(*this));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    vst1q_s32(ptr, _z__Private::ToNative(*this));
+#else
+    ptr[0] = X;
+    ptr[1] = Y;
+    ptr[2] = Z;
+    ptr[3] = W;
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE void Int32_4::StoreUnaligned(int32_t* ptr) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _z__Private::ToNative(*this));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    vst1q_s32(ptr, _z__Private::ToNative(*this));
+#else
+    ptr[0] = X;
+    ptr[1] = Y;
+    ptr[2] = Z;
+    ptr[3] = W;
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::operator+(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_add_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vaddq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{X + other.X, Y + other.Y, Z + other.Z, W + other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::operator-(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_sub_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vsubq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{X - other.X, Y - other.Y, Z - other.Z, W - other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::operator*(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SSE41
+    return _z__Private::FromNative(_mm_mullo_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vmulq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{X * other.X, Y * other.Y, Z * other.Z, W * other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::operator/(const Int32_4& other) const {
+    // No SIMD integer division on either architecture.
+    return Int32_4{X / other.X, Y / other.Y, Z / other.Z, W / other.W};
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::operator|(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_or_si128(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vorrq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{X | other.X, Y | other.Y, Z | other.Z, W | other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::operator&(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_and_si128(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vandq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{X & other.X, Y & other.Y, Z & other.Z, W & other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::operator^(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_xor_si128(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(veorq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{X ^ other.X, Y ^ other.Y, Z ^ other.Z, W ^ other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::operator<<(int32_t shift) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_sll_epi32(_z__Private::ToNative(*this), _mm_cvtsi32_si128(shift)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vshlq_s32(_z__Private::ToNative(*this), vdupq_n_s32(shift)));
+#else
+    return Int32_4{X << shift, Y << shift, Z << shift, W << shift};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::operator>>(int32_t shift) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_sra_epi32(_z__Private::ToNative(*this), _mm_cvtsi32_si128(shift)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vshlq_s32(_z__Private::ToNative(*this), vdupq_n_s32(-shift)));
+#else
+    return Int32_4{X >> shift, Y >> shift, Z >> shift, W >> shift};
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::LessThan(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_cmplt_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(
+        vreinterpretq_s32_u32(vcltq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other))));
+#else
+    return Int32_4{(X < other.X) ? -1 : 0, (Y < other.Y) ? -1 : 0, (Z < other.Z) ? -1 : 0, (W < other.W) ? -1 : 0};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::GreaterThan(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_cmpgt_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(
+        vreinterpretq_s32_u32(vcgtq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other))));
+#else
+    return Int32_4{(X > other.X) ? -1 : 0, (Y > other.Y) ? -1 : 0, (Z > other.Z) ? -1 : 0, (W > other.W) ? -1 : 0};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::Equal(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_cmpeq_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(
+        vreinterpretq_s32_u32(vceqq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other))));
+#else
+    return Int32_4{(X == other.X) ? -1 : 0, (Y == other.Y) ? -1 : 0, (Z == other.Z) ? -1 : 0, (W == other.W) ? -1 : 0};
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::HorizontalAdd(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    const __m128i a = _z__Private::ToNative(*this);
+    const __m128i b = _z__Private::ToNative(other);
+    return _z__Private::FromNative(_mm_add_epi32(_z__Private::ShuffleInt32<_MM_SHUFFLE(2, 0, 2, 0)>(a, b),
+                                                 _z__Private::ShuffleInt32<_MM_SHUFFLE(3, 1, 3, 1)>(a, b)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vpaddq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{(X + Y), (Z + W), (other.X + other.Y), (other.Z + other.W)};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::Min(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SSE41
+    return _z__Private::FromNative(_mm_min_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_X86_SIMD
+    const __m128i a = _z__Private::ToNative(*this);
+    const __m128i b = _z__Private::ToNative(other);
+    return _z__Private::FromNative(_z__Private::SelectInt32(_mm_cmpgt_epi32(a, b), b, a));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vminq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{(X < other.X) ? X : other.X, (Y < other.Y) ? Y : other.Y, (Z < other.Z) ? Z : other.Z,
+                   (W < other.W) ? W : other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::Max(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SSE41
+    return _z__Private::FromNative(_mm_max_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_X86_SIMD
+    const __m128i a = _z__Private::ToNative(*this);
+    const __m128i b = _z__Private::ToNative(other);
+    return _z__Private::FromNative(_z__Private::SelectInt32(_mm_cmpgt_epi32(a, b), a, b));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vmaxq_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{(X > other.X) ? X : other.X, (Y > other.Y) ? Y : other.Y, (Z > other.Z) ? Z : other.Z,
+                   (W > other.W) ? W : other.W};
+#endif
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::UnpackInterleaveLowHalf(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_unpacklo_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vzip1q_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{X, other.X, Y, other.Y};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::UnpackInterleaveHighHalf(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_unpackhi_epi32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(vzip2q_s32(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#else
+    return Int32_4{Z, other.Z, W, other.W};
+#endif
+}
+EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::MoveOtherLowerToHigher(const Int32_4& other) const {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return _z__Private::FromNative(_mm_unpacklo_epi64(_z__Private::ToNative(*this), _z__Private::ToNative(other)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return _z__Private::FromNative(
+        vcombine_s32(vget_low_s32(_z__Private::ToNative(*this)), vget_low_s32(_z__Private::ToNative(other))));
+#else
+    return Int32_4{X, Y, other.X, other.Y};
+#endif
+}
+
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+#    define EDVAR_CPP_CORE_MATH_INT32_4_SHUFFLE(Name, A, B, C, D)                                                      \
+        EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::Shuffle##Name(const Int32_4& other) const {                      \
+            return _z__Private::FromNative(_z__Private::ShuffleInt32<_MM_SHUFFLE(D, C, B, A)>(                         \
+                _z__Private::ToNative(*this), _z__Private::ToNative(other)));                                          \
+        }                                                                                                              \
+        EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::Shuffle##Name() const {                                           \
+            return _z__Private::FromNative(_mm_shuffle_epi32(_z__Private::ToNative(*this), _MM_SHUFFLE(D, C, B, A)));  \
+        }
+#else
+#    define EDVAR_CPP_CORE_MATH_INT32_4_SHUFFLE(Name, A, B, C, D)                                                      \
+        EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::Shuffle##Name(const Int32_4& other) const {                      \
+            return Int32_4{XYZW[A], XYZW[B], other.XYZW[C], other.XYZW[D]};                                            \
+        }                                                                                                              \
+        EDVAR_CPP_CORE_FORCE_INLINE Int32_4 Int32_4::Shuffle##Name() const {                                           \
+            return Int32_4{XYZW[A], XYZW[B], XYZW[C], XYZW[D]};                                                        \
+        }
+#endif
+EDVAR_CPP_CORE_MATH_4COMPONENT_SHUFFLE_LIST(EDVAR_CPP_CORE_MATH_INT32_4_SHUFFLE)
+#undef EDVAR_CPP_CORE_MATH_INT32_4_SHUFFLE
+
+#undef EDVAR_CPP_CORE_MATH_4COMPONENT_SHUFFLE_LIST
+} // namespace Edvar::Math::SIMD
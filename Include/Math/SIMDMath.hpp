@@ -0,0 +1,99 @@
+#pragma once
+#include "Math.hpp"
+#include "Wide.hpp"
+
+// Lane-wise transcendental functions for the register types of the wide types, the SIMD counterparts of Math::Sin,
+// Math::Exp and so on. They are polynomial approximations evaluated with the SIMD wrappers only, every lane runs the
+// same instructions with no branches or table lookups.
+//
+// Error bounds are in ULP of the result against the correctly rounded value, measured over the stated range. The Fast
+// variants trade accuracy for fewer instructions and give absolute or relative error bounds instead. They do not
+// handle NaN, infinite or out of range inputs.
+
+namespace Edvar::Math::SIMD {
+/**
+ * @brief Sine of every lane, in radians.
+ *
+ * At most 2.5 ULP for float lanes with |x| < 8192 and double lanes with |x| < 2^30, precision degrades beyond these
+ * ranges. Infinite and NaN inputs give NaN.
+ */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT Sin(const LaneT& x);
+/** @brief Cosine of every lane, in radians. Same bounds as Sin. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT Cos(const LaneT& x);
+/** @brief Sine and cosine of every lane with one shared range reduction. Same bounds as Sin. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+void SinCos(const LaneT& x, LaneT& outSin, LaneT& outCos);
+
+/**
+ * @brief e raised to every lane.
+ *
+ * At most 1.5 ULP for float lanes and 2 ULP for double lanes. Results past the largest finite value are +infinity,
+ * results below the smallest normal value flush to zero. NaN inputs give NaN.
+ */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT Exp(const LaneT& x);
+/**
+ * @brief Natural logarithm of every lane.
+ *
+ * At most 1 ULP for float and double lanes, subnormal inputs included. Zero gives -infinity, negative inputs and NaN
+ * give NaN, +infinity gives +infinity.
+ */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT NaturalLogarithm(const LaneT& x);
+/**
+ * @brief base raised to exponent, lane by lane, computed as Exp(exponent * NaturalLogarithm(|base|)).
+ *
+ * The error grows with the magnitude of the result's exponent, at most 1.3 * (1 + |exponent * log2(base)|) ULP, so
+ * integral powers are not exact. Special values follow std::pow: negative bases need an integral exponent and take
+ * their sign from its parity, zero exponents give 1.
+ */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT Power(const LaneT& base, const LaneT& exponent);
+/**
+ * @brief Angle of (x, y) in [-pi, pi], lane by lane.
+ *
+ * At most 3.5 ULP for float lanes and 2 ULP for double lanes. Signed zeros and infinities follow std::atan2.
+ */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT ATan2(const LaneT& y, const LaneT& x);
+
+/** @brief Sine with an absolute error below 4e-6 for |x| < 64, growing with |x| beyond. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT FastSin(const LaneT& x);
+/** @brief Cosine with an absolute error below 4e-6 for |x| < 64, growing with |x| beyond. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT FastCos(const LaneT& x);
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+void FastSinCos(const LaneT& x, LaneT& outSin, LaneT& outCos);
+/** @brief Arc cosine in [0, pi] of lanes in [-1, 1], with an absolute error below 5e-7. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT FastACos(const LaneT& x);
+/** @brief e raised to every lane with a relative error below 1e-5. Inputs are clamped to the finite range. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT FastExp(const LaneT& x);
+/**
+ * @brief Natural logarithm with an absolute error below 1e-7 plus the rounding of the result, for positive normal
+ * inputs.
+ */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT FastNaturalLogarithm(const LaneT& x);
+/** @brief FastExp(exponent * FastNaturalLogarithm(base)), for positive normal bases. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT FastPower(const LaneT& base, const LaneT& exponent);
+} // namespace Edvar::Math::SIMD
@@ -0,0 +1,545 @@
+#pragma once
+#include "Math/Math.hpp"
+#include "SIMDMath.hpp"
+#include <bit>
+#include <limits>
+
+namespace Edvar::Math::SIMD {
+namespace _z__Private {
+// ============================================================================
+// Bit manipulation
+// ============================================================================
+
+// Shifts the raw bits of every lane, a float lane as one 32-bit integer and a double lane as one 64-bit integer. This
+// is all the integer work the functions below need, exponents are moved in and out of the exponent field as small
+// integers stored in the low mantissa bits of a float.
+template <int32_t Count, typename ScalarT>
+EDVAR_CPP_CORE_FORCE_INLINE ScalarT ShiftLeftScalarBits(const ScalarT value) {
+    using BitsType = std::conditional_t<sizeof(ScalarT) == 4, uint32_t, uint64_t>;
+    return std::bit_cast<ScalarT>(static_cast<BitsType>(std::bit_cast<BitsType>(value) << Count));
+}
+template <int32_t Count, typename ScalarT>
+EDVAR_CPP_CORE_FORCE_INLINE ScalarT ShiftRightScalarBits(const ScalarT value) {
+    using BitsType = std::conditional_t<sizeof(ScalarT) == 4, uint32_t, uint64_t>;
+    return std::bit_cast<ScalarT>(static_cast<BitsType>(std::bit_cast<BitsType>(value) >> Count));
+}
+
+template <int32_t Count> EDVAR_CPP_CORE_FORCE_INLINE Float_4 ShiftLeftBits(const Float_4& value) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return FromNative(_mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(ToNative(value)), Count)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return FromNative(vshlq_n_u32(ToBits(value), Count));
+#else
+    return Float_4{ShiftLeftScalarBits<Count>(value.X), ShiftLeftScalarBits<Count>(value.Y),
+                   ShiftLeftScalarBits<Count>(value.Z), ShiftLeftScalarBits<Count>(value.W)};
+#endif
+}
+template <int32_t Count> EDVAR_CPP_CORE_FORCE_INLINE Float_4 ShiftRightBits(const Float_4& value) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return FromNative(_mm_castsi128_ps(_mm_srli_epi32(_mm_castps_si128(ToNative(value)), Count)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return FromNative(vshrq_n_u32(ToBits(value), Count));
+#else
+    return Float_4{ShiftRightScalarBits<Count>(value.X), ShiftRightScalarBits<Count>(value.Y),
+                   ShiftRightScalarBits<Count>(value.Z), ShiftRightScalarBits<Count>(value.W)};
+#endif
+}
+template <int32_t Count> EDVAR_CPP_CORE_FORCE_INLINE Double_2 ShiftLeftBits(const Double_2& value) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return FromNative(_mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(ToNative(value)), Count)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return FromNative(vshlq_n_u64(ToBits(value), Count));
+#else
+    return Double_2{ShiftLeftScalarBits<Count>(value.X), ShiftLeftScalarBits<Count>(value.Y)};
+#endif
+}
+template <int32_t Count> EDVAR_CPP_CORE_FORCE_INLINE Double_2 ShiftRightBits(const Double_2& value) {
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+    return FromNative(_mm_castsi128_pd(_mm_srli_epi64(_mm_castpd_si128(ToNative(value)), Count)));
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+    return FromNative(vshrq_n_u64(ToBits(value), Count));
+#else
+    return Double_2{ShiftRightScalarBits<Count>(value.X), ShiftRightScalarBits<Count>(value.Y)};
+#endif
+}
+// Without AVX2 there are no 256-bit integer shifts, the halves go through the 128-bit versions.
+template <int32_t Count> EDVAR_CPP_CORE_FORCE_INLINE Float_8 ShiftLeftBits(const Float_8& value) {
+#if EDVAR_CPP_CORE_MATH_X86_AVX2
+    return FromNative(_mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(ToNative(value)), Count)));
+#else
+    return Float_8{ShiftLeftBits<Count>(value.Low), ShiftLeftBits<Count>(value.High)};
+#endif
+}
+template <int32_t Count> EDVAR_CPP_CORE_FORCE_INLINE Float_8 ShiftRightBits(const Float_8& value) {
+#if EDVAR_CPP_CORE_MATH_X86_AVX2
+    return FromNative(_mm256_castsi256_ps(_mm256_srli_epi32(_mm256_castps_si256(ToNative(value)), Count)));
+#else
+    return Float_8{ShiftRightBits<Count>(value.Low), ShiftRightBits<Count>(value.High)};
+#endif
+}
+template <int32_t Count> EDVAR_CPP_CORE_FORCE_INLINE Double_4 ShiftLeftBits(const Double_4& value) {
+#if EDVAR_CPP_CORE_MATH_X86_AVX2
+    return FromNative(_mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(ToNative(value)), Count)));
+#else
+    Double_4 result;
+    result.XY_Double2 = ShiftLeftBits<Count>(value.XY_Double2);
+    result.ZW_Double2 = ShiftLeftBits<Count>(value.ZW_Double2);
+    return result;
+#endif
+}
+template <int32_t Count> EDVAR_CPP_CORE_FORCE_INLINE Double_4 ShiftRightBits(const Double_4& value) {
+#if EDVAR_CPP_CORE_MATH_X86_AVX2
+    return FromNative(_mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(ToNative(value)), Count)));
+#else
+    Double_4 result;
+    result.XY_Double2 = ShiftRightBits<Count>(value.XY_Double2);
+    result.ZW_Double2 = ShiftRightBits<Count>(value.ZW_Double2);
+    return result;
+#endif
+}
+
+// ============================================================================
+// Shared helpers
+// ============================================================================
+
+template <typename ScalarT> struct FloatFormat;
+template <> struct FloatFormat<float> {
+    using BitsType = uint32_t;
+    static constexpr int32_t TotalBits = 32;
+    static constexpr int32_t MantissaBits = 23;
+    static constexpr float ExponentBias = 127.0f;
+    static constexpr BitsType SignMask = 0x80000000u;
+    static constexpr BitsType MantissaMask = 0x007FFFFFu;
+    /** 2^MantissaBits, the smallest float whose last mantissa bit is worth 1. */
+    static constexpr float IntegerMagic = 8388608.0f;
+    /** 1.5 * 2^MantissaBits, adding and subtracting it rounds to the nearest integer for |x| < 2^22. */
+    static constexpr float RoundMagic = 12582912.0f;
+};
+template <> struct FloatFormat<double> {
+    using BitsType = uint64_t;
+    static constexpr int32_t TotalBits = 64;
+    static constexpr int32_t MantissaBits = 52;
+    static constexpr double ExponentBias = 1023.0;
+    static constexpr BitsType SignMask = 0x8000000000000000ull;
+    static constexpr BitsType MantissaMask = 0x000FFFFFFFFFFFFFull;
+    static constexpr double IntegerMagic = 4503599627370496.0;
+    static constexpr double RoundMagic = 6755399441055744.0;
+};
+template <typename LaneT> using LaneFormat = FloatFormat<LaneScalarType<LaneT>>;
+template <typename LaneT> static constexpr bool IsFloatLane = std::is_same_v<LaneScalarType<LaneT>, float>;
+
+template <typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE LaneT SplatBits(const typename LaneFormat<LaneT>::BitsType bits) {
+    return Splat<LaneT>(std::bit_cast<LaneScalarType<LaneT>>(bits));
+}
+
+// Horner evaluation, coefficients from the highest power down
+template <typename LaneT, typename... CoefficientsT>
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Polynomial(const LaneT& x, const LaneScalarType<LaneT> highest,
+                                             const CoefficientsT... rest) {
+    LaneT result = Splat<LaneT>(highest);
+    ((result = result * x + Splat<LaneT>(static_cast<LaneScalarType<LaneT>>(rest))), ...);
+    return result;
+}
+
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT Abs(const LaneT& x) {
+    return x & SplatBits<LaneT>(~LaneFormat<LaneT>::SignMask);
+}
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT SignBit(const LaneT& x) {
+    return x & SplatBits<LaneT>(LaneFormat<LaneT>::SignMask);
+}
+/** Full lane mask from a value where only the sign bit may be set. */
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT SignBitToMask(const LaneT& signBits) {
+    return (Splat<LaneT>(1) | signBits).LessThan(Splat<LaneT>(0));
+}
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT IsNaN(const LaneT& x) {
+    return x.Equal(x) ^ SplatBits<LaneT>(~typename LaneFormat<LaneT>::BitsType(0));
+}
+
+/**
+ * value * 2^n for integral n where 2^n is normal or twice the largest normal power. The top exponent is reached as
+ * 2^(n-1) * 2 so that Exp can cover the whole finite range.
+ */
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT ScaleByPowerOfTwo(const LaneT& value, const LaneT& n) {
+    using Format = LaneFormat<LaneT>;
+    const LaneT one = Splat<LaneT>(1);
+    const LaneT step = n.GreaterThan(Splat<LaneT>(0)) & one;
+    const LaneT biased = n - step + Splat<LaneT>(Format::IntegerMagic + Format::ExponentBias);
+    return value * ShiftLeftBits<Format::MantissaBits>(biased) * (one + step);
+}
+
+/** Splits positive normal x into a mantissa in [0.5, 1) and an integral exponent, as std::frexp. */
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT SplitExponent(const LaneT& x, LaneT& exponent) {
+    using Format = LaneFormat<LaneT>;
+    const LaneT field =
+        ShiftRightBits<Format::MantissaBits>(x) | Splat<LaneT>(Format::IntegerMagic);
+    exponent = field - Splat<LaneT>(Format::IntegerMagic + Format::ExponentBias - 1);
+    return (x & SplatBits<LaneT>(Format::MantissaMask)) | Splat<LaneT>(0.5);
+}
+
+/**
+ * Reduces x by the nearest multiple j of pi/2 to reduced in [-pi/4, pi/4]. Returns j + RoundMagic, whose lowest
+ * mantissa bits hold the quadrant j mod 4 in two's complement.
+ */
+template <typename LaneT, bool Precise>
+EDVAR_CPP_CORE_FORCE_INLINE LaneT ReduceQuadrant(const LaneT& x, LaneT& reduced) {
+    using Format = LaneFormat<LaneT>;
+    const LaneT magic = Splat<LaneT>(Format::RoundMagic);
+    const LaneT quadrant = x * Splat<LaneT>(static_cast<LaneScalarType<LaneT>>(2.0 / PI)) + magic;
+    const LaneT j = quadrant - magic;
+    // pi/2 split into parts of few enough bits that j times each part is exact
+    if constexpr (IsFloatLane<LaneT>) {
+        reduced = x - j * Splat<LaneT>(1.5703125f) - j * Splat<LaneT>(4.837512969970703125e-4f);
+        if constexpr (Precise) {
+            reduced = reduced - j * Splat<LaneT>(7.549533620476722717e-8f) -
+                      j * Splat<LaneT>(2.563344068257089573e-12f);
+        }
+    } else {
+        reduced = x - j * Splat<LaneT>(1.57079625129699707031) - j * Splat<LaneT>(7.54978941586159635335e-8);
+        if constexpr (Precise) {
+            reduced = reduced - j * Splat<LaneT>(5.39030252995776476554e-15) -
+                      j * Splat<LaneT>(3.28200354287350047444e-22);
+        }
+    }
+    return quadrant;
+}
+
+/** sin(x) from the quadrant and reduced argument of ReduceQuadrant and both polynomials. */
+template <typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE LaneT ApplyQuadrant(const LaneT& quadrant, const LaneT& sinReduced,
+                                                const LaneT& cosReduced) {
+    constexpr int32_t totalBits = LaneFormat<LaneT>::TotalBits;
+    // Odd quadrants swap sine and cosine, quadrants 2 and 3 negate
+    const LaneT swap = SignBitToMask(ShiftLeftBits<totalBits - 1>(quadrant));
+    const LaneT negate = SignBit(ShiftLeftBits<totalBits - 2>(quadrant));
+    return Select(swap, cosReduced, sinReduced) ^ negate;
+}
+
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT SinReduced(const LaneT& r, const LaneT& z) {
+    if constexpr (IsFloatLane<LaneT>) {
+        return r + r * z * Polynomial(z, -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f);
+    } else {
+        return r + r * z *
+                       Polynomial(z, 1.58962301576546568060e-10, -2.50507477628578072866e-8,
+                                  2.75573136213857245213e-6, -1.98412698295895385996e-4, 8.33333333332211858878e-3,
+                                  -1.66666666666666307295e-1);
+    }
+}
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT CosReduced(const LaneT& z) {
+    const LaneT oneMinusHalfZ = Splat<LaneT>(1) - z * Splat<LaneT>(0.5);
+    if constexpr (IsFloatLane<LaneT>) {
+        return oneMinusHalfZ + z * z * Polynomial(z, 2.443315711809948e-5f, -1.388731625493765e-3f,
+                                                  4.166664568298827e-2f);
+    } else {
+        return oneMinusHalfZ + z * z *
+                                   Polynomial(z, -1.13585365213876817300e-11, 2.08757008419747316778e-9,
+                                              -2.75573141792967388112e-7, 2.48015872888517045348e-5,
+                                              -1.38888888888730564116e-3, 4.16666666666665929218e-2);
+    }
+}
+// Near-minimax fits with one term less than the precise polynomials
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT FastSinReduced(const LaneT& r, const LaneT& z) {
+    return r + r * z * Polynomial(z, 0.008163281925718994, -0.16663390377531226);
+}
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT FastCosReduced(const LaneT& z) {
+    return Splat<LaneT>(1) - z * Splat<LaneT>(0.5) +
+           z * z * Polynomial(z, -0.0013652450187937987, 0.041661278624566894);
+}
+
+/** atan(t) for t in [0, 1]. */
+template <typename LaneT> EDVAR_CPP_CORE_FORCE_INLINE LaneT ATanUnit(const LaneT& t) {
+    const LaneT one = Splat<LaneT>(1);
+    if constexpr (IsFloatLane<LaneT>) {
+        // Above tan(pi/8) use atan(t) = pi/4 + atan((t - 1) / (t + 1))
+        const LaneT upper = t.GreaterThan(Splat<LaneT>(0.4142135623730950f));
+        const LaneT x = Select(upper, (t - one) / (t + one), t);
+        const LaneT z = x * x;
+        const LaneT offset = Splat<LaneT>(static_cast<float>(PI / 4.0)) & upper;
+        return offset + x + x * z * Polynomial(z, 8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f,
+                                               -3.33329491539e-1f);
+    } else {
+        const LaneT upper = t.GreaterThan(Splat<LaneT>(0.66));
+        const LaneT x = Select(upper, (t - one) / (t + one), t);
+        const LaneT z = x * x;
+        const LaneT p = Polynomial(z, -8.750608600031904122785e-1, -1.615753718733365076637e1,
+                                   -7.500855792314704667340e1, -1.228866684490136173410e2, -6.485021904942025371773e1);
+        const LaneT q = Polynomial(z, 1.0, 2.485846490142306297962e1, 1.650270098316988542046e2,
+                                   4.328810604912902668951e2, 4.853903996359136964868e2, 1.945506571482613964425e2);
+        // pi/4 in two parts, the low one added after the small terms
+        const LaneT offset = Splat<LaneT>(PI / 4.0) & upper;
+        const LaneT offsetLow = Splat<LaneT>(3.061616997868382943065e-17) & upper;
+        return offset + (x + (x * (z * p / q) + offsetLow));
+    }
+}
+} // namespace _z__Private
+
+// ============================================================================
+// Trigonometric functions
+// ============================================================================
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Sin(const LaneT& x) {
+    LaneT r;
+    const LaneT quadrant = _z__Private::ReduceQuadrant<LaneT, true>(x, r);
+    const LaneT z = r * r;
+    return _z__Private::ApplyQuadrant(quadrant, _z__Private::SinReduced(r, z), _z__Private::CosReduced(z));
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Cos(const LaneT& x) {
+    LaneT r;
+    const LaneT quadrant = _z__Private::ReduceQuadrant<LaneT, true>(x, r);
+    const LaneT z = r * r;
+    // cos(x) = sin(x + pi/2), one quadrant further
+    return _z__Private::ApplyQuadrant(quadrant + Splat<LaneT>(1), _z__Private::SinReduced(r, z),
+                                      _z__Private::CosReduced(z));
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE void SinCos(const LaneT& x, LaneT& outSin, LaneT& outCos) {
+    LaneT r;
+    const LaneT quadrant = _z__Private::ReduceQuadrant<LaneT, true>(x, r);
+    const LaneT z = r * r;
+    const LaneT sinReduced = _z__Private::SinReduced(r, z);
+    const LaneT cosReduced = _z__Private::CosReduced(z);
+    outSin = _z__Private::ApplyQuadrant(quadrant, sinReduced, cosReduced);
+    outCos = _z__Private::ApplyQuadrant(quadrant + Splat<LaneT>(1), sinReduced, cosReduced);
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT ATan2(const LaneT& y, const LaneT& x) {
+    using ScalarType = LaneScalarType<LaneT>;
+    const LaneT zero = Splat<LaneT>(0);
+    const LaneT ax = _z__Private::Abs(x);
+    const LaneT ay = _z__Private::Abs(y);
+    const LaneT smaller = ax.Min(ay);
+    const LaneT larger = ax.Max(ay);
+    // Equal magnitudes give exactly 1 so that two infinities land on the diagonal, two zeros give 0
+    LaneT t = Select(ax.Equal(ay), Splat<LaneT>(1), smaller / larger);
+    t = Select(larger.Equal(zero), zero, t);
+    LaneT angle = _z__Private::ATanUnit(t);
+
+    // Constants split into the value nearest to the true one and the remainder
+    const LaneT halfPi = Splat<LaneT>(static_cast<ScalarType>(PI / 2.0));
+    const LaneT halfPiLow = Splat<LaneT>(_z__Private::IsFloatLane<LaneT> ? -4.37113883e-8 : 6.123233995736766e-17);
+    const LaneT pi = Splat<LaneT>(static_cast<ScalarType>(PI));
+    const LaneT piLow = Splat<LaneT>(_z__Private::IsFloatLane<LaneT> ? -8.74227766e-8 : 1.2246467991473532e-16);
+    angle = Select(ay.GreaterThan(ax), (halfPi - angle) + halfPiLow, angle);
+    // The sign bit rather than a comparison, so that -0 counts as negative as in std::atan2
+    angle = Select(_z__Private::SignBitToMask(_z__Private::SignBit(x)), (pi - angle) + piLow, angle);
+    angle = angle | _z__Private::SignBit(y);
+    return Select(_z__Private::IsNaN(x) | _z__Private::IsNaN(y), x + y, angle);
+}
+
+// ============================================================================
+// Exponential and logarithm
+// ============================================================================
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Exp(const LaneT& x) {
+    using Format = _z__Private::LaneFormat<LaneT>;
+    using ScalarType = LaneScalarType<LaneT>;
+    // ln of the largest finite value and of the smallest normal value
+    const LaneT maxInput = Splat<LaneT>(_z__Private::IsFloatLane<LaneT> ? 88.72283905206835 : 709.782712893383973096);
+    const LaneT minInput = Splat<LaneT>(_z__Private::IsFloatLane<LaneT> ? -87.33654475055310 : -708.39641853226410622);
+    const LaneT clamped = x.Min(maxInput).Max(minInput);
+
+    // x = n ln2 + r with |r| <= ln2 / 2
+    const LaneT magic = Splat<LaneT>(Format::RoundMagic);
+    const LaneT n = (clamped * Splat<LaneT>(static_cast<ScalarType>(1.44269504088896340736)) + magic) - magic;
+    LaneT result;
+    if constexpr (_z__Private::IsFloatLane<LaneT>) {
+        const LaneT r = clamped - n * Splat<LaneT>(0.693359375f) - n * Splat<LaneT>(-2.12194440e-4f);
+        const LaneT p = _z__Private::Polynomial(r, 1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f,
+                                                4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f);
+        result = p * r * r + r + Splat<LaneT>(1);
+    } else {
+        const LaneT r = clamped - n * Splat<LaneT>(6.93145751953125e-1) - n * Splat<LaneT>(1.42860682030941723212e-6);
+        const LaneT rr = r * r;
+        const LaneT p = r * _z__Private::Polynomial(rr, 1.26177193074810590878e-4, 3.02994407707441961300e-2,
+                                                    9.99999999999999999910e-1);
+        const LaneT q = _z__Private::Polynomial(rr, 3.00198505138664455042e-6, 2.52448340349684104192e-3,
+                                                2.27265548208155028766e-1, 2.00000000000000000009e0);
+        result = Splat<LaneT>(1) + Splat<LaneT>(2) * (p / (q - p));
+    }
+    result = _z__Private::ScaleByPowerOfTwo(result, n);
+
+    result = Select(x.GreaterThan(maxInput), Splat<LaneT>(std::numeric_limits<ScalarType>::infinity()), result);
+    result = Select(x.LessThan(minInput), Splat<LaneT>(0), result);
+    return Select(_z__Private::IsNaN(x), x, result);
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT NaturalLogarithm(const LaneT& x) {
+    using Format = _z__Private::LaneFormat<LaneT>;
+    using ScalarType = LaneScalarType<LaneT>;
+    const LaneT zero = Splat<LaneT>(0);
+    const LaneT one = Splat<LaneT>(1);
+
+    // Subnormals are scaled into the normal range first
+    const LaneT subnormal = x.LessThan(Splat<LaneT>(std::numeric_limits<ScalarType>::min()));
+    const LaneT scaled = Select(subnormal, x * Splat<LaneT>(Format::IntegerMagic), x);
+    LaneT exponent;
+    LaneT m = _z__Private::SplitExponent(scaled, exponent);
+    exponent = exponent - (Splat<LaneT>(static_cast<ScalarType>(Format::MantissaBits)) & subnormal);
+
+    // Mantissa moved to [sqrt(0.5), sqrt(2)), f = m - 1
+    const LaneT low = m.LessThan(Splat<LaneT>(static_cast<ScalarType>(0.707106781186547524)));
+    exponent = exponent - (one & low);
+    const LaneT f = m + (m & low) - one;
+    const LaneT z = f * f;
+
+    LaneT result;
+    if constexpr (_z__Private::IsFloatLane<LaneT>) {
+        LaneT y = f * z *
+                  _z__Private::Polynomial(f, 7.0376836292e-2f, -1.1514610310e-1f, 1.1676998740e-1f,
+                                          -1.2420140846e-1f, 1.4249322787e-1f, -1.6668057665e-1f, 2.0000714765e-1f,
+                                          -2.4999993993e-1f, 3.3333331174e-1f);
+        y = y + exponent * Splat<LaneT>(-2.12194440e-4f) - z * Splat<LaneT>(0.5f);
+        result = f + y + exponent * Splat<LaneT>(0.693359375f);
+    } else {
+        const LaneT p = _z__Private::Polynomial(f, 1.01875663804580931796e-4, 4.97494994976747001425e-1,
+                                                4.70579119878881725854e0, 1.44989225341610930846e1,
+                                                1.79368678507819816313e1, 7.70838733755885391666e0);
+        const LaneT q = _z__Private::Polynomial(f, 1.0, 1.12873587189167450590e1, 4.52279145837532221105e1,
+                                                8.29875266912776603211e1, 7.11544750618563894466e1,
+                                                2.31251620126765340583e1);
+        LaneT y = f * (z * p / q);
+        y = y - exponent * Splat<LaneT>(2.121944400546905827679e-4) - z * Splat<LaneT>(0.5);
+        result = f + y + exponent * Splat<LaneT>(0.693359375);
+    }
+
+    const LaneT infinity = Splat<LaneT>(std::numeric_limits<ScalarType>::infinity());
+    result = Select(x.Equal(infinity), infinity, result);
+    result = Select(x.Equal(zero), zero - infinity, result);
+    result = Select(x.LessThan(zero), Splat<LaneT>(std::numeric_limits<ScalarType>::quiet_NaN()), result);
+    return Select(_z__Private::IsNaN(x), x, result);
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Power(const LaneT& base, const LaneT& exponent) {
+    using Format = _z__Private::LaneFormat<LaneT>;
+    using ScalarType = LaneScalarType<LaneT>;
+    const LaneT one = Splat<LaneT>(1);
+    const LaneT infinity = Splat<LaneT>(std::numeric_limits<ScalarType>::infinity());
+    const LaneT absBase = _z__Private::Abs(base);
+    LaneT result = Exp(exponent * NaturalLogarithm(absBase));
+
+    // Integral and odd tests on the exponent. Below 2^MantissaBits adding that power moves the units digit to the last
+    // mantissa bit, up to 2^(MantissaBits + 1) the last bit already is the units digit and beyond that every value is
+    // an even integer.
+    const LaneT integerMagic = Splat<LaneT>(Format::IntegerMagic);
+    const LaneT magnitude = _z__Private::Abs(exponent);
+    const LaneT small = magnitude.LessThan(integerMagic);
+    const LaneT shifted = Select(small, magnitude + integerMagic, magnitude);
+    const LaneT integral = Select(small, (shifted - integerMagic).Equal(magnitude), magnitude.Equal(magnitude));
+    const LaneT lastBit = _z__Private::SignBitToMask(_z__Private::ShiftLeftBits<Format::TotalBits - 1>(shifted));
+    const LaneT odd = integral & lastBit & magnitude.LessThan(integerMagic + integerMagic);
+
+    const LaneT negativeBase = _z__Private::SignBitToMask(_z__Private::SignBit(base));
+    result = result ^ (_z__Private::SplatBits<LaneT>(Format::SignMask) & odd & negativeBase);
+    // Finite negative bases with a fractional exponent have no real result, -infinity follows the sign rules above
+    const LaneT finiteNegative = base.LessThan(Splat<LaneT>(0)) & absBase.LessThan(infinity);
+    result = Select(integral, result,
+                    Select(finiteNegative, Splat<LaneT>(std::numeric_limits<ScalarType>::quiet_NaN()), result));
+    const LaneT exactOne =
+        exponent.Equal(Splat<LaneT>(0)) | base.Equal(one) | (absBase.Equal(one) & magnitude.Equal(infinity));
+    return Select(exactOne, one, result);
+}
+
+// ============================================================================
+// Fast approximations
+// ============================================================================
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT FastSin(const LaneT& x) {
+    LaneT r;
+    const LaneT quadrant = _z__Private::ReduceQuadrant<LaneT, false>(x, r);
+    const LaneT z = r * r;
+    return _z__Private::ApplyQuadrant(quadrant, _z__Private::FastSinReduced(r, z), _z__Private::FastCosReduced(z));
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT FastCos(const LaneT& x) {
+    LaneT r;
+    const LaneT quadrant = _z__Private::ReduceQuadrant<LaneT, false>(x, r);
+    const LaneT z = r * r;
+    return _z__Private::ApplyQuadrant(quadrant + Splat<LaneT>(1), _z__Private::FastSinReduced(r, z),
+                                      _z__Private::FastCosReduced(z));
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE void FastSinCos(const LaneT& x, LaneT& outSin, LaneT& outCos) {
+    LaneT r;
+    const LaneT quadrant = _z__Private::ReduceQuadrant<LaneT, false>(x, r);
+    const LaneT z = r * r;
+    const LaneT sinReduced = _z__Private::FastSinReduced(r, z);
+    const LaneT cosReduced = _z__Private::FastCosReduced(z);
+    outSin = _z__Private::ApplyQuadrant(quadrant, sinReduced, cosReduced);
+    outCos = _z__Private::ApplyQuadrant(quadrant + Splat<LaneT>(1), sinReduced, cosReduced);
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT FastACos(const LaneT& x) {
+    using ScalarType = LaneScalarType<LaneT>;
+    // acos(|x|) = sqrt(1 - |x|) * P(|x|), Abramowitz and Stegun 4.4.46, and acos(-x) = pi - acos(x)
+    const LaneT a = _z__Private::Abs(x);
+    const LaneT positive =
+        (Splat<LaneT>(1) - a).SquareRoot() *
+        _z__Private::Polynomial(a, -0.0012624911, 0.0066700901, -0.0170881256, 0.0308918810, -0.0501743046,
+                                0.0889789874, -0.2145988016, 1.5707963050);
+    return Select(_z__Private::SignBitToMask(_z__Private::SignBit(x)),
+                  Splat<LaneT>(static_cast<ScalarType>(PI)) - positive, positive);
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT FastExp(const LaneT& x) {
+    using Format = _z__Private::LaneFormat<LaneT>;
+    using ScalarType = LaneScalarType<LaneT>;
+    const LaneT clamped =
+        x.Min(Splat<LaneT>(_z__Private::IsFloatLane<LaneT> ? 88.72283905206835 : 709.782712893383973096))
+            .Max(Splat<LaneT>(_z__Private::IsFloatLane<LaneT> ? -87.33654475055310 : -708.39641853226410622));
+    const LaneT magic = Splat<LaneT>(Format::RoundMagic);
+    const LaneT n = (clamped * Splat<LaneT>(static_cast<ScalarType>(1.44269504088896340736)) + magic) - magic;
+    const LaneT r = clamped - n * Splat<LaneT>(static_cast<ScalarType>(0.693147180559945309417));
+    const LaneT p = Splat<LaneT>(1) + r + r * r * _z__Private::Polynomial(r, 0.04127774709142092, 0.16753513931017616,
+                                                                          0.5000511602695489);
+    return _z__Private::ScaleByPowerOfTwo(p, n);
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT FastNaturalLogarithm(const LaneT& x) {
+    using ScalarType = LaneScalarType<LaneT>;
+    const LaneT one = Splat<LaneT>(1);
+    LaneT exponent;
+    const LaneT m = _z__Private::SplitExponent(x, exponent);
+    const LaneT low = m.LessThan(Splat<LaneT>(static_cast<ScalarType>(0.707106781186547524)));
+    exponent = exponent - (one & low);
+    const LaneT mantissa = m + (m & low);
+    // ln(m) = 2 atanh(s) with s = (m - 1) / (m + 1), |s| < 0.172
+    const LaneT s = (mantissa - one) / (mantissa + one);
+    const LaneT s2 = s * s;
+    const LaneT lnMantissa =
+        s * _z__Private::Polynomial(s2, 0.4128747230507088, 0.6665342763051926, 2.0);
+    return lnMantissa + exponent * Splat<LaneT>(static_cast<ScalarType>(0.693147180559945309417));
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT FastPower(const LaneT& base, const LaneT& exponent) {
+    return FastExp(exponent * FastNaturalLogarithm(base));
+}
+} // namespace Edvar::Math::SIMD
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
 #include "Vector.hpp"
 
 namespace Edvar::Math {
@@ -22,4 +24,139 @@ private:
     int back;
 };
 
+struct AABB;
+struct BoundingSphere;
+
+/** @brief The plane Normal . p + Distance = 0, normals point to the positive (front) side. */
+struct EDVAR_CPP_CORE_API Plane {
+    Vector3f Normal;
+    float Distance = 0.0f;
+
+    Plane() = default;
+    Plane(const Vector3f& normal, float distance);
+    static Plane FromPointNormal(const Vector3f& point, const Vector3f& normal);
+    /** The plane through a, b and c, facing the side from which they run clockwise (left-handed). */
+    static Plane FromPoints(const Vector3f& a, const Vector3f& b, const Vector3f& c);
+
+    /** Distance of point to the plane, in units of the normal's length. Negative behind the plane. */
+    float SignedDistance(const Vector3f& point) const;
+    Vector3f ClosestPoint(const Vector3f& point) const;
+    /** The same plane with a unit length normal. */
+    Plane Normalized() const;
+};
+
+/** @brief Axis aligned bounding box. The default box is empty, Min above Max, so Expand can grow it from nothing. */
+struct EDVAR_CPP_CORE_API AABB {
+    Vector3f Min;
+    Vector3f Max;
+
+    AABB();
+    AABB(const Vector3f& min, const Vector3f& max);
+    static AABB FromCenterExtents(const Vector3f& center, const Vector3f& extents);
+    static AABB FromPoints(const Vector3f* points, int32_t count);
+
+    Vector3f GetCenter() const;
+    /** Half the size along each axis. */
+    Vector3f GetExtents() const;
+    Vector3f GetSize() const;
+    float GetSurfaceArea() const;
+    float GetVolume() const;
+    /** False for the empty box. */
+    bool IsValid() const;
+
+    void Expand(const Vector3f& point);
+    void Expand(const AABB& other);
+    static AABB Union(const AABB& a, const AABB& b);
+
+    bool Contains(const Vector3f& point) const;
+    bool Contains(const AABB& other) const;
+    bool Intersects(const AABB& other) const;
+    bool Intersects(const BoundingSphere& sphere) const;
+    Vector3f ClosestPoint(const Vector3f& point) const;
+    /** Zero for points inside the box. */
+    float DistanceSquared(const Vector3f& point) const;
+
+    /** The box around this box after transform, which may rotate, scale and translate. */
+    AABB Transformed(const Matrix4x4f& transform) const;
+};
+
+struct EDVAR_CPP_CORE_API BoundingSphere {
+    Vector3f Center;
+    float Radius = 0.0f;
+
+    BoundingSphere() = default;
+    BoundingSphere(const Vector3f& center, float radius);
+    /** The sphere around box's corners. */
+    static BoundingSphere FromAABB(const AABB& box);
+    /** A sphere containing every point, at most about 5% larger than the smallest one (Ritter's method). */
+    static BoundingSphere FromPoints(const Vector3f* points, int32_t count);
+
+    bool Contains(const Vector3f& point) const;
+    bool Intersects(const BoundingSphere& other) const;
+    bool Intersects(const AABB& box) const;
+    AABB GetBounds() const;
+
+    /** The sphere after transform, its radius scaled by the largest axis scale of transform. */
+    BoundingSphere Transformed(const Matrix4x4f& transform) const;
+};
+
+/** @brief Oriented bounding box, a box of half size Extents rotated by Orientation around Center. */
+struct EDVAR_CPP_CORE_API OBB {
+    Vector3f Center;
+    Vector3f Extents;
+    Quaternion Orientation;
+
+    OBB() = default;
+    OBB(const Vector3f& center, const Vector3f& extents, const Quaternion& orientation);
+    /** box rotated by rotation around the origin, then moved by translation. */
+    static OBB FromAABB(const AABB& box, const Quaternion& rotation, const Vector3f& translation);
+
+    /** The box's local X, Y and Z axes in world space. */
+    void GetAxes(Vector3f& outX, Vector3f& outY, Vector3f& outZ) const;
+    bool Contains(const Vector3f& point) const;
+    Vector3f ClosestPoint(const Vector3f& point) const;
+    /** Separating axis test over the 15 candidate axes. */
+    bool Intersects(const OBB& other) const;
+    bool Intersects(const AABB& box) const;
+    AABB GetBounds() const;
+};
+
+/**
+ * @brief Six planes facing inward, the volume seen through a view projection matrix.
+ *
+ * Extracted from the rows of the matrix (Gribb and Hartmann), for the left-handed, [0, 1] depth projections of
+ * Matrix4x4: PerspectiveFov, PerspectiveFov_ReverseZ and the Orthographic ones, combined with a view matrix or not. The
+ * near and far planes are the z = 0 and z = w planes of clip space, so with reverse-Z NearPlane holds the far plane and
+ * FarPlane the near one. The tests are conservative, volumes close to a frustum corner may report an intersection
+ * though they are outside.
+ */
+struct EDVAR_CPP_CORE_API Frustum {
+    static constexpr int32_t LeftPlane = 0;
+    static constexpr int32_t RightPlane = 1;
+    static constexpr int32_t BottomPlane = 2;
+    static constexpr int32_t TopPlane = 3;
+    static constexpr int32_t NearPlane = 4;
+    static constexpr int32_t FarPlane = 5;
+    static constexpr int32_t PlaneCount = 6;
+
+    Plane Planes[PlaneCount];
+
+    Frustum() = default;
+    /** @param viewProjection Projection * view, points are transformed as column vectors. */
+    explicit Frustum(const Matrix4x4f& viewProjection);
+
+    bool Contains(const Vector3f& point) const;
+    bool Intersects(const AABB& box) const;
+    bool Intersects(const BoundingSphere& sphere) const;
+    bool Intersects(const OBB& box) const;
+};
+
+// Batch frustum culling. Bit i of outVisible, bit i % 64 of word i / 64 as in Containers::BitArray, is set when element
+// i intersects the frustum, the same answer as Frustum::Intersects. Eight elements are tested per step with
+// SIMD::Float_8. The (count + 63) / 64 words are overwritten, bits past count are cleared. Ranges that start at a
+// multiple of 64 may be culled on different threads.
+EDVAR_CPP_CORE_API void CullAABBs(const Frustum& frustum, const AABB* boxes, int32_t count, uint64_t* outVisible);
+EDVAR_CPP_CORE_API void CullSpheres(const Frustum& frustum, const BoundingSphere* spheres, int32_t count,
+                                    uint64_t* outVisible);
+
 } // namespace Edvar::Math
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+#include "Shapes.hpp"
+
+namespace Edvar::Math {
+// ============================================================================
+// Plane
+// ============================================================================
+
+inline Plane::Plane(const Vector3f& normal, const float distance) : Normal(normal), Distance(distance) {}
+
+inline Plane Plane::FromPointNormal(const Vector3f& point, const Vector3f& normal) {
+    return Plane(normal, -normal.Dot(point));
+}
+
+inline Plane Plane::FromPoints(const Vector3f& a, const Vector3f& b, const Vector3f& c) {
+    return FromPointNormal(a, (b - a).Cross(c - a).Normalized());
+}
+
+inline float Plane::SignedDistance(const Vector3f& point) const { return Normal.Dot(point) + Distance; }
+
+inline Vector3f Plane::ClosestPoint(const Vector3f& point) const {
+    return point - Normal * (SignedDistance(point) / Normal.LengthSquared());
+}
+
+inline Plane Plane::Normalized() const {
+    const float length = Normal.Length();
+    return length > 0.0f ? Plane(Normal / length, Distance / length) : *this;
+}
+
+// ============================================================================
+// AABB
+// ============================================================================
+
+inline AABB::AABB()
+    : Min(std::numeric_limits<float>::infinity()), Max(-std::numeric_limits<float>::infinity()) {}
+
+inline AABB::AABB(const Vector3f& min, const Vector3f& max) : Min(min), Max(max) {}
+
+inline AABB AABB::FromCenterExtents(const Vector3f& center, const Vector3f& extents) {
+    return AABB(center - extents, center + extents);
+}
+
+inline AABB AABB::FromPoints(const Vector3f* points, const int32_t count) {
+    AABB result;
+    for (int32_t i = 0; i < count; ++i) {
+        result.Expand(points[i]);
+    }
+    return result;
+}
+
+inline Vector3f AABB::GetCenter() const { return (Min + Max) * 0.5f; }
+
+inline Vector3f AABB::GetExtents() const { return (Max - Min) * 0.5f; }
+
+inline Vector3f AABB::GetSize() const { return Max - Min; }
+
+inline float AABB::GetSurfaceArea() const {
+    const Vector3f size = GetSize();
+    return 2.0f * (size.X * size.Y + size.Y * size.Z + size.Z * size.X);
+}
+
+inline float AABB::GetVolume() const {
+    const Vector3f size = GetSize();
+    return size.X * size.Y * size.Z;
+}
+
+inline bool AABB::IsValid() const { return Min.X <= Max.X && Min.Y <= Max.Y && Min.Z <= Max.Z; }
+
+inline void AABB::Expand(const Vector3f& point) {
+    Min = Min.Min(point);
+    Max = Max.Max(point);
+}
+
+inline void AABB::Expand(const AABB& other) {
+    Min = Min.Min(other.Min);
+    Max = Max.Max(other.Max);
+}
+
+inline AABB AABB::Union(const AABB& a, const AABB& b) { return AABB(a.Min.Min(b.Min), a.Max.Max(b.Max)); }
+
+inline bool AABB::Contains(const Vector3f& point) const {
+    return point.X >= Min.X && point.X <= Max.X && point.Y >= Min.Y && point.Y <= Max.Y && point.Z >= Min.Z &&
+           point.Z <= Max.Z;
+}
+
+inline bool AABB::Contains(const AABB& other) const {
+    return other.Min.X >= Min.X && other.Max.X <= Max.X && other.Min.Y >= Min.Y && other.Max.Y <= Max.Y &&
+           other.Min.Z >= Min.Z && other.Max.Z <= Max.Z;
+}
+
+inline bool AABB::Intersects(const AABB& other) const {
+    return Min.X <= other.Max.X && Max.X >= other.Min.X && Min.Y <= other.Max.Y && Max.Y >= other.Min.Y &&
+           Min.Z <= other.Max.Z && Max.Z >= other.Min.Z;
+}
+
+inline bool AABB::Intersects(const BoundingSphere& sphere) const {
+    return DistanceSquared(sphere.Center) <= sphere.Radius * sphere.Radius;
+}
+
+inline Vector3f AABB::ClosestPoint(const Vector3f& point) const { return point.Max(Min).Min(Max); }
+
+inline float AABB::DistanceSquared(const Vector3f& point) const { return ClosestPoint(point).DistanceSquared(point); }
+
+// ============================================================================
+// BoundingSphere
+// ============================================================================
+
+inline BoundingSphere::BoundingSphere(const Vector3f& center, const float radius) : Center(center), Radius(radius) {}
+
+inline BoundingSphere BoundingSphere::FromAABB(const AABB& box) {
+    return BoundingSphere(box.GetCenter(), box.GetExtents().Length());
+}
+
+inline bool BoundingSphere::Contains(const Vector3f& point) const {
+    return Center.DistanceSquared(point) <= Radius * Radius;
+}
+
+inline bool BoundingSphere::Intersects(const BoundingSphere& other) const {
+    const float radii = Radius + other.Radius;
+    return Center.DistanceSquared(other.Center) <= radii * radii;
+}
+
+inline bool BoundingSphere::Intersects(const AABB& box) const { return box.Intersects(*this); }
+
+inline AABB BoundingSphere::GetBounds() const { return AABB::FromCenterExtents(Center, Vector3f(Radius)); }
+
+// ============================================================================
+// OBB
+// ============================================================================
+
+inline OBB::OBB(const Vector3f& center, const Vector3f& extents, const Quaternion& orientation)
+    : Center(center), Extents(extents), Orientation(orientation) {}
+
+inline OBB OBB::FromAABB(const AABB& box, const Quaternion& rotation, const Vector3f& translation) {
+    return OBB(rotation.RotateVector(box.GetCenter()) + translation, box.GetExtents(), rotation);
+}
+
+inline void OBB::GetAxes(Vector3f& outX, Vector3f& outY, Vector3f& outZ) const {
+    outX = Orientation.RotateVector(Vector3f::UnitX);
+    outY = Orientation.RotateVector(Vector3f::UnitY);
+    outZ = Orientation.RotateVector(Vector3f::UnitZ);
+}
+
+inline bool OBB::Intersects(const AABB& box) const {
+    return Intersects(OBB(box.GetCenter(), box.GetExtents(), Quaternion::Identity));
+}
+} // namespace Edvar::Math
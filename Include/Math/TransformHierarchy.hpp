@@ -0,0 +1,90 @@
+#pragma once
+#include "Containers/List.hpp"
+#include "Containers/SoAList.hpp"
+#include "Math/All.hpp"
+
+namespace Edvar::Threading {
+class ThreadPool;
+}
+
+namespace Edvar::Math {
+/**
+ * @brief A tree of local transforms whose world matrices are updated in batches.
+ *
+ * Nodes are stored in an SoAList sorted by depth, parents always before their children, so one pass over each level
+ * reads only world matrices finished in the level before. Local matrices are built eight nodes at a time with the wide
+ * types. Only nodes whose local transform changed, and the subtrees below them, are recomputed; levels larger than
+ * UpdateChunkSize are split across a thread pool when one is given.
+ *
+ * Node ids stay valid until the node is removed, the storage order behind them changes whenever nodes are added or
+ * removed. That reordering is deferred to the next UpdateWorldMatrices call and costs one pass over all nodes.
+ * Translation, rotation and scale are stored as floats.
+ *
+ * Example usage:
+ *   TransformHierarchy hierarchy;
+ *   const int32_t root = hierarchy.AddNode(TransformHierarchy::InvalidNode, Vector3f(0.0f, 1.0f, 0.0f));
+ *   const int32_t child = hierarchy.AddNode(root, Vector3f(1.0f, 0.0f, 0.0f));
+ *   hierarchy.UpdateWorldMatrices();
+ *   const Matrix4x4f& world = hierarchy.GetWorldMatrix(child);
+ */
+class EDVAR_CPP_CORE_API TransformHierarchy {
+public:
+    static constexpr int32_t InvalidNode = -1;
+    /** @brief Nodes per job when a level is split across a thread pool. */
+    static constexpr int32_t UpdateChunkSize = 4096;
+
+    TransformHierarchy() = default;
+
+    /**
+     * @brief Adds a node below parent, or a root if parent is InvalidNode.
+     * @return The id of the new node.
+     */
+    int32_t AddNode(int32_t parent, const Vector3f& translation, const Quaternion& rotation = Quaternion::Identity,
+                    const Vector3f& scale = Vector3f::One);
+    int32_t AddNode(int32_t parent, const Transform& local);
+    /** @brief Removes node together with every node below it. */
+    void RemoveNode(int32_t node);
+
+    /** @brief Replaces the local transform of node, its subtree is updated on the next UpdateWorldMatrices. */
+    void SetLocal(int32_t node, const Vector3f& translation, const Quaternion& rotation, const Vector3f& scale);
+    void SetLocal(int32_t node, const Transform& local);
+    Transform GetLocal(int32_t node) const;
+    /** @return The parent of node, InvalidNode for roots. */
+    int32_t GetParent(int32_t node) const;
+
+    /** @brief The world matrix of node as of the last UpdateWorldMatrices. */
+    const Matrix4x4f& GetWorldMatrix(int32_t node) const;
+
+    int32_t GetNodeCount() const;
+    bool IsValidNode(int32_t node) const;
+
+    /** @brief Recomputes the world matrices of every node changed since the last update and of their subtrees. */
+    void UpdateWorldMatrices();
+    /** @brief As UpdateWorldMatrices, with levels larger than UpdateChunkSize split across pool. */
+    void UpdateWorldMatrices(Threading::ThreadPool& pool);
+
+private:
+    // Fields of nodes. The parent field holds the storage slot of the parent, not its id.
+    static constexpr int32_t TranslationField = 0;
+    static constexpr int32_t RotationField = 1;
+    static constexpr int32_t ScaleField = 2;
+    static constexpr int32_t ParentField = 3;
+    static constexpr int32_t NodeIdField = 4;
+    static constexpr int32_t ChangedField = 5;
+    static constexpr int32_t WorldField = 6;
+
+    Containers::SoAList<Vector3f, Quaternion, Vector3f, int32_t, int32_t, uint8_t, Matrix4x4f> nodes;
+    // Storage slot of every id, InvalidNode for free ids
+    Containers::List<int32_t> slotOfNode;
+    Containers::List<int32_t> freeNodeIds;
+    // First slot of every depth, plus one past the last node
+    Containers::List<int32_t> levelStarts;
+    bool needsRebuild = false;
+    bool hasChanges = false;
+
+    int32_t GetSlot(int32_t node) const;
+    void Rebuild();
+    void UpdateRange(int32_t begin, int32_t end);
+    void UpdateLevels(Threading::ThreadPool* pool);
+};
+} // namespace Edvar::Math
@@ -0,0 +1,235 @@
+#pragma once
+#include "Math.hpp"
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Vector.hpp"
+
+// Wide types store several elements component by component (AoSoA), a Vector3fx8 holds the X of eight vectors in one
+// register, their Y in the next and so on. Operations then run on every element at once without wasted lanes or
+// horizontal steps, unlike Vector3 where one vector occupies one register. They are meant for batch passes: load a
+// group of elements from an SoAList or List, compute, store back.
+
+namespace Edvar::Math {
+namespace SIMD {
+/** @brief Scalar type and lane count of the registers the wide types are built from. */
+template <typename LaneT> struct LaneTraits {
+    static constexpr int32_t Width = 0;
+};
+template <> struct LaneTraits<Float_4> {
+    using ScalarType = float;
+    static constexpr int32_t Width = 4;
+};
+template <> struct LaneTraits<Float_8> {
+    using ScalarType = float;
+    static constexpr int32_t Width = 8;
+};
+template <> struct LaneTraits<Double_2> {
+    using ScalarType = double;
+    static constexpr int32_t Width = 2;
+};
+template <> struct LaneTraits<Double_4> {
+    using ScalarType = double;
+    static constexpr int32_t Width = 4;
+};
+template <typename LaneT> static constexpr bool IsWideLaneSupported = LaneTraits<LaneT>::Width > 0;
+template <typename LaneT> using LaneScalarType = typename LaneTraits<LaneT>::ScalarType;
+
+/** @return A register with every lane set to value. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT Splat(LaneScalarType<LaneT> value);
+/**
+ * @brief Picks ifSet in the lanes where mask is set and ifClear elsewhere.
+ * @param mask Result of a comparison, every lane all ones or all zeros.
+ */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+LaneT Select(const LaneT& mask, const LaneT& ifSet, const LaneT& ifClear);
+/** @return True if any lane of the comparison result is set. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+bool AnyLane(const LaneT& mask);
+/** @return True if every lane of the comparison result is set. */
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+bool AllLanes(const LaneT& mask);
+} // namespace SIMD
+
+// ============================================================================
+// Vector3Wide
+// ============================================================================
+
+/**
+ * @brief Width Vector3s, one register per component.
+ * @tparam LaneT SIMD::Float_4, SIMD::Float_8 or SIMD::Double_4.
+ */
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+struct Vector3Wide {
+    using LaneType = LaneT;
+    using ScalarType = SIMD::LaneScalarType<LaneT>;
+    static constexpr int32_t Width = SIMD::LaneTraits<LaneT>::Width;
+
+    LaneT X, Y, Z;
+
+    // Constructors
+    Vector3Wide() = default;
+    Vector3Wide(const LaneT& x, const LaneT& y, const LaneT& z);
+    /** Every element set to value. */
+    explicit Vector3Wide(const Vector3<ScalarType>& value);
+
+    // Loads and stores of Width elements, the pointers need not be aligned
+    /** From one array per component, e.g. the fields of an SoAList<float, float, float>. */
+    static Vector3Wide Load(const ScalarType* x, const ScalarType* y, const ScalarType* z);
+    /** From packed vectors, e.g. a List<Vector3f> or an SoAList field of Vector3f. */
+    static Vector3Wide Load(const Vector3<ScalarType>* elements);
+    void Store(ScalarType* x, ScalarType* y, ScalarType* z) const;
+    void Store(Vector3<ScalarType>* elements) const;
+
+    Vector3<ScalarType> GetElement(int32_t index) const;
+    void SetElement(int32_t index, const Vector3<ScalarType>& value);
+
+    // Arithmetic operators
+    Vector3Wide operator+(const Vector3Wide& other) const;
+    Vector3Wide operator-(const Vector3Wide& other) const;
+    Vector3Wide operator*(const Vector3Wide& other) const;
+    Vector3Wide operator/(const Vector3Wide& other) const;
+    Vector3Wide operator*(const LaneT& scalar) const;
+    Vector3Wide operator/(const LaneT& scalar) const;
+    Vector3Wide operator-() const;
+    Vector3Wide& operator+=(const Vector3Wide& other);
+    Vector3Wide& operator-=(const Vector3Wide& other);
+    Vector3Wide& operator*=(const LaneT& scalar);
+
+    // Vector operations, one result per element
+    LaneT Dot(const Vector3Wide& other) const;
+    Vector3Wide Cross(const Vector3Wide& other) const;
+    LaneT Length() const;
+    LaneT LengthSquared() const;
+    LaneT DistanceSquared(const Vector3Wide& other) const;
+    /** Elements of zero length become zero, as with Vector3::Normalized. */
+    Vector3Wide Normalized() const;
+    Vector3Wide Min(const Vector3Wide& other) const;
+    Vector3Wide Max(const Vector3Wide& other) const;
+    Vector3Wide Lerp(const Vector3Wide& other, const LaneT& t) const;
+
+    /** Per element ifSet where mask is set and ifClear elsewhere. */
+    static Vector3Wide Select(const LaneT& mask, const Vector3Wide& ifSet, const Vector3Wide& ifClear);
+};
+
+using Vector3fx4 = Vector3Wide<SIMD::Float_4>;
+using Vector3fx8 = Vector3Wide<SIMD::Float_8>;
+using Vector3dx4 = Vector3Wide<SIMD::Double_4>;
+
+// ============================================================================
+// QuaternionWide
+// ============================================================================
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+struct Matrix4x4Wide;
+
+/**
+ * @brief Width Quaternions, one register per component. Follows the conventions of Quaternion.
+ * @tparam LaneT SIMD::Float_4 or SIMD::Float_8.
+ */
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+struct QuaternionWide {
+    using LaneType = LaneT;
+    static constexpr int32_t Width = SIMD::LaneTraits<LaneT>::Width;
+
+    LaneT X, Y, Z, W;
+
+    // Constructors
+    QuaternionWide() = default;
+    QuaternionWide(const LaneT& x, const LaneT& y, const LaneT& z, const LaneT& w);
+    /** Every element set to value. */
+    explicit QuaternionWide(const Quaternion& value);
+
+    // Loads and stores of Width elements, the pointers need not be aligned
+    static QuaternionWide Load(const float* x, const float* y, const float* z, const float* w);
+    static QuaternionWide Load(const Quaternion* elements);
+    void Store(float* x, float* y, float* z, float* w) const;
+    void Store(Quaternion* elements) const;
+
+    Quaternion GetElement(int32_t index) const;
+    void SetElement(int32_t index, const Quaternion& value);
+
+    // Arithmetic operators
+    /** Per element this * other, see Quaternion::operator*. */
+    QuaternionWide operator*(const QuaternionWide& other) const;
+    QuaternionWide operator+(const QuaternionWide& other) const;
+    QuaternionWide operator-(const QuaternionWide& other) const;
+    QuaternionWide operator*(const LaneT& scalar) const;
+    QuaternionWide operator-() const;
+
+    // Quaternion operations, one result per element
+    LaneT Dot(const QuaternionWide& other) const;
+    LaneT Length() const;
+    LaneT LengthSquared() const;
+    /** Elements of near zero length become the identity, as with Quaternion::Normalized. */
+    QuaternionWide Normalized() const;
+    QuaternionWide Conjugate() const;
+    Vector3Wide<LaneT> RotateVector(const Vector3Wide<LaneT>& vec) const;
+    Vector3Wide<LaneT> UnrotateVector(const Vector3Wide<LaneT>& vec) const;
+    /** Per element rotation matrix, see Quaternion::ToRotationMatrix4x4. */
+    Matrix4x4Wide<LaneT> ToRotationMatrix() const;
+
+    // Interpolation with a separate alpha per element
+    /** See Quaternion::Nlerp. */
+    static QuaternionWide Nlerp(const QuaternionWide& a, const QuaternionWide& b, const LaneT& alpha);
+    /**
+     * See Quaternion::Slerp, including the shortest path and the Nlerp fallback for nearly equal inputs. The angle
+     * comes from SIMD::FastACos, results are within 1e-6 of Quaternion::Slerp for unit inputs.
+     */
+    static QuaternionWide Slerp(const QuaternionWide& a, const QuaternionWide& b, const LaneT& alpha);
+
+    /** Per element ifSet where mask is set and ifClear elsewhere. */
+    static QuaternionWide Select(const LaneT& mask, const QuaternionWide& ifSet, const QuaternionWide& ifClear);
+};
+
+using Quaternionx4 = QuaternionWide<SIMD::Float_4>;
+using Quaternionx8 = QuaternionWide<SIMD::Float_8>;
+
+// ============================================================================
+// Matrix4x4Wide
+// ============================================================================
+
+/**
+ * @brief Width Matrix4x4s, one register per element position. Row-major and column vector, like Matrix4x4.
+ * @tparam LaneT SIMD::Float_4, SIMD::Float_8 or SIMD::Double_4.
+ */
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+struct Matrix4x4Wide {
+    using LaneType = LaneT;
+    using ScalarType = SIMD::LaneScalarType<LaneT>;
+    static constexpr int32_t Width = SIMD::LaneTraits<LaneT>::Width;
+
+    LaneT M[4][4];
+
+    // Constructors
+    Matrix4x4Wide() = default;
+    /** Every element set to value. */
+    explicit Matrix4x4Wide(const Matrix4x4<ScalarType>& value);
+
+    // Loads and stores of Width elements, the pointers need not be aligned
+    static Matrix4x4Wide Load(const Matrix4x4<ScalarType>* elements);
+    void Store(Matrix4x4<ScalarType>* elements) const;
+
+    Matrix4x4<ScalarType> GetElement(int32_t index) const;
+    void SetElement(int32_t index, const Matrix4x4<ScalarType>& value);
+
+    // Matrix operations, one result per element
+    /** Per element this * other, see Matrix4x4::operator*. */
+    Matrix4x4Wide operator*(const Matrix4x4Wide& other) const;
+    Matrix4x4Wide Transpose() const;
+    Vector3Wide<LaneT> TransformPoint(const Vector3Wide<LaneT>& point) const;
+    Vector3Wide<LaneT> TransformVector(const Vector3Wide<LaneT>& vec) const;
+};
+
+using Matrix4x4fx4 = Matrix4x4Wide<SIMD::Float_4>;
+using Matrix4x4fx8 = Matrix4x4Wide<SIMD::Float_8>;
+using Matrix4x4dx4 = Matrix4x4Wide<SIMD::Double_4>;
+} // namespace Edvar::Math
@@ -0,0 +1,943 @@
+#pragma once
+#include "Math/Math.hpp"
+#include "SIMDMath.hpp"
+#include "Wide.hpp"
+
+namespace Edvar::Math {
+namespace SIMD {
+// ============================================================================
+// Lane helpers
+// ============================================================================
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Splat(const LaneScalarType<LaneT> value) {
+    if constexpr (std::is_same_v<LaneT, Float_8>) {
+        return Float_8(value);
+    } else if constexpr (std::is_same_v<LaneT, Double_2>) {
+        return Double_2{value, value};
+    } else {
+        return LaneT{value, value, value, value};
+    }
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Select(const LaneT& mask, const LaneT& ifSet, const LaneT& ifClear) {
+    return ifClear ^ ((ifSet ^ ifClear) & mask);
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE bool AnyLane(const LaneT& mask) {
+    return mask.GetMaskBits() != 0;
+}
+
+template <typename LaneT>
+    requires(IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE bool AllLanes(const LaneT& mask) {
+    return mask.GetMaskBits() == (1 << LaneTraits<LaneT>::Width) - 1;
+}
+
+namespace _z__Private {
+// Conversions between Width packed elements of Components scalars and one register per component. The templates
+// transpose through the stack, the overloads below use shuffles where the backend has them.
+
+template <int32_t Components, typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved(const LaneScalarType<LaneT>* in, LaneT* out) {
+    constexpr int32_t width = LaneTraits<LaneT>::Width;
+    alignas(64) LaneScalarType<LaneT> components[Components][width];
+    for (int32_t i = 0; i < width; ++i) {
+        for (int32_t c = 0; c < Components; ++c) {
+            components[c][i] = in[i * Components + c];
+        }
+    }
+    for (int32_t c = 0; c < Components; ++c) {
+        out[c] = LaneT::LoadAligned(components[c]);
+    }
+}
+template <int32_t Components, typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved(const LaneT* in, LaneScalarType<LaneT>* out) {
+    constexpr int32_t width = LaneTraits<LaneT>::Width;
+    alignas(64) LaneScalarType<LaneT> components[Components][width];
+    for (int32_t c = 0; c < Components; ++c) {
+        in[c].StoreAligned(components[c]);
+    }
+    for (int32_t i = 0; i < width; ++i) {
+        for (int32_t c = 0; c < Components; ++c) {
+            out[i * Components + c] = components[c][i];
+        }
+    }
+}
+
+template <typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved3(const LaneScalarType<LaneT>* in, LaneT& x, LaneT& y, LaneT& z) {
+    LaneT lanes[3];
+    LoadInterleaved<3>(in, lanes);
+    x = lanes[0];
+    y = lanes[1];
+    z = lanes[2];
+}
+template <typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved3(LaneScalarType<LaneT>* out, const LaneT& x, const LaneT& y,
+                                                   const LaneT& z) {
+    const LaneT lanes[3] = {x, y, z};
+    StoreInterleaved<3>(lanes, out);
+}
+template <typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved4(const LaneScalarType<LaneT>* in, LaneT& x, LaneT& y, LaneT& z,
+                                                  LaneT& w) {
+    LaneT lanes[4];
+    LoadInterleaved<4>(in, lanes);
+    x = lanes[0];
+    y = lanes[1];
+    z = lanes[2];
+    w = lanes[3];
+}
+template <typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved4(LaneScalarType<LaneT>* out, const LaneT& x, const LaneT& y,
+                                                   const LaneT& z, const LaneT& w) {
+    const LaneT lanes[4] = {x, y, z, w};
+    StoreInterleaved<4>(lanes, out);
+}
+// Width pairs of 3 component elements, such as the Min and Max of boxes
+template <typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved6(const LaneScalarType<LaneT>* in, LaneT& x0, LaneT& y0, LaneT& z0,
+                                                  LaneT& x1, LaneT& y1, LaneT& z1) {
+    LaneT lanes[6];
+    LoadInterleaved<6>(in, lanes);
+    x0 = lanes[0];
+    y0 = lanes[1];
+    z0 = lanes[2];
+    x1 = lanes[3];
+    y1 = lanes[4];
+    z1 = lanes[5];
+}
+// Width 4x4 matrices, one register per element position
+template <typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved16(const LaneScalarType<LaneT>* in, LaneT* out) {
+    LoadInterleaved<16>(in, out);
+}
+template <typename LaneT>
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved16(const LaneT* in, LaneScalarType<LaneT>* out) {
+    StoreInterleaved<16>(in, out);
+}
+
+#if EDVAR_CPP_CORE_MATH_X86_SIMD
+// The same shuffles serve 128-bit registers and each half of a 256-bit register.
+#    define EDVAR_CPP_CORE_MATH_DEINTERLEAVE3(Type, Shuffle, a, b, c, x, y, z)                                        \
+        {                                                                                                              \
+            const Type ab = Shuffle(a, b, _MM_SHUFFLE(1, 0, 2, 1));                                                    \
+            const Type bc = Shuffle(b, c, _MM_SHUFFLE(2, 1, 3, 2));                                                    \
+            x = Shuffle(a, bc, _MM_SHUFFLE(2, 0, 3, 0));                                                               \
+            y = Shuffle(ab, bc, _MM_SHUFFLE(3, 1, 2, 0));                                                              \
+            z = Shuffle(ab, c, _MM_SHUFFLE(3, 0, 3, 1));                                                               \
+        }
+#    define EDVAR_CPP_CORE_MATH_INTERLEAVE3(Type, Shuffle, UnpackLow, UnpackHigh, x, y, z, a, b, c)                   \
+        {                                                                                                              \
+            const Type xyLow = UnpackLow(x, y);                                                                        \
+            const Type xyHigh = UnpackHigh(x, y);                                                                      \
+            a = Shuffle(xyLow, Shuffle(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));                       \
+            b = Shuffle(Shuffle(y, z, _MM_SHUFFLE(1, 1, 1, 1)), xyHigh, _MM_SHUFFLE(1, 0, 2, 0));                      \
+            c = Shuffle(Shuffle(z, xyHigh, _MM_SHUFFLE(2, 2, 2, 2)), Shuffle(xyHigh, z, _MM_SHUFFLE(3, 3, 3, 3)),      \
+                        _MM_SHUFFLE(2, 0, 2, 0));                                                                      \
+        }
+// Transposes four rows of four, in place.
+#    define EDVAR_CPP_CORE_MATH_TRANSPOSE4(Type, Shuffle, UnpackLow, UnpackHigh, r0, r1, r2, r3)                      \
+        {                                                                                                              \
+            const Type t0 = UnpackLow(r0, r1);                                                                         \
+            const Type t1 = UnpackHigh(r0, r1);                                                                        \
+            const Type t2 = UnpackLow(r2, r3);                                                                         \
+            const Type t3 = UnpackHigh(r2, r3);                                                                        \
+            r0 = Shuffle(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));                                                             \
+            r1 = Shuffle(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));                                                             \
+            r2 = Shuffle(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));                                                             \
+            r3 = Shuffle(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));                                                             \
+        }
+
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved3(const float* in, Float_4& x, Float_4& y, Float_4& z) {
+    const __m128 a = _mm_loadu_ps(in);
+    const __m128 b = _mm_loadu_ps(in + 4);
+    const __m128 c = _mm_loadu_ps(in + 8);
+    __m128 outX, outY, outZ;
+    EDVAR_CPP_CORE_MATH_DEINTERLEAVE3(__m128, _mm_shuffle_ps, a, b, c, outX, outY, outZ)
+    x = FromNative(outX);
+    y = FromNative(outY);
+    z = FromNative(outZ);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved3(float* out, const Float_4& x, const Float_4& y, const Float_4& z) {
+    const __m128 inX = ToNative(x), inY = ToNative(y), inZ = ToNative(z);
+    __m128 a, b, c;
+    EDVAR_CPP_CORE_MATH_INTERLEAVE3(__m128, _mm_shuffle_ps, _mm_unpacklo_ps, _mm_unpackhi_ps, inX, inY, inZ, a, b, c)
+    _mm_storeu_ps(out, a);
+    _mm_storeu_ps(out + 4, b);
+    _mm_storeu_ps(out + 8, c);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved4(const float* in, Float_4& x, Float_4& y, Float_4& z, Float_4& w) {
+    __m128 r0 = _mm_loadu_ps(in), r1 = _mm_loadu_ps(in + 4), r2 = _mm_loadu_ps(in + 8), r3 = _mm_loadu_ps(in + 12);
+    EDVAR_CPP_CORE_MATH_TRANSPOSE4(__m128, _mm_shuffle_ps, _mm_unpacklo_ps, _mm_unpackhi_ps, r0, r1, r2, r3)
+    x = FromNative(r0);
+    y = FromNative(r1);
+    z = FromNative(r2);
+    w = FromNative(r3);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved4(float* out, const Float_4& x, const Float_4& y, const Float_4& z,
+                                                   const Float_4& w) {
+    __m128 r0 = ToNative(x), r1 = ToNative(y), r2 = ToNative(z), r3 = ToNative(w);
+    EDVAR_CPP_CORE_MATH_TRANSPOSE4(__m128, _mm_shuffle_ps, _mm_unpacklo_ps, _mm_unpackhi_ps, r0, r1, r2, r3)
+    _mm_storeu_ps(out, r0);
+    _mm_storeu_ps(out + 4, r1);
+    _mm_storeu_ps(out + 8, r2);
+    _mm_storeu_ps(out + 12, r3);
+}
+// Deinterleaves the pairs as eight 3 component elements, then splits the even and odd ones.
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved6(const float* in, Float_4& x0, Float_4& y0, Float_4& z0, Float_4& x1,
+                                                  Float_4& y1, Float_4& z1) {
+    Float_4 lowX, lowY, lowZ, highX, highY, highZ;
+    LoadInterleaved3(in, lowX, lowY, lowZ);
+    LoadInterleaved3(in + 12, highX, highY, highZ);
+    const auto split = [](const Float_4& low, const Float_4& high, Float_4& even, Float_4& odd) {
+        even = FromNative(_mm_shuffle_ps(ToNative(low), ToNative(high), _MM_SHUFFLE(2, 0, 2, 0)));
+        odd = FromNative(_mm_shuffle_ps(ToNative(low), ToNative(high), _MM_SHUFFLE(3, 1, 3, 1)));
+    };
+    split(lowX, highX, x0, x1);
+    split(lowY, highY, y0, y1);
+    split(lowZ, highZ, z0, z1);
+}
+// One transpose per matrix row, the rows of the four matrices are 16 floats apart.
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved16(const float* in, Float_4* out) {
+    for (int32_t row = 0; row < 4; ++row) {
+        const float* rowIn = in + 4 * row;
+        __m128 r0 = _mm_loadu_ps(rowIn), r1 = _mm_loadu_ps(rowIn + 16);
+        __m128 r2 = _mm_loadu_ps(rowIn + 32), r3 = _mm_loadu_ps(rowIn + 48);
+        EDVAR_CPP_CORE_MATH_TRANSPOSE4(__m128, _mm_shuffle_ps, _mm_unpacklo_ps, _mm_unpackhi_ps, r0, r1, r2, r3)
+        out[4 * row] = FromNative(r0);
+        out[4 * row + 1] = FromNative(r1);
+        out[4 * row + 2] = FromNative(r2);
+        out[4 * row + 3] = FromNative(r3);
+    }
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved16(const Float_4* in, float* out) {
+    for (int32_t row = 0; row < 4; ++row) {
+        float* rowOut = out + 4 * row;
+        __m128 r0 = ToNative(in[4 * row]), r1 = ToNative(in[4 * row + 1]);
+        __m128 r2 = ToNative(in[4 * row + 2]), r3 = ToNative(in[4 * row + 3]);
+        EDVAR_CPP_CORE_MATH_TRANSPOSE4(__m128, _mm_shuffle_ps, _mm_unpacklo_ps, _mm_unpackhi_ps, r0, r1, r2, r3)
+        _mm_storeu_ps(rowOut, r0);
+        _mm_storeu_ps(rowOut + 16, r1);
+        _mm_storeu_ps(rowOut + 32, r2);
+        _mm_storeu_ps(rowOut + 48, r3);
+    }
+}
+#endif
+
+#if EDVAR_CPP_CORE_MATH_X86_AVX
+// Elements 0-3 go to the low halves and 4-7 to the high halves.
+EDVAR_CPP_CORE_FORCE_INLINE __m256 LoadHalves(const float* low, const float* high) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreHalves(float* low, float* high, const __m256 value) {
+    _mm_storeu_ps(low, _mm256_castps256_ps128(value));
+    _mm_storeu_ps(high, _mm256_extractf128_ps(value, 1));
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved3(const float* in, Float_8& x, Float_8& y, Float_8& z) {
+    const __m256 a = LoadHalves(in, in + 12);
+    const __m256 b = LoadHalves(in + 4, in + 16);
+    const __m256 c = LoadHalves(in + 8, in + 20);
+    __m256 outX, outY, outZ;
+    EDVAR_CPP_CORE_MATH_DEINTERLEAVE3(__m256, _mm256_shuffle_ps, a, b, c, outX, outY, outZ)
+    x = FromNative(outX);
+    y = FromNative(outY);
+    z = FromNative(outZ);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved3(float* out, const Float_8& x, const Float_8& y, const Float_8& z) {
+    const __m256 inX = ToNative(x), inY = ToNative(y), inZ = ToNative(z);
+    __m256 a, b, c;
+    EDVAR_CPP_CORE_MATH_INTERLEAVE3(__m256, _mm256_shuffle_ps, _mm256_unpacklo_ps, _mm256_unpackhi_ps, inX, inY, inZ,
+                                    a, b, c)
+    StoreHalves(out, out + 12, a);
+    StoreHalves(out + 4, out + 16, b);
+    StoreHalves(out + 8, out + 20, c);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved4(const float* in, Float_8& x, Float_8& y, Float_8& z, Float_8& w) {
+    __m256 r0 = LoadHalves(in, in + 16), r1 = LoadHalves(in + 4, in + 20);
+    __m256 r2 = LoadHalves(in + 8, in + 24), r3 = LoadHalves(in + 12, in + 28);
+    EDVAR_CPP_CORE_MATH_TRANSPOSE4(__m256, _mm256_shuffle_ps, _mm256_unpacklo_ps, _mm256_unpackhi_ps, r0, r1, r2, r3)
+    x = FromNative(r0);
+    y = FromNative(r1);
+    z = FromNative(r2);
+    w = FromNative(r3);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved4(float* out, const Float_8& x, const Float_8& y, const Float_8& z,
+                                                   const Float_8& w) {
+    __m256 r0 = ToNative(x), r1 = ToNative(y), r2 = ToNative(z), r3 = ToNative(w);
+    EDVAR_CPP_CORE_MATH_TRANSPOSE4(__m256, _mm256_shuffle_ps, _mm256_unpacklo_ps, _mm256_unpackhi_ps, r0, r1, r2, r3)
+    StoreHalves(out, out + 16, r0);
+    StoreHalves(out + 4, out + 20, r1);
+    StoreHalves(out + 8, out + 24, r2);
+    StoreHalves(out + 12, out + 28, r3);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved6(const float* in, Float_8& x0, Float_8& y0, Float_8& z0, Float_8& x1,
+                                                  Float_8& y1, Float_8& z1) {
+    Float_8 lowX, lowY, lowZ, highX, highY, highZ;
+    LoadInterleaved3(in, lowX, lowY, lowZ);
+    LoadInterleaved3(in + 24, highX, highY, highZ);
+    const auto split = [](const Float_8& low, const Float_8& high, Float_8& even, Float_8& odd) {
+        // Elements 0-7 to the low halves and 8-15 to the high halves, so the in-lane shuffles see them in order
+        const __m256 a = _mm256_permute2f128_ps(ToNative(low), ToNative(high), 0x20);
+        const __m256 b = _mm256_permute2f128_ps(ToNative(low), ToNative(high), 0x31);
+        even = FromNative(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        odd = FromNative(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    };
+    split(lowX, highX, x0, x1);
+    split(lowY, highY, y0, y1);
+    split(lowZ, highZ, z0, z1);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved16(const float* in, Float_8* out) {
+    for (int32_t row = 0; row < 4; ++row) {
+        const float* rowIn = in + 4 * row;
+        __m256 r0 = LoadHalves(rowIn, rowIn + 64), r1 = LoadHalves(rowIn + 16, rowIn + 80);
+        __m256 r2 = LoadHalves(rowIn + 32, rowIn + 96), r3 = LoadHalves(rowIn + 48, rowIn + 112);
+        EDVAR_CPP_CORE_MATH_TRANSPOSE4(__m256, _mm256_shuffle_ps, _mm256_unpacklo_ps, _mm256_unpackhi_ps, r0, r1, r2,
+                                       r3)
+        out[4 * row] = FromNative(r0);
+        out[4 * row + 1] = FromNative(r1);
+        out[4 * row + 2] = FromNative(r2);
+        out[4 * row + 3] = FromNative(r3);
+    }
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved16(const Float_8* in, float* out) {
+    for (int32_t row = 0; row < 4; ++row) {
+        float* rowOut = out + 4 * row;
+        __m256 r0 = ToNative(in[4 * row]), r1 = ToNative(in[4 * row + 1]);
+        __m256 r2 = ToNative(in[4 * row + 2]), r3 = ToNative(in[4 * row + 3]);
+        EDVAR_CPP_CORE_MATH_TRANSPOSE4(__m256, _mm256_shuffle_ps, _mm256_unpacklo_ps, _mm256_unpackhi_ps, r0, r1, r2,
+                                       r3)
+        StoreHalves(rowOut, rowOut + 64, r0);
+        StoreHalves(rowOut + 16, rowOut + 80, r1);
+        StoreHalves(rowOut + 32, rowOut + 96, r2);
+        StoreHalves(rowOut + 48, rowOut + 112, r3);
+    }
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved3(const double* in, Double_4& x, Double_4& y, Double_4& z) {
+    // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+    const __m256d a = _mm256_loadu_pd(in);
+    const __m256d b = _mm256_loadu_pd(in + 4);
+    const __m256d c = _mm256_loadu_pd(in + 8);
+    const __m256d p = _mm256_blend_pd(a, b, 0b1100);      // x0 y0 x2 y2
+    const __m256d q = _mm256_permute2f128_pd(a, c, 0x21); // z0 x1 z2 x3
+    const __m256d r = _mm256_blend_pd(b, c, 0b1100);      // y1 z1 y3 z3
+    x = FromNative(_mm256_shuffle_pd(p, q, 0b1010));
+    y = FromNative(_mm256_shuffle_pd(p, r, 0b0101));
+    z = FromNative(_mm256_shuffle_pd(q, r, 0b1010));
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved3(double* out, const Double_4& x, const Double_4& y,
+                                                   const Double_4& z) {
+    const __m256d inX = ToNative(x), inY = ToNative(y), inZ = ToNative(z);
+    const __m256d p = _mm256_shuffle_pd(inX, inY, 0b0000); // x0 y0 x2 y2
+    const __m256d q = _mm256_shuffle_pd(inZ, inX, 0b1010); // z0 x1 z2 x3
+    const __m256d r = _mm256_shuffle_pd(inY, inZ, 0b1111); // y1 z1 y3 z3
+    _mm256_storeu_pd(out, _mm256_permute2f128_pd(p, q, 0x20));
+    _mm256_storeu_pd(out + 4, _mm256_blend_pd(r, p, 0b1100));
+    _mm256_storeu_pd(out + 8, _mm256_permute2f128_pd(q, r, 0x31));
+}
+#elif EDVAR_CPP_CORE_MATH_ARM64_SIMD
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved3(const float* in, Float_4& x, Float_4& y, Float_4& z) {
+    const float32x4x3_t lanes = vld3q_f32(in);
+    x = FromNative(lanes.val[0]);
+    y = FromNative(lanes.val[1]);
+    z = FromNative(lanes.val[2]);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved3(float* out, const Float_4& x, const Float_4& y, const Float_4& z) {
+    vst3q_f32(out, float32x4x3_t{{ToNative(x), ToNative(y), ToNative(z)}});
+}
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved4(const float* in, Float_4& x, Float_4& y, Float_4& z, Float_4& w) {
+    const float32x4x4_t lanes = vld4q_f32(in);
+    x = FromNative(lanes.val[0]);
+    y = FromNative(lanes.val[1]);
+    z = FromNative(lanes.val[2]);
+    w = FromNative(lanes.val[3]);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved4(float* out, const Float_4& x, const Float_4& y, const Float_4& z,
+                                                   const Float_4& w) {
+    vst4q_f32(out, float32x4x4_t{{ToNative(x), ToNative(y), ToNative(z), ToNative(w)}});
+}
+#endif
+
+#if !EDVAR_CPP_CORE_MATH_X86_AVX
+// Without AVX a Float_8 is two Float_4 halves, handle each with the Float_4 overloads.
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved3(const float* in, Float_8& x, Float_8& y, Float_8& z) {
+    LoadInterleaved3(in, x.Low, y.Low, z.Low);
+    LoadInterleaved3(in + 12, x.High, y.High, z.High);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved3(float* out, const Float_8& x, const Float_8& y, const Float_8& z) {
+    StoreInterleaved3(out, x.Low, y.Low, z.Low);
+    StoreInterleaved3(out + 12, x.High, y.High, z.High);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved4(const float* in, Float_8& x, Float_8& y, Float_8& z, Float_8& w) {
+    LoadInterleaved4(in, x.Low, y.Low, z.Low, w.Low);
+    LoadInterleaved4(in + 16, x.High, y.High, z.High, w.High);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved4(float* out, const Float_8& x, const Float_8& y, const Float_8& z,
+                                                   const Float_8& w) {
+    StoreInterleaved4(out, x.Low, y.Low, z.Low, w.Low);
+    StoreInterleaved4(out + 16, x.High, y.High, z.High, w.High);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved6(const float* in, Float_8& x0, Float_8& y0, Float_8& z0, Float_8& x1,
+                                                  Float_8& y1, Float_8& z1) {
+    LoadInterleaved6(in, x0.Low, y0.Low, z0.Low, x1.Low, y1.Low, z1.Low);
+    LoadInterleaved6(in + 24, x0.High, y0.High, z0.High, x1.High, y1.High, z1.High);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void LoadInterleaved16(const float* in, Float_8* out) {
+    Float_4 low[16], high[16];
+    LoadInterleaved16(in, low);
+    LoadInterleaved16(in + 64, high);
+    for (int32_t i = 0; i < 16; ++i) {
+        out[i] = Float_8(low[i], high[i]);
+    }
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreInterleaved16(const Float_8* in, float* out) {
+    Float_4 low[16], high[16];
+    for (int32_t i = 0; i < 16; ++i) {
+        low[i] = in[i].Low;
+        high[i] = in[i].High;
+    }
+    StoreInterleaved16(low, out);
+    StoreInterleaved16(high, out + 64);
+}
+#endif
+#undef EDVAR_CPP_CORE_MATH_DEINTERLEAVE3
+#undef EDVAR_CPP_CORE_MATH_INTERLEAVE3
+#undef EDVAR_CPP_CORE_MATH_TRANSPOSE4
+} // namespace _z__Private
+} // namespace SIMD
+
+// ============================================================================
+// Vector3Wide
+// ============================================================================
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT>::Vector3Wide(const LaneT& x, const LaneT& y, const LaneT& z)
+    : X(x), Y(y), Z(z) {}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT>::Vector3Wide(const Vector3<ScalarType>& value)
+    : X(SIMD::Splat<LaneT>(value.X)), Y(SIMD::Splat<LaneT>(value.Y)), Z(SIMD::Splat<LaneT>(value.Z)) {}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::Load(const ScalarType* x, const ScalarType* y,
+                                                                        const ScalarType* z) {
+    return Vector3Wide(LaneT::LoadUnaligned(x), LaneT::LoadUnaligned(y), LaneT::LoadUnaligned(z));
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::Load(const Vector3<ScalarType>* elements) {
+    static_assert(sizeof(Vector3<ScalarType>) == 3 * sizeof(ScalarType));
+    Vector3Wide result;
+    SIMD::_z__Private::LoadInterleaved3(reinterpret_cast<const ScalarType*>(elements), result.X, result.Y, result.Z);
+    return result;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE void Vector3Wide<LaneT>::Store(ScalarType* x, ScalarType* y, ScalarType* z) const {
+    X.StoreUnaligned(x);
+    Y.StoreUnaligned(y);
+    Z.StoreUnaligned(z);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE void Vector3Wide<LaneT>::Store(Vector3<ScalarType>* elements) const {
+    SIMD::_z__Private::StoreInterleaved3(reinterpret_cast<ScalarType*>(elements), X, Y, Z);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+inline Vector3<SIMD::LaneScalarType<LaneT>> Vector3Wide<LaneT>::GetElement(const int32_t index) const {
+    alignas(64) ScalarType components[3][Width];
+    X.StoreAligned(components[0]);
+    Y.StoreAligned(components[1]);
+    Z.StoreAligned(components[2]);
+    return Vector3<ScalarType>(components[0][index], components[1][index], components[2][index]);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+inline void Vector3Wide<LaneT>::SetElement(const int32_t index, const Vector3<ScalarType>& value) {
+    alignas(64) ScalarType components[3][Width];
+    X.StoreAligned(components[0]);
+    Y.StoreAligned(components[1]);
+    Z.StoreAligned(components[2]);
+    components[0][index] = value.X;
+    components[1][index] = value.Y;
+    components[2][index] = value.Z;
+    X = LaneT::LoadAligned(components[0]);
+    Y = LaneT::LoadAligned(components[1]);
+    Z = LaneT::LoadAligned(components[2]);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::operator+(const Vector3Wide& other) const {
+    return Vector3Wide(X + other.X, Y + other.Y, Z + other.Z);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::operator-(const Vector3Wide& other) const {
+    return Vector3Wide(X - other.X, Y - other.Y, Z - other.Z);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::operator*(const Vector3Wide& other) const {
+    return Vector3Wide(X * other.X, Y * other.Y, Z * other.Z);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::operator/(const Vector3Wide& other) const {
+    return Vector3Wide(X / other.X, Y / other.Y, Z / other.Z);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::operator*(const LaneT& scalar) const {
+    return Vector3Wide(X * scalar, Y * scalar, Z * scalar);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::operator/(const LaneT& scalar) const {
+    return Vector3Wide(X / scalar, Y / scalar, Z / scalar);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::operator-() const {
+    const LaneT signBit = SIMD::Splat<LaneT>(static_cast<ScalarType>(-0.0));
+    return Vector3Wide(X ^ signBit, Y ^ signBit, Z ^ signBit);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT>& Vector3Wide<LaneT>::operator+=(const Vector3Wide& other) {
+    *this = *this + other;
+    return *this;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT>& Vector3Wide<LaneT>::operator-=(const Vector3Wide& other) {
+    *this = *this - other;
+    return *this;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT>& Vector3Wide<LaneT>::operator*=(const LaneT& scalar) {
+    *this = *this * scalar;
+    return *this;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Vector3Wide<LaneT>::Dot(const Vector3Wide& other) const {
+    return X * other.X + Y * other.Y + Z * other.Z;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::Cross(const Vector3Wide& other) const {
+    return Vector3Wide(Y * other.Z - Z * other.Y, Z * other.X - X * other.Z, X * other.Y - Y * other.X);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Vector3Wide<LaneT>::Length() const {
+    return LengthSquared().SquareRoot();
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Vector3Wide<LaneT>::LengthSquared() const {
+    return Dot(*this);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT Vector3Wide<LaneT>::DistanceSquared(const Vector3Wide& other) const {
+    return (*this - other).LengthSquared();
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::Normalized() const {
+    const LaneT zero = SIMD::Splat<LaneT>(0);
+    const LaneT length = Length();
+    // Lanes of zero length divide by zero here, the select below discards them.
+    return Select(length.GreaterThan(zero), *this / length, Vector3Wide(zero, zero, zero));
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::Min(const Vector3Wide& other) const {
+    return Vector3Wide(X.Min(other.X), Y.Min(other.Y), Z.Min(other.Z));
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::Max(const Vector3Wide& other) const {
+    return Vector3Wide(X.Max(other.X), Y.Max(other.Y), Z.Max(other.Z));
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::Lerp(const Vector3Wide& other,
+                                                                        const LaneT& t) const {
+    return *this + (other - *this) * t;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT> Vector3Wide<LaneT>::Select(const LaneT& mask, const Vector3Wide& ifSet,
+                                                                          const Vector3Wide& ifClear) {
+    return Vector3Wide(SIMD::Select(mask, ifSet.X, ifClear.X), SIMD::Select(mask, ifSet.Y, ifClear.Y),
+                       SIMD::Select(mask, ifSet.Z, ifClear.Z));
+}
+
+// ============================================================================
+// QuaternionWide
+// ============================================================================
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT>::QuaternionWide(const LaneT& x, const LaneT& y, const LaneT& z,
+                                                                   const LaneT& w)
+    : X(x), Y(y), Z(z), W(w) {}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT>::QuaternionWide(const Quaternion& value)
+    : X(SIMD::Splat<LaneT>(value.X)), Y(SIMD::Splat<LaneT>(value.Y)), Z(SIMD::Splat<LaneT>(value.Z)),
+      W(SIMD::Splat<LaneT>(value.W)) {}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT> QuaternionWide<LaneT>::Load(const float* x, const float* y,
+                                                                              const float* z, const float* w) {
+    return QuaternionWide(LaneT::LoadUnaligned(x), LaneT::LoadUnaligned(y), LaneT::LoadUnaligned(z),
+                          LaneT::LoadUnaligned(w));
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT> QuaternionWide<LaneT>::Load(const Quaternion* elements) {
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float));
+    QuaternionWide result;
+    SIMD::_z__Private::LoadInterleaved4(reinterpret_cast<const float*>(elements), result.X, result.Y, result.Z,
+                                        result.W);
+    return result;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE void QuaternionWide<LaneT>::Store(float* x, float* y, float* z, float* w) const {
+    X.StoreUnaligned(x);
+    Y.StoreUnaligned(y);
+    Z.StoreUnaligned(z);
+    W.StoreUnaligned(w);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE void QuaternionWide<LaneT>::Store(Quaternion* elements) const {
+    SIMD::_z__Private::StoreInterleaved4(reinterpret_cast<float*>(elements), X, Y, Z, W);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+inline Quaternion QuaternionWide<LaneT>::GetElement(const int32_t index) const {
+    alignas(64) float components[4][Width];
+    X.StoreAligned(components[0]);
+    Y.StoreAligned(components[1]);
+    Z.StoreAligned(components[2]);
+    W.StoreAligned(components[3]);
+    return Quaternion(components[0][index], components[1][index], components[2][index], components[3][index]);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+inline void QuaternionWide<LaneT>::SetElement(const int32_t index, const Quaternion& value) {
+    alignas(64) float components[4][Width];
+    X.StoreAligned(components[0]);
+    Y.StoreAligned(components[1]);
+    Z.StoreAligned(components[2]);
+    W.StoreAligned(components[3]);
+    components[0][index] = value.X;
+    components[1][index] = value.Y;
+    components[2][index] = value.Z;
+    components[3][index] = value.W;
+    X = LaneT::LoadAligned(components[0]);
+    Y = LaneT::LoadAligned(components[1]);
+    Z = LaneT::LoadAligned(components[2]);
+    W = LaneT::LoadAligned(components[3]);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT>
+QuaternionWide<LaneT>::operator*(const QuaternionWide& other) const {
+    return QuaternionWide(W * other.X + X * other.W + Y * other.Z - Z * other.Y,
+                          W * other.Y - X * other.Z + Y * other.W + Z * other.X,
+                          W * other.Z + X * other.Y - Y * other.X + Z * other.W,
+                          W * other.W - X * other.X - Y * other.Y - Z * other.Z);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT>
+QuaternionWide<LaneT>::operator+(const QuaternionWide& other) const {
+    return QuaternionWide(X + other.X, Y + other.Y, Z + other.Z, W + other.W);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT>
+QuaternionWide<LaneT>::operator-(const QuaternionWide& other) const {
+    return QuaternionWide(X - other.X, Y - other.Y, Z - other.Z, W - other.W);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT> QuaternionWide<LaneT>::operator*(const LaneT& scalar) const {
+    return QuaternionWide(X * scalar, Y * scalar, Z * scalar, W * scalar);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT> QuaternionWide<LaneT>::operator-() const {
+    const LaneT signBit = SIMD::Splat<LaneT>(-0.0f);
+    return QuaternionWide(X ^ signBit, Y ^ signBit, Z ^ signBit, W ^ signBit);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT QuaternionWide<LaneT>::Dot(const QuaternionWide& other) const {
+    return X * other.X + Y * other.Y + Z * other.Z + W * other.W;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT QuaternionWide<LaneT>::Length() const {
+    return LengthSquared().SquareRoot();
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE LaneT QuaternionWide<LaneT>::LengthSquared() const {
+    return Dot(*this);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT> QuaternionWide<LaneT>::Normalized() const {
+    const LaneT length = Length();
+    const LaneT valid = length.GreaterThan(SIMD::Splat<LaneT>(static_cast<float>(VERY_SMALL_NUMBER)));
+    return Select(valid, *this * (SIMD::Splat<LaneT>(1.0f) / length), QuaternionWide(Quaternion::Identity));
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT> QuaternionWide<LaneT>::Conjugate() const {
+    const LaneT signBit = SIMD::Splat<LaneT>(-0.0f);
+    return QuaternionWide(X ^ signBit, Y ^ signBit, Z ^ signBit, W);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT>
+QuaternionWide<LaneT>::RotateVector(const Vector3Wide<LaneT>& vec) const {
+    // v' = v + 2 * cross(q.xyz, cross(q.xyz, v) + q.w * v), as in Quaternion::RotateVector
+    const Vector3Wide<LaneT> imaginary(X, Y, Z);
+    const Vector3Wide<LaneT> cross1 = imaginary.Cross(vec);
+    const Vector3Wide<LaneT> cross2 = imaginary.Cross(cross1 + vec * W);
+    return vec + cross2 * SIMD::Splat<LaneT>(2.0f);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT>
+QuaternionWide<LaneT>::UnrotateVector(const Vector3Wide<LaneT>& vec) const {
+    return Conjugate().RotateVector(vec);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE Matrix4x4Wide<LaneT> QuaternionWide<LaneT>::ToRotationMatrix() const {
+    const LaneT zero = SIMD::Splat<LaneT>(0.0f);
+    const LaneT one = SIMD::Splat<LaneT>(1.0f);
+    const LaneT two = SIMD::Splat<LaneT>(2.0f);
+    const LaneT xx = X * X, yy = Y * Y, zz = Z * Z;
+    const LaneT xy = X * Y, xz = X * Z, yz = Y * Z;
+    const LaneT wx = W * X, wy = W * Y, wz = W * Z;
+    Matrix4x4Wide<LaneT> result;
+    result.M[0][0] = one - two * (yy + zz);
+    result.M[0][1] = two * (xy - wz);
+    result.M[0][2] = two * (xz + wy);
+    result.M[1][0] = two * (xy + wz);
+    result.M[1][1] = one - two * (xx + zz);
+    result.M[1][2] = two * (yz - wx);
+    result.M[2][0] = two * (xz - wy);
+    result.M[2][1] = two * (yz + wx);
+    result.M[2][2] = one - two * (xx + yy);
+    result.M[0][3] = result.M[1][3] = result.M[2][3] = zero;
+    result.M[3][0] = result.M[3][1] = result.M[3][2] = zero;
+    result.M[3][3] = one;
+    return result;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT> QuaternionWide<LaneT>::Nlerp(const QuaternionWide& a,
+                                                                               const QuaternionWide& b,
+                                                                               const LaneT& alpha) {
+    const LaneT oneMinusAlpha = SIMD::Splat<LaneT>(1.0f) - alpha;
+    return (a * oneMinusAlpha + b * alpha).Normalized();
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+inline QuaternionWide<LaneT> QuaternionWide<LaneT>::Slerp(const QuaternionWide& a, const QuaternionWide& b,
+                                                          const LaneT& alpha) {
+    // Flip b into the hemisphere of a by xoring the sign of the dot product into it
+    const LaneT signedDot = a.Dot(b);
+    const LaneT dotSign = signedDot & SIMD::Splat<LaneT>(-0.0f);
+    const QuaternionWide nearB(b.X ^ dotSign, b.Y ^ dotSign, b.Z ^ dotSign, b.W ^ dotSign);
+    const LaneT dot = (signedDot ^ dotSign).Min(SIMD::Splat<LaneT>(1.0f));
+
+    // sin((1 - alpha) * theta) / sin(theta) expanded to cos(alpha * theta) - cos(theta) * weightB, so one SinCos of
+    // alpha * theta gives both weights
+    const LaneT theta = SIMD::FastACos(dot);
+    LaneT sinTheta, cosTheta, sinAlphaTheta, cosAlphaTheta;
+    SIMD::SinCos(theta, sinTheta, cosTheta);
+    SIMD::SinCos(alpha * theta, sinAlphaTheta, cosAlphaTheta);
+    const LaneT weightB = sinAlphaTheta / sinTheta;
+    const LaneT weightA = cosAlphaTheta - cosTheta * weightB;
+
+    // Nearly equal inputs divide by a tiny sin(theta), those lanes take Nlerp as in Quaternion::Slerp
+    const LaneT nearlyEqual = dot.GreaterThan(SIMD::Splat<LaneT>(0.9995f));
+    return Select(nearlyEqual, Nlerp(a, nearB, alpha), a * weightA + nearB * weightB);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT> && std::is_same_v<SIMD::LaneScalarType<LaneT>, float>)
+EDVAR_CPP_CORE_FORCE_INLINE QuaternionWide<LaneT>
+QuaternionWide<LaneT>::Select(const LaneT& mask, const QuaternionWide& ifSet, const QuaternionWide& ifClear) {
+    return QuaternionWide(SIMD::Select(mask, ifSet.X, ifClear.X), SIMD::Select(mask, ifSet.Y, ifClear.Y),
+                          SIMD::Select(mask, ifSet.Z, ifClear.Z), SIMD::Select(mask, ifSet.W, ifClear.W));
+}
+
+// ============================================================================
+// Matrix4x4Wide
+// ============================================================================
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Matrix4x4Wide<LaneT>::Matrix4x4Wide(const Matrix4x4<ScalarType>& value) {
+    for (int32_t row = 0; row < 4; ++row) {
+        for (int32_t column = 0; column < 4; ++column) {
+            M[row][column] = SIMD::Splat<LaneT>(value.M[row][column]);
+        }
+    }
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+inline Matrix4x4Wide<LaneT> Matrix4x4Wide<LaneT>::Load(const Matrix4x4<ScalarType>* elements) {
+    static_assert(sizeof(Matrix4x4<ScalarType>) == 16 * sizeof(ScalarType));
+    Matrix4x4Wide result;
+    SIMD::_z__Private::LoadInterleaved16(reinterpret_cast<const ScalarType*>(elements), &result.M[0][0]);
+    return result;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+inline void Matrix4x4Wide<LaneT>::Store(Matrix4x4<ScalarType>* elements) const {
+    SIMD::_z__Private::StoreInterleaved16(&M[0][0], reinterpret_cast<ScalarType*>(elements));
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+inline Matrix4x4<SIMD::LaneScalarType<LaneT>> Matrix4x4Wide<LaneT>::GetElement(const int32_t index) const {
+    alignas(64) ScalarType lanes[Width];
+    Matrix4x4<ScalarType> result;
+    for (int32_t i = 0; i < 16; ++i) {
+        M[i / 4][i % 4].StoreAligned(lanes);
+        result.Elements[i] = lanes[index];
+    }
+    return result;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+inline void Matrix4x4Wide<LaneT>::SetElement(const int32_t index, const Matrix4x4<ScalarType>& value) {
+    alignas(64) ScalarType lanes[Width];
+    for (int32_t i = 0; i < 16; ++i) {
+        M[i / 4][i % 4].StoreAligned(lanes);
+        lanes[index] = value.Elements[i];
+        M[i / 4][i % 4] = LaneT::LoadAligned(lanes);
+    }
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Matrix4x4Wide<LaneT> Matrix4x4Wide<LaneT>::operator*(const Matrix4x4Wide& other) const {
+    Matrix4x4Wide result;
+    for (int32_t row = 0; row < 4; ++row) {
+        for (int32_t column = 0; column < 4; ++column) {
+            result.M[row][column] = M[row][0] * other.M[0][column] + M[row][1] * other.M[1][column] +
+                                    M[row][2] * other.M[2][column] + M[row][3] * other.M[3][column];
+        }
+    }
+    return result;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Matrix4x4Wide<LaneT> Matrix4x4Wide<LaneT>::Transpose() const {
+    // Each element is transposed on its own, so this only renames registers.
+    Matrix4x4Wide result;
+    for (int32_t row = 0; row < 4; ++row) {
+        for (int32_t column = 0; column < 4; ++column) {
+            result.M[row][column] = M[column][row];
+        }
+    }
+    return result;
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT>
+Matrix4x4Wide<LaneT>::TransformPoint(const Vector3Wide<LaneT>& point) const {
+    return Vector3Wide<LaneT>(M[0][0] * point.X + M[0][1] * point.Y + M[0][2] * point.Z + M[0][3],
+                              M[1][0] * point.X + M[1][1] * point.Y + M[1][2] * point.Z + M[1][3],
+                              M[2][0] * point.X + M[2][1] * point.Y + M[2][2] * point.Z + M[2][3]);
+}
+
+template <typename LaneT>
+    requires(SIMD::IsWideLaneSupported<LaneT>)
+EDVAR_CPP_CORE_FORCE_INLINE Vector3Wide<LaneT>
+Matrix4x4Wide<LaneT>::TransformVector(const Vector3Wide<LaneT>& vec) const {
+    return Vector3Wide<LaneT>(M[0][0] * vec.X + M[0][1] * vec.Y + M[0][2] * vec.Z,
+                              M[1][0] * vec.X + M[1][1] * vec.Y + M[1][2] * vec.Z,
+                              M[2][0] * vec.X + M[2][1] * vec.Y + M[2][2] * vec.Z);
+}
+} // namespace Edvar::Math
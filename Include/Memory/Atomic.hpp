@@ -33,7 +33,7 @@ public:
         mutex = &Platform::GetPlatform().GetThreading().CreateMutex();
 #endif
     }
-    Atomic(const ValueT& initialValue) : Atomic() { storage = initialValue; }
+    Atomic(const ValueT& initialValue) : Atomic() { storage = ToStorage(initialValue); }
 
     ~Atomic() {
 #if !EDVAR_MEMORY_PLATFORM_ATOMIC_SUPPORTED
@@ -44,6 +44,17 @@ public:
     ValueT Load(MemoryOrder order = MemoryOrder::SequentiallyConsistent) const;
     void Store(const ValueT& newValue, MemoryOrder order = MemoryOrder::SequentiallyConsistent);
     ValueT FetchAdd(const ValueT& value, MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+    /**
+     * @brief Replaces the value.
+     * @return The previous value.
+     */
+    ValueT Exchange(const ValueT& newValue, MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+    /**
+     * @brief Stores Desired if the current value equals Expected. Otherwise Expected receives the current value.
+     * @return true if the value was replaced.
+     */
+    bool CompareExchange(ValueT& Expected, const ValueT& Desired,
+                         MemoryOrder order = MemoryOrder::SequentiallyConsistent);
 
     operator ValueT() const { return Load(); }
     Atomic& operator=(const ValueT& newValue) {
@@ -59,6 +70,22 @@ public:
     ValueT operator-=(const ValueT& value) { return FetchAdd(-value) - value; }
 
 private:
+    // Pointers are stored as integers of the same width.
+    static StorageT ToStorage(const ValueT& value) {
+        if constexpr (std::is_pointer_v<ValueT>) {
+            return reinterpret_cast<StorageT>(value);
+        } else {
+            return static_cast<StorageT>(value);
+        }
+    }
+    static ValueT FromStorage(const StorageT value) {
+        if constexpr (std::is_pointer_v<ValueT>) {
+            return reinterpret_cast<ValueT>(value);
+        } else {
+            return static_cast<ValueT>(value);
+        }
+    }
+
     StorageT storage;
 #if !EDVAR_MEMORY_PLATFORM_ATOMIC_SUPPORTED
     // non-windows and linux systems use a simple mutex to synchronize.
@@ -87,16 +114,28 @@ struct Impl {
                             MemoryOrder order = MemoryOrder::SequentiallyConsistent);
     static int64_t FetchAdd(Atomic<int64_t>& atomic, int64_t value,
                             MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+
+    static int8_t Exchange(Atomic<int8_t>& atomic, int8_t value, MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+    static bool CompareExchange(Atomic<int8_t>& atomic, int8_t& expected, int8_t desired,
+                                MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+    static int16_t Exchange(Atomic<int16_t>& atomic, int16_t value, MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+    static bool CompareExchange(Atomic<int16_t>& atomic, int16_t& expected, int16_t desired,
+                                MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+    static int32_t Exchange(Atomic<int32_t>& atomic, int32_t value, MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+    static bool CompareExchange(Atomic<int32_t>& atomic, int32_t& expected, int32_t desired,
+                                MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+    static int64_t Exchange(Atomic<int64_t>& atomic, int64_t value, MemoryOrder order = MemoryOrder::SequentiallyConsistent);
+    static bool CompareExchange(Atomic<int64_t>& atomic, int64_t& expected, int64_t desired,
+                                MemoryOrder order = MemoryOrder::SequentiallyConsistent);
 };
 
 }; // namespace _z_private_AtomicDetails
 template <typename ValueT> inline ValueT Atomic<ValueT>::Load(MemoryOrder order) const {
-    return static_cast<ValueT>(
-        _z_private_AtomicDetails::Impl::Load(reinterpret_cast<const Atomic<StorageT>&>(*this), order));
+    return FromStorage(_z_private_AtomicDetails::Impl::Load(reinterpret_cast<const Atomic<StorageT>&>(*this), order));
 }
 
 template <typename ValueT> inline void Atomic<ValueT>::Store(const ValueT& newValue, MemoryOrder order) {
-    _z_private_AtomicDetails::Impl::Store(reinterpret_cast<Atomic<StorageT>&>(*this), newValue, order);
+    _z_private_AtomicDetails::Impl::Store(reinterpret_cast<Atomic<StorageT>&>(*this), ToStorage(newValue), order);
 }
 
 template <typename ValueT> inline ValueT Atomic<ValueT>::FetchAdd(const ValueT& value, MemoryOrder order) {
@@ -104,4 +143,18 @@ template <typename ValueT> inline ValueT Atomic<ValueT>::FetchAdd(const ValueT&
         _z_private_AtomicDetails::Impl::FetchAdd(reinterpret_cast<Atomic<StorageT>&>(*this), value, order));
 }
 
+template <typename ValueT> inline ValueT Atomic<ValueT>::Exchange(const ValueT& newValue, MemoryOrder order) {
+    return FromStorage(_z_private_AtomicDetails::Impl::Exchange(reinterpret_cast<Atomic<StorageT>&>(*this),
+                                                                ToStorage(newValue), order));
+}
+
+template <typename ValueT>
+inline bool Atomic<ValueT>::CompareExchange(ValueT& Expected, const ValueT& Desired, MemoryOrder order) {
+    StorageT expectedStorage = ToStorage(Expected);
+    const bool exchanged = _z_private_AtomicDetails::Impl::CompareExchange(
+        reinterpret_cast<Atomic<StorageT>&>(*this), expectedStorage, ToStorage(Desired), order);
+    Expected = FromStorage(expectedStorage);
+    return exchanged;
+}
+
 } // namespace Edvar::Memory
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Memory/Atomic.hpp"
+
+namespace Edvar::Memory {
+namespace _z__Private {
+struct BiasedReferenceQueue;
+struct BiasedThreadState;
+EDVAR_CPP_CORE_API int64_t AcquireThreadToken();
+// Unique per thread and never reused, unlike OS thread ids.
+inline thread_local const int64_t CurrentThreadToken = AcquireThreadToken();
+} // namespace _z__Private
+
+/**
+ * @brief Biased reference count: the thread that created the object (the owner) counts with plain integer operations,
+ * every other thread uses an atomic shared count.
+ *
+ * The owner's references together hold the object alive; when the owner drops its last reference the two counts are
+ * merged and the object becomes an ordinary atomic count. Other threads may release references the owner handed out,
+ * which drives the shared count below zero. The object is then queued to the owner, which merges it at its next
+ * quiescent point (FlushBiasedReferenceCounts). If the owner thread has exited, the releasing thread merges it
+ * directly.
+ *
+ * Decrements on non-owner threads can additionally be deferred with ScopedDeferredReleases, they are then batched per
+ * object and applied at the thread's next quiescent point.
+ */
+class EDVAR_CPP_CORE_API BiasedReferenceCount {
+public:
+    /** Called when a merge outside of a reference release finds the count at zero. Must destroy the object. */
+    using DestroyFunctionType = void (*)(BiasedReferenceCount*);
+
+    explicit BiasedReferenceCount(DestroyFunctionType InDestroyObject);
+    ~BiasedReferenceCount();
+    BiasedReferenceCount(const BiasedReferenceCount&) = delete;
+    BiasedReferenceCount& operator=(const BiasedReferenceCount&) = delete;
+
+    /**
+     * @brief Adds Delta (+1 or -1) references from the calling thread.
+     * @return Same contract as a fetch-add on a plain count: 0 on increment means the object was already dead, 1 on
+     * decrement means the caller released the last reference and must destroy the object.
+     */
+    int FetchAdd(const int Delta) {
+        if (IsOwnedByCurrentThread()) {
+            const int prev = biasedCount;
+            biasedCount += Delta;
+            if (biasedCount == 0) {
+                return MergeFromOwner();
+            }
+            return prev;
+        }
+        return SharedFetchAdd(Delta);
+    }
+
+    /** @return A positive value while the object is alive, the exact count only once merged. */
+    [[nodiscard]] int Load() const;
+
+private:
+    static constexpr int32_t MergedFlag = 1;
+    static constexpr int32_t QueuedFlag = 2;
+    static constexpr int32_t CountShift = 2;
+
+    // Checks the token first, so other threads never read ownerMerged.
+    [[nodiscard]] bool IsOwnedByCurrentThread() const {
+        return ownerToken == _z__Private::CurrentThreadToken && !ownerMerged;
+    }
+
+    int MergeFromOwner();
+    int SharedFetchAdd(int Delta);
+    /** @return true if the count reached zero and the caller must destroy the object. */
+    bool SharedRelease(int32_t Count);
+    void Merge();
+
+    const int64_t ownerToken;
+    // Owner thread only.
+    int32_t biasedCount = 1;
+    bool ownerMerged = false;
+    // count << CountShift | flags
+    Atomic<int32_t> shared;
+    BiasedReferenceCount* queueNext = nullptr;
+    _z__Private::BiasedReferenceQueue* ownerQueue;
+    DestroyFunctionType destroyObject;
+
+    friend struct _z__Private::BiasedReferenceQueue;
+    friend struct _z__Private::BiasedThreadState;
+};
+
+/**
+ * @brief Quiescent point for the calling thread: merges biased counts queued to it by other threads and applies its
+ * deferred releases. Call it where the thread holds no references it is about to use, e.g. between jobs.
+ */
+EDVAR_CPP_CORE_API void FlushBiasedReferenceCounts();
+
+/**
+ * @brief While alive, releases of biased references from non-owner threads on this thread are deferred until the next
+ * FlushBiasedReferenceCounts call on this thread.
+ */
+class EDVAR_CPP_CORE_API ScopedDeferredReleases {
+public:
+    ScopedDeferredReleases();
+    ~ScopedDeferredReleases();
+    ScopedDeferredReleases(const ScopedDeferredReleases&) = delete;
+    ScopedDeferredReleases& operator=(const ScopedDeferredReleases&) = delete;
+};
+} // namespace Edvar::Memory
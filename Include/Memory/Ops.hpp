@@ -1,38 +1,131 @@
 #pragma once
 #include <cstdint>
+#include <cstring>
 
 namespace Edvar::Memory {
-template <typename T> inline void ZeroMemory(T* Ptr, uint64_t Count) {
-    auto* BytePtr = reinterpret_cast<unsigned char*>(Ptr);
-    for (uint64_t i = 0; i < Count * sizeof(T); ++i) {
-        BytePtr[i] = 0;
+namespace _z__Private {
+// Sizes up to this are handled inline, constant sizes fold to a couple of moves.
+inline constexpr uint64_t InlineOpsSize = 16;
+
+// Vectorised implementations for sizes above InlineOpsSize.
+EDVAR_CPP_CORE_API void CopyBytes(unsigned char* Dest, const unsigned char* Src, uint64_t Size);
+EDVAR_CPP_CORE_API void SetBytes(unsigned char* Dest, uint8_t Value, uint64_t Size);
+EDVAR_CPP_CORE_API int32_t CompareBytes(const unsigned char* Ptr1, const unsigned char* Ptr2, uint64_t Size);
+
+template <typename WordT> EDVAR_CPP_CORE_FORCE_INLINE WordT LoadWord(const unsigned char* Ptr) {
+    WordT word;
+    std::memcpy(&word, Ptr, sizeof(WordT));
+    return word;
+}
+template <typename WordT> EDVAR_CPP_CORE_FORCE_INLINE void StoreWord(unsigned char* Ptr, const WordT Word) {
+    std::memcpy(Ptr, &Word, sizeof(WordT));
+}
+
+// Two overlapping words, the head and the tail, cover any size from the word size to twice of it.
+template <typename WordT>
+EDVAR_CPP_CORE_FORCE_INLINE void CopyHeadTail(unsigned char* Dest, const unsigned char* Src, const uint64_t Size) {
+    const WordT head = LoadWord<WordT>(Src);
+    const WordT tail = LoadWord<WordT>(Src + Size - sizeof(WordT));
+    StoreWord(Dest, head);
+    StoreWord(Dest + Size - sizeof(WordT), tail);
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void CopySmall(unsigned char* Dest, const unsigned char* Src, const uint64_t Size) {
+    if (Size >= 8) {
+        CopyHeadTail<uint64_t>(Dest, Src, Size);
+    } else if (Size >= 4) {
+        CopyHeadTail<uint32_t>(Dest, Src, Size);
+    } else if (Size >= 2) {
+        CopyHeadTail<uint16_t>(Dest, Src, Size);
+    } else if (Size == 1) {
+        *Dest = *Src;
+    }
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE void SetSmall(unsigned char* Dest, const uint8_t Value, const uint64_t Size) {
+    const uint64_t word = 0x0101010101010101ull * Value;
+    if (Size >= 8) {
+        StoreWord(Dest, word);
+        StoreWord(Dest + Size - 8, word);
+    } else if (Size >= 4) {
+        StoreWord(Dest, static_cast<uint32_t>(word));
+        StoreWord(Dest + Size - 4, static_cast<uint32_t>(word));
+    } else if (Size >= 2) {
+        StoreWord(Dest, static_cast<uint16_t>(word));
+        StoreWord(Dest + Size - 2, static_cast<uint16_t>(word));
+    } else if (Size == 1) {
+        *Dest = Value;
+    }
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE int32_t CompareBytewise(const unsigned char* Ptr1, const unsigned char* Ptr2,
+                                                    const uint64_t Size) {
+    for (uint64_t i = 0; i < Size; ++i) {
+        if (Ptr1[i] != Ptr2[i]) {
+            return static_cast<int32_t>(Ptr1[i]) - static_cast<int32_t>(Ptr2[i]);
+        }
+    }
+    return 0;
+}
+
+template <typename WordT>
+EDVAR_CPP_CORE_FORCE_INLINE int32_t CompareHeadTail(const unsigned char* Ptr1, const unsigned char* Ptr2,
+                                                    const uint64_t Size) {
+    // Words are only compared for equality, the ordering comes from the bytes of the first differing word.
+    if (LoadWord<WordT>(Ptr1) != LoadWord<WordT>(Ptr2)) {
+        return CompareBytewise(Ptr1, Ptr2, sizeof(WordT));
+    }
+    const uint64_t tail = Size - sizeof(WordT);
+    if (LoadWord<WordT>(Ptr1 + tail) != LoadWord<WordT>(Ptr2 + tail)) {
+        return CompareBytewise(Ptr1 + tail, Ptr2 + tail, sizeof(WordT));
+    }
+    return 0;
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE int32_t CompareSmall(const unsigned char* Ptr1, const unsigned char* Ptr2,
+                                                 const uint64_t Size) {
+    if (Size >= 8) {
+        return CompareHeadTail<uint64_t>(Ptr1, Ptr2, Size);
+    }
+    if (Size >= 4) {
+        return CompareHeadTail<uint32_t>(Ptr1, Ptr2, Size);
     }
+    return CompareBytewise(Ptr1, Ptr2, Size);
 }
+} // namespace _z__Private
 
+/** @brief Copies Count elements bytewise. The ranges must not overlap. */
 template <typename T> inline void CopyMemory(T* Dest, const T* Src, uint64_t Count) {
     auto* DestBytePtr = reinterpret_cast<unsigned char*>(Dest);
     const auto* SrcBytePtr = reinterpret_cast<const unsigned char*>(Src);
-    for (uint64_t i = 0; i < Count * sizeof(T); ++i) {
-        DestBytePtr[i] = SrcBytePtr[i];
+    const uint64_t size = Count * sizeof(T);
+    if (size <= _z__Private::InlineOpsSize) {
+        _z__Private::CopySmall(DestBytePtr, SrcBytePtr, size);
+    } else {
+        _z__Private::CopyBytes(DestBytePtr, SrcBytePtr, size);
     }
 }
 
 template <typename T> inline void SetMemory(T* Ptr, uint8_t Value, uint64_t Count) {
     auto* BytePtr = reinterpret_cast<unsigned char*>(Ptr);
-    for (uint64_t i = 0; i < Count * sizeof(T); ++i) {
-        BytePtr[i] = Value;
+    const uint64_t size = Count * sizeof(T);
+    if (size <= _z__Private::InlineOpsSize) {
+        _z__Private::SetSmall(BytePtr, Value, size);
+    } else {
+        _z__Private::SetBytes(BytePtr, Value, size);
     }
 }
 
+template <typename T> inline void ZeroMemory(T* Ptr, uint64_t Count) { SetMemory(Ptr, 0, Count); }
+
 template <typename T> inline int32_t CompareMemory(const T* Ptr1, const T* Ptr2, uint64_t Count) {
     const auto* BytePtr1 = reinterpret_cast<const unsigned char*>(Ptr1);
     const auto* BytePtr2 = reinterpret_cast<const unsigned char*>(Ptr2);
-    for (uint64_t i = 0; i < Count * sizeof(T); ++i) {
-        if (BytePtr1[i] != BytePtr2[i]) {
-            return static_cast<int32_t>(BytePtr1[i]) - static_cast<int32_t>(BytePtr2[i]);
-        }
+    const uint64_t size = Count * sizeof(T);
+    if (size <= _z__Private::InlineOpsSize) {
+        return _z__Private::CompareSmall(BytePtr1, BytePtr2, size);
     }
-    return 0;
+    return _z__Private::CompareBytes(BytePtr1, BytePtr2, size);
 }
 
-} // namespace Edvar::Memory
\ No newline at end of file
+} // namespace Edvar::Memory
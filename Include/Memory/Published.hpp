@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Memory/Reclamation.hpp"
+#include "Threading/Mutex.hpp"
+
+namespace Edvar::Memory {
+/**
+ * @brief Read-copy-update cell for read-mostly data.
+ *
+ * Readers take a Snapshot: one acquire load inside an epoch critical section, no lock and no shared write. Writers
+ * serialize on a mutex, modify a copy of the current value and publish it with a single store; the replaced version
+ * is retired to the epoch domain and freed once no snapshot can reference it anymore.
+ *
+ * Snapshots must be short-lived, a snapshot held for long keeps every later replaced version alive.
+ */
+template <typename T> class Published {
+public:
+    class Snapshot {
+    public:
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+
+        const T& operator*() const { return *value; }
+        const T* operator->() const { return value; }
+        const T* Get() const { return value; }
+
+    private:
+        Snapshot(EpochDomain& Domain, const Atomic<T*>& Source)
+            : guard(Domain), value(Source.Load(MemoryOrder::Acquire)) {}
+
+        EpochGuard guard;
+        const T* value;
+
+        friend class Published;
+    };
+
+    explicit Published(EpochDomain& InDomain = EpochDomain::Global()) : current(new T()), domain(InDomain) {}
+    explicit Published(T InitialValue, EpochDomain& InDomain = EpochDomain::Global())
+        : current(new T(std::move(InitialValue))), domain(InDomain) {}
+    /** No snapshot may be alive anymore. */
+    ~Published() { delete current.Load(MemoryOrder::Acquire); }
+    Published(const Published&) = delete;
+    Published& operator=(const Published&) = delete;
+
+    /** @return The current version, valid for the lifetime of the snapshot. */
+    Snapshot Read() const { return Snapshot(domain, current); }
+
+    /**
+     * @brief Copies the current version, lets Modify change the copy and publishes it.
+     * @param Modify Called with the copy while the writer lock is held, must not call Update on the same cell.
+     */
+    template <typename FunctionT> void Update(FunctionT&& Modify) {
+        Threading::ScopedLock lock(writerMutex);
+        T* copy = new T(*current.Load(MemoryOrder::Relaxed));
+        std::forward<FunctionT>(Modify)(*copy);
+        Replace(copy);
+    }
+
+    /** @brief Publishes NewValue in place of the current version. */
+    void Publish(T NewValue) {
+        Threading::ScopedLock lock(writerMutex);
+        Replace(new T(std::move(NewValue)));
+    }
+
+    /**
+     * @brief Publishes NewValue and waits until no snapshot of the replaced version is left, instead of retiring it.
+     *
+     * For values whose destruction must happen at a known point, like the last reference to a resource. Must not be
+     * called while the calling thread holds a snapshot.
+     *
+     * @return The replaced version, no reader can see it anymore.
+     */
+    T Exchange(T NewValue) {
+        T* previous;
+        {
+            Threading::ScopedLock lock(writerMutex);
+            previous = current.Exchange(new T(std::move(NewValue)), MemoryOrder::AcquireAndRelease);
+        }
+        domain.Synchronize();
+        T result = std::move(*previous);
+        delete previous;
+        return result;
+    }
+
+private:
+    void Replace(T* NewVersion) {
+        T* previous = current.Exchange(NewVersion, MemoryOrder::AcquireAndRelease);
+        domain.Retire(previous);
+    }
+
+    Atomic<T*> current;
+    EpochDomain& domain;
+    Threading::Mutex writerMutex;
+};
+} // namespace Edvar::Memory
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "Memory/Atomic.hpp"
+
+namespace Edvar::Memory {
+/** Frees a retired object once no reader can reference it anymore. */
+using RetireDeleterType = void (*)(void*);
+
+namespace _z__Private {
+struct EpochDomainState;
+struct HazardDomainState;
+
+template <typename T> void DeleteRetired(void* Ptr) { delete static_cast<T*>(Ptr); }
+
+struct HazardRecord {
+    Atomic<void*> Pointer{nullptr};
+    Atomic<int32_t> InUse{0};
+    // Records are never unlinked, only reused, so readers of the list need no protection.
+    HazardRecord* Next = nullptr;
+};
+} // namespace _z__Private
+
+/**
+ * @brief Epoch based reclamation domain.
+ *
+ * Readers enter a critical section with EpochGuard, which only publishes the current epoch in a slot owned by the
+ * calling thread, no shared cache line is written. Writers unlink objects and Retire them; a retired object is freed
+ * once the global epoch moved twice past the epoch it was retired in, which guarantees every reader that could still
+ * see it has left its critical section.
+ *
+ * Retired objects are kept in per-thread lists and freed by the retiring thread. Batches that cannot be freed because
+ * a reader is stalled are handed to the domain and freed by Reclaim, which ThreadPool workers call between jobs.
+ * A domain must outlive every thread that used it.
+ */
+class EDVAR_CPP_CORE_API EpochDomain {
+public:
+    EpochDomain();
+    /** Frees everything still retired, no thread may use the domain anymore. */
+    ~EpochDomain();
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    static EpochDomain& Global();
+
+    /** @brief Enters a read-side critical section. Nests. */
+    void Enter();
+    void Leave();
+
+    /** @brief Frees Ptr with Deleter once no critical section that could have seen it is active anymore. */
+    void Retire(void* Ptr, RetireDeleterType Deleter);
+    template <typename T> void Retire(T* Ptr) { Retire(Ptr, &_z__Private::DeleteRetired<T>); }
+
+    /**
+     * @brief Advances the global epoch if every thread inside a critical section observed the current one.
+     * @return true if the epoch was advanced, by this or another thread.
+     */
+    bool TryAdvance();
+
+    /**
+     * @brief Advances the epoch and frees what became safe, including batches handed over by other threads. Must not
+     * be called inside a critical section of this domain.
+     */
+    void Reclaim();
+
+    /**
+     * @brief Waits until every critical section active at the call has been left, so nothing unlinked before the call
+     * can still be read. Yields while readers are pending. Must not be called inside a critical section of this
+     * domain.
+     */
+    void Synchronize();
+
+    [[nodiscard]] int64_t GetEpoch() const { return globalEpoch.Load(MemoryOrder::Acquire); }
+
+private:
+    Atomic<int64_t> globalEpoch;
+    _z__Private::EpochDomainState* state;
+};
+
+/** @brief Scoped read-side critical section of an EpochDomain. */
+class EpochGuard {
+public:
+    explicit EpochGuard(EpochDomain& InDomain = EpochDomain::Global()) : domain(InDomain) { domain.Enter(); }
+    ~EpochGuard() { domain.Leave(); }
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+
+private:
+    EpochDomain& domain;
+};
+
+/**
+ * @brief Hazard pointer domain.
+ *
+ * Unlike epochs, a hazard pointer protects a single object, so a stalled reader only delays freeing the objects it
+ * actually holds. Retired objects are kept per thread and freed by a scan once enough accumulated; a scan frees every
+ * object that no hazard pointer currently protects.
+ * A domain must outlive every thread that used it.
+ */
+class EDVAR_CPP_CORE_API HazardPointerDomain {
+public:
+    HazardPointerDomain();
+    /** Frees everything still retired, no thread may use the domain anymore. */
+    ~HazardPointerDomain();
+    HazardPointerDomain(const HazardPointerDomain&) = delete;
+    HazardPointerDomain& operator=(const HazardPointerDomain&) = delete;
+
+    static HazardPointerDomain& Global();
+
+    /** @brief Frees Ptr with Deleter once no hazard pointer protects it. */
+    void Retire(void* Ptr, RetireDeleterType Deleter);
+    template <typename T> void Retire(T* Ptr) { Retire(Ptr, &_z__Private::DeleteRetired<T>); }
+
+    /** @brief Scans the calling thread's retired objects and the ones handed over by exited threads. */
+    void Reclaim();
+
+private:
+    _z__Private::HazardRecord* AcquireRecord();
+    void ReleaseRecord(_z__Private::HazardRecord* Record);
+
+    Atomic<_z__Private::HazardRecord*> records;
+    Atomic<int32_t> recordCount;
+    _z__Private::HazardDomainState* state;
+
+    friend class HazardPointer;
+};
+
+/**
+ * @brief One hazard pointer slot, owned by the calling thread for its lifetime. Slots are cached per thread, so
+ * creating one is cheap after the first.
+ */
+class EDVAR_CPP_CORE_API HazardPointer {
+public:
+    explicit HazardPointer(HazardPointerDomain& InDomain = HazardPointerDomain::Global());
+    ~HazardPointer();
+    HazardPointer(const HazardPointer&) = delete;
+    HazardPointer& operator=(const HazardPointer&) = delete;
+
+    /**
+     * @brief Loads Source and protects the loaded object.
+     * @return The object, safe to use until the hazard pointer is cleared or reassigned.
+     */
+    template <typename T> T* Protect(const Atomic<T*>& Source) {
+        T* ptr = Source.Load(MemoryOrder::Acquire);
+        while (true) {
+            Set(ptr);
+            // The object may have been retired before the hazard was visible, a stable source proves it was not.
+            T* reloaded = Source.Load(MemoryOrder::Acquire);
+            if (reloaded == ptr) {
+                return ptr;
+            }
+            ptr = reloaded;
+        }
+    }
+
+    void Set(const void* Ptr) { record->Pointer.Store(const_cast<void*>(Ptr), MemoryOrder::SequentiallyConsistent); }
+    void Clear() { record->Pointer.Store(nullptr, MemoryOrder::Release); }
+
+private:
+    HazardPointerDomain& domain;
+    _z__Private::HazardRecord* record;
+};
+} // namespace Edvar::Memory
@@ -0,0 +1,83 @@
+#pragma once
+
+namespace Edvar::Memory {
+/**
+ * @brief Per-thread stack allocator for short-lived buffers such as string conversions and formatting.
+ *
+ * Allocations bump an offset in the current block and are never freed one by one, a ScratchMarker rewinds the stack
+ * to where it was when the marker was created. Rewinding keeps the blocks, so once a thread's scratch stack has grown
+ * to its working size, scratch allocations no longer touch the global allocator. Scratch memory must not outlive the
+ * innermost marker alive when it was allocated, and must not be handed to another thread.
+ */
+class EDVAR_CPP_CORE_API ScratchAllocator {
+public:
+    static constexpr uint64_t DefaultBlockSize = 64 * 1024;
+
+    /** @return The calling thread's scratch allocator. */
+    static ScratchAllocator& Get();
+
+    ScratchAllocator() = default;
+    ~ScratchAllocator();
+    ScratchAllocator(const ScratchAllocator&) = delete;
+    ScratchAllocator& operator=(const ScratchAllocator&) = delete;
+
+    /** @param Alignment A power of two. */
+    void* Allocate(const uint64_t Size, const uint64_t Alignment = alignof(std::max_align_t)) {
+        if (current != nullptr) [[likely]] {
+            const uintptr_t data = reinterpret_cast<uintptr_t>(current->GetData());
+            const uint64_t alignedOffset = ((data + offset + Alignment - 1) & ~(Alignment - 1)) - data;
+            if (alignedOffset + Size <= current->Size) [[likely]] {
+                offset = alignedOffset + Size;
+                return current->GetData() + alignedOffset;
+            }
+        }
+        return AllocateSlow(Size, Alignment);
+    }
+
+    /** @return Uninitialized storage for Count objects, their destructors never run. */
+    template <typename T> T* AllocateArray(const int32_t Count) {
+        static_assert(std::is_trivially_destructible_v<T>, "Scratch memory is released without running destructors.");
+        return static_cast<T*>(Allocate(sizeof(T) * static_cast<uint64_t>(Count), alignof(T)));
+    }
+
+private:
+    friend class ScratchMarker;
+
+    struct alignas(std::max_align_t) Block {
+        Block* Next;
+        uint64_t Size;
+        unsigned char* GetData() { return reinterpret_cast<unsigned char*>(this + 1); }
+    };
+
+    /** Moves to the next kept block, or chains a new one when that is too small. */
+    void* AllocateSlow(uint64_t Size, uint64_t Alignment);
+
+    Block* first = nullptr;
+    Block* current = nullptr;
+    uint64_t offset = 0;
+};
+
+/**
+ * @brief Releases everything allocated from a scratch allocator after the marker was created, when the marker goes
+ * out of scope. Markers must be destroyed in reverse order of creation.
+ */
+class ScratchMarker {
+public:
+    ScratchMarker() : ScratchMarker(ScratchAllocator::Get()) {}
+    explicit ScratchMarker(ScratchAllocator& InAllocator)
+        : allocator(InAllocator), block(InAllocator.current), offset(InAllocator.offset) {}
+    ~ScratchMarker() {
+        allocator.current = block;
+        allocator.offset = offset;
+    }
+    ScratchMarker(const ScratchMarker&) = delete;
+    ScratchMarker& operator=(const ScratchMarker&) = delete;
+
+    [[nodiscard]] ScratchAllocator& GetAllocator() const { return allocator; }
+
+private:
+    ScratchAllocator& allocator;
+    ScratchAllocator::Block* block;
+    uint64_t offset;
+};
+} // namespace Edvar::Memory
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Memory/Atomic.hpp"
+#include "Memory/BiasedReferenceCounting.hpp"
 
 namespace Edvar::Memory {
 template <typename T, bool ThreadSafe = false> class SharedPointer;
@@ -15,6 +16,11 @@ struct EnableSharedFromThisBase {
 template <typename T, typename = void> struct is_complete : std::false_type {};
 template <typename T> struct is_complete<T, std::void_t<decltype(sizeof(T))>> : std::true_type {};
 template <typename T> inline constexpr bool is_complete_v = is_complete<T>::value;
+// Only thread safe counters can be biased, the others don't pay for the pointer.
+template <bool ThreadSafe> struct ReferenceCounterBiasedState {};
+template <> struct ReferenceCounterBiasedState<true> {
+    BiasedReferenceCount* BiasedCount = nullptr;
+};
 // SFINAE-safe helper: first check completeness, then check base-of relationship.
 template <typename T> constexpr bool is_derived_from_EnableSharedFromThisBase() {
     if constexpr (!is_complete_v<T>) {
@@ -25,10 +31,20 @@ template <typename T> constexpr bool is_derived_from_EnableSharedFromThisBase()
 }
 } // namespace _z__Private
 
-template <bool ThreadSafe = false> class ReferenceCounter {
+/**
+ * @brief Hard and weak reference counts of a shared object.
+ *
+ * While any hard reference exists the weak count holds one extra reference on their behalf, so the counter is released
+ * exactly once: by whichever of the last hard or the last weak reference goes away last.
+ */
+template <bool ThreadSafe = false>
+class ReferenceCounter : protected _z__Private::ReferenceCounterBiasedState<ThreadSafe> {
 public:
     enum class ZeroCounterTag { Tag };
-    ReferenceCounter() : HardCounter(1), WeakCounter(0) {}
+    enum class InlineBlockOperation { DestroyObject, Free };
+    // Knows the type of an inline object, so pointers to incomplete or base types can still destroy and free it
+    using InlineBlockFunctionType = void (*)(ReferenceCounter*, InlineBlockOperation);
+    ReferenceCounter() : HardCounter(1), WeakCounter(1) {}
     ReferenceCounter(ZeroCounterTag type) : HardCounter(0), WeakCounter(0) {}
     ReferenceCounter(int hardCount, int weakCount) : HardCounter(hardCount), WeakCounter(weakCount) {}
     ~ReferenceCounter() = default;
@@ -54,15 +70,49 @@ public:
     int GetHardCount() const { return LoadHard(); }
 
     // Atomic-aware fetch/add helpers. Return the previous value.
-    int FetchAddHard(int delta) { return FetchAddImpl(HardCounter, delta); }
+    int FetchAddHard(int delta) {
+        if constexpr (ThreadSafe) {
+            if (this->BiasedCount != nullptr) {
+                return this->BiasedCount->FetchAdd(delta);
+            }
+        }
+        return FetchAddImpl(HardCounter, delta);
+    }
     int FetchAddWeak(int delta) { return FetchAddImpl(WeakCounter, delta); }
 
-    int LoadHard() const { return LoadImpl(HardCounter); }
+    int LoadHard() const {
+        if constexpr (ThreadSafe) {
+            if (this->BiasedCount != nullptr) {
+                return this->BiasedCount->Load();
+            }
+        }
+        return LoadImpl(HardCounter);
+    }
     int LoadWeak() const { return LoadImpl(WeakCounter); }
 
     void IncrementWeak() { ++WeakCounter; }
     void DecrementWeak() { --WeakCounter; }
-    int GetWeakCount() const { return LoadWeak(); }
+    /** @return Number of weak references, excluding the one held on behalf of the hard references. */
+    int GetWeakCount() const { return LoadWeak() - (LoadHard() > 0 ? 1 : 0); }
+
+    /** @return true if the managed object lives inside the counter's allocation (see MakeShared). */
+    [[nodiscard]] bool IsObjectInline() const { return InlineBlockFunction != nullptr; }
+    /** @brief Runs the destructor of an inline object, its storage stays allocated until Release. */
+    void DestroyInlineObject() { InlineBlockFunction(this, InlineBlockOperation::DestroyObject); }
+    /**
+     * @brief Frees the counter, and the storage of the managed object if it was allocated along with it.
+     */
+    void Release() {
+        if (InlineBlockFunction != nullptr) {
+            InlineBlockFunction(this, InlineBlockOperation::Free);
+        } else {
+            delete this;
+        }
+    }
+
+protected:
+    // Set by counters that own the object's storage
+    InlineBlockFunctionType InlineBlockFunction = nullptr;
 
 private:
     using CounterValueType = std::conditional_t<ThreadSafe, Memory::Atomic<int>, int>;
@@ -88,6 +138,68 @@ private:
     }
 };
 
+namespace _z__Private {
+/**
+ * Counter with the managed object stored right behind it, one allocation and usually one cache line for both.
+ */
+template <typename T, bool ThreadSafe> class InlineReferenceCounter final : public ReferenceCounter<ThreadSafe> {
+public:
+    template <typename... ArgsT> explicit InlineReferenceCounter(ArgsT&&... args) {
+        this->InlineBlockFunction = &InlineReferenceCounter::ManageBlock;
+        new (Storage) T(std::forward<ArgsT>(args)...);
+    }
+    T* GetObject() { return std::launder(reinterpret_cast<T*>(Storage)); }
+
+private:
+    using OperationType = typename ReferenceCounter<ThreadSafe>::InlineBlockOperation;
+
+    static void ManageBlock(ReferenceCounter<ThreadSafe>* counter, const OperationType operation) {
+        auto* self = static_cast<InlineReferenceCounter*>(counter);
+        if (operation == OperationType::DestroyObject) {
+            self->GetObject()->~T();
+        } else {
+            // The object was already destroyed by the last hard reference.
+            delete self;
+        }
+    }
+    alignas(T) unsigned char Storage[sizeof(T)];
+};
+
+/**
+ * Thread safe inline counter whose hard count is biased towards the creating thread, see BiasedReferenceCount.
+ */
+template <typename T>
+class BiasedInlineReferenceCounter final : public ReferenceCounter<true>, public BiasedReferenceCount {
+public:
+    template <typename... ArgsT>
+    explicit BiasedInlineReferenceCounter(ArgsT&&... args) : BiasedReferenceCount(&DestroyAfterMerge) {
+        this->InlineBlockFunction = &BiasedInlineReferenceCounter::ManageBlock;
+        this->ReferenceCounter<true>::BiasedCount = this;
+        new (Storage) T(std::forward<ArgsT>(args)...);
+    }
+    T* GetObject() { return std::launder(reinterpret_cast<T*>(Storage)); }
+
+private:
+    static void ManageBlock(ReferenceCounter<true>* counter, const InlineBlockOperation operation) {
+        auto* self = static_cast<BiasedInlineReferenceCounter*>(counter);
+        if (operation == InlineBlockOperation::DestroyObject) {
+            self->GetObject()->~T();
+        } else {
+            delete self;
+        }
+    }
+    // The last reference went away during a merge, not through a pointer that could destroy the object.
+    static void DestroyAfterMerge(BiasedReferenceCount* count) {
+        auto* self = static_cast<BiasedInlineReferenceCounter*>(count);
+        self->GetObject()->~T();
+        if (self->FetchAddWeak(-1) == 1) {
+            self->Release();
+        }
+    }
+    alignas(T) unsigned char Storage[sizeof(T)];
+};
+} // namespace _z__Private
+
 template <typename ValueT, bool ThreadSafe> class ReferenceCountedPointerBase {
 public:
     virtual ~ReferenceCountedPointerBase() = default;
@@ -103,27 +215,32 @@ public:
         if (this->Counter == nullptr) {
             return;
         }
+        ReferenceCounter<ThreadSafe>* counter = this->Counter;
         if constexpr (UsesHardCounter) {
-            int prev = this->Counter->FetchAddHard(-1);
+            int prev = counter->FetchAddHard(-1);
             if (prev <= 0) {
                 Platform::GetPlatform().OnFatalError(u"ReferenceCounter underflow (hard)");
             }
             if (prev == 1) {
-                // last hard reference; destroy managed object
-                delete this->managedObject;
-                if (this->Counter->LoadWeak() == 0) {
-                    delete this->Counter;
+                // last hard reference; destroy managed object. `this` may be owned by the object, don't touch it
+                // after this point.
+                if (counter->IsObjectInline()) {
+                    counter->DestroyInlineObject();
+                } else {
+                    delete this->managedObject;
+                }
+                // drop the weak reference held on behalf of the hard references
+                if (counter->FetchAddWeak(-1) == 1) {
+                    counter->Release();
                 }
             }
         } else {
-            int prev = this->Counter->FetchAddWeak(-1);
+            int prev = counter->FetchAddWeak(-1);
             if (prev <= 0) {
                 Platform::GetPlatform().OnFatalError(u"ReferenceCounter underflow (weak)");
             }
             if (prev == 1) {
-                if (this->Counter->LoadHard() == 0) {
-                    delete this->Counter;
-                }
+                counter->Release();
             }
         }
     }
@@ -519,6 +636,129 @@ private:
     T* ptr;
 };
 
+/**
+ * @brief Base for objects that carry their own reference count, for use with IntrusivePtr.
+ * @tparam ThreadSafe Whether the count is changed atomically.
+ *
+ * Compared to SharedPointer there is no separate counter and no weak references: the pointer is a single raw pointer
+ * and the count shares the object's cache line. An IntrusivePtr can be recreated from a raw pointer at any time.
+ */
+template <bool ThreadSafe = false> class IntrusiveRefCounted {
+public:
+    void AddReference() const {
+        if constexpr (ThreadSafe) {
+            referenceCount.FetchAdd(1, MemoryOrder::Relaxed);
+        } else {
+            ++referenceCount;
+        }
+    }
+    /**
+     * @return true if this was the last reference and the object should be destroyed.
+     */
+    bool ReleaseReference() const {
+        int32_t prev;
+        if constexpr (ThreadSafe) {
+            prev = referenceCount.FetchAdd(-1, MemoryOrder::AcquireAndRelease);
+        } else {
+            prev = referenceCount--;
+        }
+        if (prev <= 0) [[unlikely]] {
+            Platform::GetPlatform().OnFatalError(u"IntrusiveRefCounted: reference count underflow");
+        }
+        return prev == 1;
+    }
+    [[nodiscard]] int32_t GetReferenceCount() const {
+        if constexpr (ThreadSafe) {
+            return referenceCount.Load(MemoryOrder::Acquire);
+        } else {
+            return referenceCount;
+        }
+    }
+
+protected:
+    IntrusiveRefCounted() : referenceCount(0) {}
+    // A copy is a new object, it does not inherit the references of the original.
+    IntrusiveRefCounted(const IntrusiveRefCounted&) : referenceCount(0) {}
+    IntrusiveRefCounted& operator=(const IntrusiveRefCounted&) { return *this; }
+    ~IntrusiveRefCounted() = default;
+
+private:
+    mutable std::conditional_t<ThreadSafe, Memory::Atomic<int32_t>, int32_t> referenceCount;
+};
+
+/**
+ * @brief Owning pointer to an object deriving from IntrusiveRefCounted. Deletes the object with the last reference.
+ */
+template <typename T> class IntrusivePtr {
+public:
+    IntrusivePtr() : ptr(nullptr) {}
+    IntrusivePtr(nullptr_t) : ptr(nullptr) {}
+    IntrusivePtr(T* object) : ptr(object) {
+        if (ptr != nullptr) {
+            ptr->AddReference();
+        }
+    }
+    IntrusivePtr(const IntrusivePtr& other) : IntrusivePtr(other.ptr) {}
+    IntrusivePtr(IntrusivePtr&& other) noexcept : ptr(other.ptr) { other.ptr = nullptr; }
+    template <typename OtherT>
+    IntrusivePtr(const IntrusivePtr<OtherT>& other)
+        requires(std::is_convertible_v<OtherT*, T*>)
+        : IntrusivePtr(static_cast<T*>(other.Get())) {}
+    template <typename OtherT>
+    IntrusivePtr(IntrusivePtr<OtherT>&& other) noexcept
+        requires(std::is_convertible_v<OtherT*, T*>)
+        : ptr(static_cast<T*>(other.ReleaseOwnership())) {}
+    ~IntrusivePtr() { Reset(); }
+
+    IntrusivePtr& operator=(const IntrusivePtr& other) {
+        // add before release so self assignment can not destroy the object
+        IntrusivePtr(other).Swap(*this);
+        return *this;
+    }
+    IntrusivePtr& operator=(IntrusivePtr&& other) noexcept {
+        IntrusivePtr(std::move(other)).Swap(*this);
+        return *this;
+    }
+    IntrusivePtr& operator=(T* object) {
+        IntrusivePtr(object).Swap(*this);
+        return *this;
+    }
+
+    T* Get() const { return ptr; }
+    T* operator->() const { return ptr; }
+    T& operator*() const { return *ptr; }
+    [[nodiscard]] bool IsValid() const { return ptr != nullptr; }
+    explicit operator bool() const { return IsValid(); }
+
+    void Reset() {
+        if (ptr != nullptr && ptr->ReleaseReference()) {
+            delete ptr;
+        }
+        ptr = nullptr;
+    }
+    /**
+     * @brief Gives up the pointer without releasing its reference.
+     */
+    T* ReleaseOwnership() {
+        T* temp = ptr;
+        ptr = nullptr;
+        return temp;
+    }
+    void Swap(IntrusivePtr& other) noexcept {
+        T* temp = ptr;
+        ptr = other.ptr;
+        other.ptr = temp;
+    }
+
+    bool operator==(const IntrusivePtr& other) const { return ptr == other.ptr; }
+    bool operator!=(const IntrusivePtr& other) const { return ptr != other.ptr; }
+    bool operator==(const T* other) const { return ptr == other; }
+    bool operator!=(const T* other) const { return ptr != other; }
+
+private:
+    T* ptr;
+};
+
 template <typename T, bool ThreadSafe> struct EnableSharedFromThis : _z__Private::EnableSharedFromThisBase {
 public:
     virtual ~EnableSharedFromThis() = default;
@@ -578,6 +818,10 @@ template <typename T, bool ThreadSafe = false> using SharedReference = Edvar::Me
 
 template <typename T, bool ThreadSafe = false> using UniquePointer = Edvar::Memory::UniquePointer<T>;
 
+template <bool ThreadSafe = false> using IntrusiveRefCounted = Edvar::Memory::IntrusiveRefCounted<ThreadSafe>;
+
+template <typename T> using IntrusivePtr = Edvar::Memory::IntrusivePtr<T>;
+
 template <typename T, typename... ArgsT>
 UniquePointer<T> MakeUnique(ArgsT&&... args)
     requires(std::is_constructible_v<T, ArgsT...>)
@@ -585,13 +829,46 @@ UniquePointer<T> MakeUnique(ArgsT&&... args)
     return UniquePointer<T>(new T(std::forward<ArgsT>(args)...));
 }
 
-template <typename T, typename... ArgsT> SharedReference<T> MakeShared(ArgsT&&... args) {
-    return SharedReference<T>(new T(std::forward<ArgsT>(args)...));
+/**
+ * @brief Creates a shared object with the object and its reference counter in a single allocation.
+ */
+template <typename T, bool ThreadSafe = false, typename... ArgsT>
+SharedReference<T, ThreadSafe> MakeShared(ArgsT&&... args)
+    requires(std::is_constructible_v<T, ArgsT...>)
+{
+    auto* counter = new Memory::_z__Private::InlineReferenceCounter<T, ThreadSafe>(std::forward<ArgsT>(args)...);
+    SharedPointer<T, ThreadSafe> sharedPtr;
+    sharedPtr.template SetCounter<true>(counter);
+    sharedPtr.InternalSetManagedObject(counter->GetObject());
+    return sharedPtr.ToSharedReference();
+}
+
+template <typename T, typename... ArgsT>
+IntrusivePtr<T> MakeIntrusive(ArgsT&&... args)
+    requires(std::is_constructible_v<T, ArgsT...>)
+{
+    return IntrusivePtr<T>(new T(std::forward<ArgsT>(args)...));
 }
 
-template <typename ToT, typename FromT>
-SharedPointer<ToT> StaticCastSharedPointer(const SharedPointer<FromT>& fromPtr) {
-    SharedPointer<ToT> castedPtr;
+/**
+ * @brief Like MakeShared with ThreadSafe = true, but references taken on the creating thread are counted without
+ * atomics. Use for objects which are mostly referenced by the thread that created them yet shared with others. Threads
+ * releasing such objects should call Memory::FlushBiasedReferenceCounts at quiescent points.
+ */
+template <typename T, typename... ArgsT>
+SharedReference<T, true> MakeSharedBiased(ArgsT&&... args)
+    requires(std::is_constructible_v<T, ArgsT...>)
+{
+    auto* counter = new Memory::_z__Private::BiasedInlineReferenceCounter<T>(std::forward<ArgsT>(args)...);
+    SharedPointer<T, true> sharedPtr;
+    sharedPtr.template SetCounter<true>(counter);
+    sharedPtr.InternalSetManagedObject(counter->GetObject());
+    return sharedPtr.ToSharedReference();
+}
+
+template <typename ToT, typename FromT, bool ThreadSafe>
+SharedPointer<ToT, ThreadSafe> StaticCastSharedPointer(const SharedPointer<FromT, ThreadSafe>& fromPtr) {
+    SharedPointer<ToT, ThreadSafe> castedPtr;
     if (fromPtr.IsValid()) {
         castedPtr.template SetCounter<true>(fromPtr.InternalGetCounter());
         ToT* castedObj = static_cast<ToT*>(fromPtr.Get());
@@ -601,10 +878,9 @@ SharedPointer<ToT> StaticCastSharedPointer(const SharedPointer<FromT>& fromPtr)
     return castedPtr;
 }
 
-template <typename ToT, typename FromT>
-SharedReference<ToT> StaticCastSharedReference(const SharedReference<FromT>& fromRef) {
-    SharedReference<ToT> castedPtr = StaticCastSharedPointer<ToT>(SharedPointer<FromT>(fromRef)).ToSharedReference();
-    return castedPtr;
+template <typename ToT, typename FromT, bool ThreadSafe>
+SharedReference<ToT, ThreadSafe> StaticCastSharedReference(const SharedReference<FromT, ThreadSafe>& fromRef) {
+    return StaticCastSharedPointer<ToT>(SharedPointer<FromT, ThreadSafe>(fromRef)).ToSharedReference();
 }
 
 template <typename ToT, typename FromT> WeakPointer<ToT> StaticCastWeakPointer(const WeakPointer<FromT>& fromPtr) {
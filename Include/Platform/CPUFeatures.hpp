@@ -0,0 +1,62 @@
+#pragma once
+
+// Function attributes that let a translation unit built for the baseline target contain kernels for newer
+// instruction sets. Those kernels must only be called after HasCPUFeatures confirmed support. MSVC emits any
+// intrinsic regardless of /arch and needs no attribute.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#    define EDVAR_CPP_CORE_TARGET_AVX2 __attribute__((target("avx2,fma,bmi,bmi2")))
+#    define EDVAR_CPP_CORE_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vl,avx512dq,avx2,fma,bmi,bmi2")))
+#else
+#    define EDVAR_CPP_CORE_TARGET_AVX2
+#    define EDVAR_CPP_CORE_TARGET_AVX512
+#endif
+
+namespace Edvar::Platform {
+/**
+ * @brief Instruction set extensions usable on the running machine. x86 extensions with wider registers are only
+ * reported when the operating system also saves those registers on context switches.
+ */
+enum class CPUFeature : uint32_t {
+    None = 0,
+    // x86
+    SSE2 = 1 << 0,
+    SSE3 = 1 << 1,
+    SSSE3 = 1 << 2,
+    SSE41 = 1 << 3,
+    SSE42 = 1 << 4,
+    POPCNT = 1 << 5,
+    AVX = 1 << 6,
+    AVX2 = 1 << 7,
+    FMA = 1 << 8,
+    BMI1 = 1 << 9,
+    BMI2 = 1 << 10,
+    F16C = 1 << 11,
+    AVX512F = 1 << 12,
+    AVX512BW = 1 << 13,
+    AVX512VL = 1 << 14,
+    AVX512DQ = 1 << 15,
+    // ARM
+    NEON = 1 << 20,
+    ARMCRC32 = 1 << 21,
+    ARMDotProduct = 1 << 22,
+    SVE = 1 << 23,
+};
+EDVAR_CPP_CORE_ENUM_FLAG_OPERATORS(CPUFeature);
+
+/**
+ * @brief Queries the processor on first use and caches the result for the lifetime of the process.
+ * @return Every feature the running machine supports.
+ */
+EDVAR_CPP_CORE_API CPUFeature GetCPUFeatures();
+
+/** @return True when the running machine supports all of Features. */
+inline bool HasCPUFeatures(const CPUFeature Features) { return (GetCPUFeatures() & Features) == Features; }
+
+/**
+ * @return True when the running machine supports every extension EDVAR_CPP_CORE_TARGET_AVX2 lets the compiler emit,
+ * the check guarding calls into such kernels.
+ */
+inline bool HasTargetAVX2Features() {
+    return HasCPUFeatures(CPUFeature::AVX2 | CPUFeature::FMA | CPUFeature::BMI1 | CPUFeature::BMI2);
+}
+} // namespace Edvar::Platform
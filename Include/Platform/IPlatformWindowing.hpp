@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IPlatform.hpp"
+#include "PlatformEventQueue.hpp"
 
 namespace Edvar::Windowing {
 class Window;
@@ -102,7 +103,23 @@ public:
     virtual IWindowImplementation& CreateWindow(const Windowing::WindowDescriptor& descriptor) = 0;
     virtual void DestroyWindow(IWindowImplementation& window) = 0;
 
+    /** @brief Pumps the native messages and dispatches the resulting events, both on the calling thread. */
     virtual void PollEvents() = 0;
+    /**
+     * @brief Pumps the native messages into the event queue without dispatching them. Lets a dedicated thread keep
+     * windows responsive while the thread consuming the events is busy.
+     */
+    virtual void PumpEvents() = 0;
+    /**
+     * @brief Dispatches the queued events to the input devices and windows, on the thread consuming them.
+     * @return The number of events dispatched after coalescing.
+     */
+    virtual int32_t DispatchEvents() = 0;
+
+    [[nodiscard]] PlatformEventQueue& GetEventQueue() { return EventQueue; }
+
+protected:
+    PlatformEventQueue EventQueue;
 };
 
 // ============================================================================
@@ -111,8 +128,12 @@ public:
 
 class IWindowImplementation {
 public:
+    IWindowImplementation();
     virtual ~IWindowImplementation() = default;
 
+    /** @return Id identifying the window in queued platform events, unique for the process and never reused. */
+    [[nodiscard]] uint64_t GetWindowId() const { return WindowId; }
+
     // Window properties - Getters
     [[nodiscard]] virtual Containers::String GetTitle() const = 0;
     [[nodiscard]] virtual Math::Vector2<int32_t> GetPosition() const = 0;
@@ -156,6 +177,9 @@ public:
 protected:
     friend class Edvar::Windowing::Window;
     Edvar::Windowing::Window* OwnerWrapper = nullptr;
+
+private:
+    uint64_t WindowId;
 };
 
 } // namespace Edvar::Platform
@@ -0,0 +1,139 @@
+#pragma once
+
+namespace Edvar::Platform {
+
+class IInputDevice;
+
+enum class PlatformEventType : uint8_t {
+    None,
+    Key,
+    TextInput,
+    MouseButton,
+    MouseMove,
+    MouseWheel,
+    WindowClose,
+    WindowResized,
+    WindowMoved,
+    WindowFocusChanged,
+    WindowDPIChanged,
+};
+
+/**
+ * @brief Input or window event recorded by the thread pumping native messages. Plain data so the queue can copy it
+ * without allocating, only the fields of the event type are meaningful.
+ *
+ * The window is identified by IWindowImplementation::GetWindowId rather than its address, a window created after the
+ * event's window was destroyed may reuse the address but never the id.
+ */
+struct PlatformEvent {
+    static constexpr int32_t MaxTextLength = 2;
+
+    PlatformEvent() = default;
+    PlatformEvent(const PlatformEventType InType, const uint64_t InWindowId, IInputDevice* InDevice = nullptr)
+        : Type(InType), WindowId(InWindowId), Device(InDevice) {}
+
+    PlatformEventType Type = PlatformEventType::None;
+    // 0 when the event has no window
+    uint64_t WindowId = 0;
+    IInputDevice* Device = nullptr;
+
+    // Mouse position, or the new window position.
+    Math::Vector2<int32_t> Position;
+    // Mouse movement, summed when moves are coalesced.
+    Math::Vector2<int32_t> Delta;
+    // New window client size.
+    Math::Vector2<int32_t> Size;
+    // Key code or mouse button.
+    int32_t Code = 0;
+    // Wheel delta, summed when coalesced, or DPI scale.
+    float Value = 0.0f;
+    bool IsDown = false;
+    bool IsRepeat = false;
+    bool Focused = false;
+    // UTF-16 code units of a text input event, not null-terminated.
+    uint8_t TextLength = 0;
+    char16_t Text[MaxTextLength] = {};
+};
+
+/**
+ * @brief Bounded lock-free queue moving platform events from the pump thread to the thread consuming them.
+ *
+ * Any thread may record, recording never blocks or allocates: the events live in one preallocated ring of cells and a
+ * producer claims a cell with a single compare-exchange. When the ring is full the event is dropped and counted rather
+ * than stalling the pump on a slow consumer. A single consumer drains in bulk once per frame, runs of mouse moves and
+ * wheel steps for the same target are coalesced into one event.
+ *
+ * Window state events (close, resize, move, focus and DPI changes) do not take ring cells. They overwrite the latest
+ * state of their window in a per-window slot, so a modal move or resize loop that pumps without dispatching can not
+ * fill the ring with them, and a close is never dropped. Drain delivers them after the ring events, close last.
+ */
+class EDVAR_CPP_CORE_API PlatformEventQueue {
+public:
+    /** @brief Windows whose state events are kept in slots. State events of further windows go through the ring. */
+    static constexpr int32_t MaxWindowStateSlots = 64;
+
+    /** @param Capacity Number of events the ring holds, a power of two. */
+    explicit PlatformEventQueue(int32_t Capacity = 4096);
+    ~PlatformEventQueue();
+    PlatformEventQueue(const PlatformEventQueue&) = delete;
+    PlatformEventQueue& operator=(const PlatformEventQueue&) = delete;
+
+    /**
+     * @brief Appends an event, callable from any thread.
+     * @return false if the queue was full and the event was dropped.
+     */
+    bool Record(const PlatformEvent& Event);
+
+    /**
+     * @brief Hands every event recorded before the call to Handler, in order and coalesced, followed by the latest
+     * state of each window. Events recorded meanwhile wait for the next call. Only one thread may drain, and Handler
+     * must not drain again.
+     * @return The number of events handed to Handler.
+     */
+    int32_t Drain(Utils::FunctionRef<void(const PlatformEvent&)> Handler);
+
+    /** @brief Discards the pending state events of a destroyed window and frees its slot. */
+    void ForgetWindow(uint64_t WindowId);
+
+    /** @return Events dropped so far because the queue was full. */
+    [[nodiscard]] int32_t GetDroppedCount() const { return droppedCount.Load(Memory::MemoryOrder::Relaxed); }
+
+private:
+    struct Cell {
+        // Equals the position a producer may claim the cell at, position + 1 once the event is readable.
+        Memory::Atomic<uint32_t> Sequence;
+        PlatformEvent Event;
+    };
+
+    // Close, resize, move, focus and DPI changes
+    static constexpr int32_t WindowStateTypeCount = 5;
+
+    // Latest state of one window. Producers store the value and then raise its flag, the consumer takes the flag
+    // first, so it never reads a value older than the flag it took.
+    struct WindowStateSlot {
+        // 0 while the slot is free
+        Memory::Atomic<uint64_t> WindowId{0};
+        // Vector2<int32_t> packed into 64 bits
+        Memory::Atomic<uint64_t> Size{0};
+        Memory::Atomic<uint64_t> Position{0};
+        Memory::Atomic<uint32_t> DPIScaleBits{0};
+        Memory::Atomic<uint8_t> Focused{0};
+        // One flag per state event type, set while the event is pending
+        Memory::Atomic<uint8_t> Pending[WindowStateTypeCount] = {};
+    };
+
+    /** @return true if Next was merged into Pending. */
+    static bool TryCoalesce(PlatformEvent& Pending, const PlatformEvent& Next);
+    /** @return false if the event is not a window state event or no slot was free for its window. */
+    bool RecordWindowState(const PlatformEvent& Event);
+    int32_t DrainWindowStates(Utils::FunctionRef<void(const PlatformEvent&)> Handler);
+
+    WindowStateSlot windowSlots[MaxWindowStateSlots];
+    Cell* cells;
+    uint32_t mask;
+    // Producers contend on the enqueue position, keep the consumer state off its cache line.
+    alignas(64) Memory::Atomic<uint32_t> enqueuePosition;
+    alignas(64) uint32_t dequeuePosition;
+    Memory::Atomic<int32_t> droppedCount;
+};
+} // namespace Edvar::Platform
@@ -79,7 +79,9 @@ public:
     [[nodiscard]] bool WasButtonReleased(int32_t button) const override;
 
     void ProcessButtonMessage(IWindowImplementation* window, int32_t button, bool isDown);
-    void ProcessMoveMessage(IWindowImplementation* window, const Math::Vector2<int32_t>& position);
+    // Delta is the movement since the previous message, summed over the moves coalesced into this one.
+    void ProcessMoveMessage(IWindowImplementation* window, const Math::Vector2<int32_t>& position,
+                            const Math::Vector2<int32_t>& delta);
     void ProcessWheelMessage(IWindowImplementation* window, float delta);
     void UpdateState();
 
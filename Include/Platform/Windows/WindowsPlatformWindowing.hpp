@@ -18,6 +18,8 @@ public:
     void DestroyWindow(IWindowImplementation& window) override;
 
     void PollEvents() override;
+    void PumpEvents() override;
+    int32_t DispatchEvents() override;
 
 private:
     MonitorInfo PrimaryMonitor;
@@ -77,6 +79,10 @@ private:
     void ApplyWindowStyle();
     void HandleDPIChange(uint32_t newDPI, const void* suggestedRect);
     void HandleMonitorChange();
+    // Destroys the HWND, the object itself is retired by WindowsPlatformWindowing::DestroyWindow.
+    void DestroyNativeWindow();
+
+    friend class WindowsPlatformWindowing;
 };
 
 } // namespace Edvar::Platform::Windows
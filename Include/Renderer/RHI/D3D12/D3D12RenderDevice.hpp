@@ -46,85 +46,42 @@ enum class D3D12DescriptorHeapType : uint8_t {
 };
 
 struct AllocationRange {
-    explicit AllocationRange(const uint32_t inMaxIndex) : maxIndex(inMaxIndex) {
-        freeRanges.Add(FreeRange{.begin = 0, .end = inMaxIndex});
-    }
-    void Clear() {
-        freeRanges.Clear();
-        freeRanges.Add(FreeRange{.begin = 0, .end = maxIndex});
-    }
+    // Free slots are the set bits, allocation takes the lowest one.
+    explicit AllocationRange(const uint32_t inCount) : count(inCount), freeSlots(static_cast<int32_t>(inCount), true) {}
+    void Clear() { freeSlots.SetAll(); }
     uint32_t Allocate() {
-        for (int32_t i = 0; i < freeRanges.Length(); ++i) {
-            if (auto& [begin, end] = freeRanges[i]; begin < end) {
-                uint32_t allocatedIndex = begin;
-                begin += 1;
-                if (begin == end) {
-                    freeRanges.RemoveAt(i);
-                }
-                if (allocatedIndex > maxIndex) {
-                    Platform::GetPlatform().PrintMessageToDebugger(*String::Format(
-                        u"AllocationRange: allocated index {} exceeds max index {}.", allocatedIndex, maxIndex));
-                    return UINT32_MAX; // somehow this happened, out of bounds
-                }
-                return allocatedIndex;
-            }
+        const int32_t index = freeSlots.FindFirstSet();
+        if (index == Containers::HierarchicalBitArray::NotFound) {
+            return UINT32_MAX;
         }
-        return UINT32_MAX;
+        freeSlots.ClearBit(index);
+        return static_cast<uint32_t>(index);
     }
     void Free(uint32_t index) {
-        // check if the range is out of bounds. We don't free in that case.
-        if (index > maxIndex) {
+        // check if the index is out of bounds. We don't free in that case.
+        if (index >= count) {
             return;
         }
-        for (int i = 0; i < freeRanges.Length(); ++i) {
-            if (auto& range = freeRanges[i]; range.Contains(index)) {
-                if (range.begin - 1 == index) {
-                    range.begin--;
-                } else if (range.end + 1 == index) {
-                    range.end++;
-                } else {
+        if (freeSlots.IsSet(static_cast<int32_t>(index))) {
 #    ifdef _DEBUG
-                    //  the index is inside the free-range, which is an error
-                    Platform::GetPlatform().PrintMessageToDebugger(
-                        *String::Format(u"Allocation range error: double free of index {}.", index));
-                    __debugbreak();
+            Platform::GetPlatform().PrintMessageToDebugger(
+                *String::Format(u"Allocation range error: double free of index {}.", index));
+            __debugbreak();
 #    endif
-                }
-
-                return; // freed successfully
-            }
+            return;
         }
-        // couldn't free the index, so we add a new free-range.
-        freeRanges.Add(FreeRange{.begin = index, .end = index});
+        freeSlots.SetBit(static_cast<int32_t>(index));
     }
     bool IsAllocated(const uint32_t index) const {
-        for (int i = 0; i < freeRanges.Length(); ++i) {
-            if (auto& range = freeRanges[i]; range.Contains(index)) {
-                return false;
-            }
-        }
-        return true;
+        return index < count && !freeSlots.IsSet(static_cast<int32_t>(index));
     }
 
-    uint32_t GetFreeCount() const {
-        uint32_t count = 0;
-        for (int i = 0; i < freeRanges.Length(); ++i) {
-            count += (freeRanges[i].end - freeRanges[i].begin) + 1;
-        }
-        return count;
-    }
-    uint32_t GetAllocatedCount() const { return (maxIndex + 1) - GetFreeCount(); }
+    uint32_t GetFreeCount() const { return static_cast<uint32_t>(freeSlots.CountSetBits()); }
+    uint32_t GetAllocatedCount() const { return count - GetFreeCount(); }
 
 private:
-    // range is [begin, end]
-    struct FreeRange {
-        uint32_t begin;
-        uint32_t end;
-
-        bool Contains(const uint32_t index) const { return begin >= index && end <= index; }
-    };
-    uint32_t maxIndex;
-    Containers::List<FreeRange> freeRanges;
+    uint32_t count;
+    Containers::HierarchicalBitArray freeSlots;
 };
 
 class D3D12DescriptorHeap final : public IRenderDeviceDependent {
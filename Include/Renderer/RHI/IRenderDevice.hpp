@@ -32,6 +32,6 @@ public:
 
 private:
     friend class IRenderDeviceDependent;
-    Containers::List<IRenderDeviceDependent*> dependents;
+    Containers::SlotMap<IRenderDeviceDependent*> dependents;
 };
 } // namespace Edvar::Renderer::RHI
\ No newline at end of file
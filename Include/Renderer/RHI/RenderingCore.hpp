@@ -3,7 +3,10 @@
 
 namespace Edvar::Renderer::RHI {
 class IRenderDevice;
+class IRenderingAPI;
 typedef Memory::SharedReference<IRenderDevice> RenderDeviceRef;
+// The active API is read from any thread, its references are counted atomically
+typedef Memory::SharedReference<IRenderingAPI, true> RenderingAPIRef;
 #if defined(_DEBUG) && defined(EDVAR_CPP_CORE_GRAPHICS_API_DEBUG)
 #    define EDVAR_CPP_CORE_GRAPHICS_API_DEBUG_RENDERING 1
 #else
@@ -27,9 +30,10 @@ public:
 
 private:
     SharedReference<IRenderDevice> associatedDevice;
+    Containers::SlotMapHandle dependentHandle;
 };
 
-class EDVAR_CPP_CORE_API IRenderingAPI : public Memory::EnableSharedFromThis<IRenderingAPI> {
+class EDVAR_CPP_CORE_API IRenderingAPI : public Memory::EnableSharedFromThis<IRenderingAPI, true> {
 public:
     explicit IRenderingAPI(const char16_t* name) {
         Memory::CopyMemory(
@@ -45,11 +49,14 @@ public:
 
     virtual bool DoesOutputSupportHDR(const Platform::MonitorInfo& monitorInfo) { return false; }
 
-    static SharedReference<IRenderingAPI> GetActiveAPI(bool bSelectIfNull = true);
-    static void SetActiveAPI(const SharedReference<IRenderingAPI>& newAPI);
+    static RenderingAPIRef GetActiveAPI(bool bSelectIfNull = true);
+    /**
+     * @brief Makes newAPI the active API. Returns once no reader can still see the previous one, whose last reference
+     * is then released on the calling thread unless someone else still holds it.
+     */
+    static void SetActiveAPI(const RenderingAPIRef& newAPI);
 
-    static Utils::MultiDelegate<void(SharedReference<IRenderingAPI>, SharedReference<IRenderingAPI>)>
-    OnRenderingAPIChanged();
+    static Utils::MultiDelegate<void(RenderingAPIRef, RenderingAPIRef)> OnRenderingAPIChanged();
 
     static Utils::MultiDelegate<void(SharedReference<IRenderDevice>)> OnRenderDeviceLost();
 
@@ -62,7 +69,7 @@ protected:
 
 private:
     char16_t Name[32]{};
-    static SharedPointer<IRenderingAPI> ActiveAPI;
+    static Memory::Published<SharedPointer<IRenderingAPI, true>> ActiveAPI;
     SharedPointer<IRenderDevice> PrimaryDevice;
 };
 
@@ -15,14 +15,15 @@ private:
     Platform::IMutexImplementation* MutexImplementation;
 };
 
-template <typename MutexT> class ScopedLock {
-    static constexpr bool IsMutexImplementation = std::is_base_of_v<Platform::IMutexImplementation, MutexT> ||
-                                                  std::is_same_v<Platform::IMutexImplementation, MutexT>;
-    static constexpr bool IsMutexWrapper = std::is_base_of_v<Edvar::Threading::Mutex, MutexT>;
+/** @brief Anything with Lock and Release: Mutex, platform mutexes, SharedMutex (exclusive), SpinLock, TicketLock. */
+template <typename MutexT>
+concept Lockable = requires(MutexT& InMutex) {
+    InMutex.Lock();
+    InMutex.Release();
+};
 
-    static_assert(
-        IsMutexImplementation || IsMutexWrapper,
-        "ScopedLock can only be used with types of Edvar::Platform::IMutexImplementation or Edvar::Threading::Mutex");
+template <typename MutexT> class ScopedLock {
+    static_assert(Lockable<MutexT>, "ScopedLock can only be used with types providing Lock() and Release()");
 
 public:
     ScopedLock() = delete;
@@ -0,0 +1,77 @@
+#pragma once
+#include "Threading/ThreadPool.hpp"
+#include "Threading/WaitOnAddress.hpp"
+
+namespace Edvar::Threading {
+namespace _z__Private {
+// Shared between the caller and the helper jobs. Helpers may start after the caller returned, once every chunk is
+// claimed they only touch the counters and never Body, which lives on the caller's stack.
+struct ParallelForState {
+    Memory::Atomic<int32_t> NextChunk = 0;
+    Memory::Atomic<int32_t> RemainingChunks = 0;
+    int32_t Count = 0;
+    int32_t ChunkSize = 0;
+    int32_t ChunkCount = 0;
+    void* Body = nullptr;
+    void (*Invoke)(void* Body, int32_t Begin, int32_t End) = nullptr;
+
+    void RunChunks() {
+        while (true) {
+            const int32_t chunk = NextChunk.FetchAdd(1, Memory::MemoryOrder::Relaxed);
+            if (chunk >= ChunkCount) {
+                return;
+            }
+            const int32_t begin = chunk * ChunkSize;
+            const int32_t end = Count - begin < ChunkSize ? Count : begin + ChunkSize;
+            Invoke(Body, begin, end);
+            if (RemainingChunks.FetchAdd(-1, Memory::MemoryOrder::AcquireAndRelease) == 1) {
+                WakeAllOnAddress(RemainingChunks);
+            }
+        }
+    }
+};
+} // namespace _z__Private
+
+/**
+ * @brief Calls Body(Begin, End) for consecutive ranges of at most ChunkSize elements covering [0, Count), spread over
+ * the calling thread and the workers of Pool. Returns once every range has been processed.
+ *
+ * The caller works through chunks itself instead of only waiting, so this is also safe to call from a job running on
+ * Pool. ChunkSize must be positive.
+ */
+template <typename FuncT>
+void ParallelFor(ThreadPool& Pool, const int32_t Count, const int32_t ChunkSize, FuncT&& Body) {
+    if (Count <= 0) {
+        return;
+    }
+    if (Count <= ChunkSize || Pool.GetWorkerCount() == 0) {
+        Body(0, Count);
+        return;
+    }
+
+    auto state = MakeShared<_z__Private::ParallelForState, true>();
+    state->Count = Count;
+    state->ChunkSize = ChunkSize;
+    state->ChunkCount = (Count - 1) / ChunkSize + 1;
+    state->RemainingChunks.Store(state->ChunkCount, Memory::MemoryOrder::Relaxed);
+    state->Body = const_cast<void*>(static_cast<const void*>(&Body));
+    state->Invoke = [](void* BodyPtr, const int32_t Begin, const int32_t End) {
+        (*static_cast<std::remove_reference_t<FuncT>*>(BodyPtr))(Begin, End);
+    };
+
+    const int32_t helperCount =
+        state->ChunkCount - 1 < Pool.GetWorkerCount() ? state->ChunkCount - 1 : Pool.GetWorkerCount();
+    for (int32_t i = 0; i < helperCount; ++i) {
+        Pool.EnqueueJob([state]() -> int {
+            state->RunChunks();
+            return 0;
+        });
+    }
+
+    state->RunChunks();
+    int32_t remaining;
+    while ((remaining = state->RemainingChunks.Load(Memory::MemoryOrder::Acquire)) != 0) {
+        WaitOnAddress(state->RemainingChunks, remaining);
+    }
+}
+} // namespace Edvar::Threading
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Threading/WaitOnAddress.hpp"
+
+namespace Edvar::Threading {
+/**
+ * @brief Writer-preferring reader-writer lock built on wait-on-address.
+ *
+ * Readers take the lock with a single compare-exchange while no writer is active or waiting. A writer first queues on
+ * a gate shared by writers, then announces itself, which stops new readers, and sleeps until the current readers
+ * drained. Lock and Release take the exclusive side, so the lock works with ScopedLock.
+ */
+class EDVAR_CPP_CORE_API SharedMutex {
+public:
+    SharedMutex() : state(0), writerGate(0) {}
+    SharedMutex(const SharedMutex&) = delete;
+    SharedMutex& operator=(const SharedMutex&) = delete;
+
+    void Lock();
+    [[nodiscard]] bool TryLock();
+    void Release();
+
+    void LockShared() {
+        int32_t current = state.Load(Memory::MemoryOrder::Relaxed);
+        if ((current & WriterFlag) != 0 ||
+            !state.CompareExchange(current, current + 1, Memory::MemoryOrder::Acquire)) [[unlikely]] {
+            LockSharedSlow();
+        }
+    }
+    [[nodiscard]] bool TryLockShared();
+    void ReleaseShared() {
+        // The last reader out wakes the writer waiting for the readers to drain.
+        const int32_t previous = state.FetchAdd(-1, Memory::MemoryOrder::Release);
+        if ((previous & ~ReadersWaitingFlag) == (WriterFlag | 1)) [[unlikely]] {
+            WakeAllOnAddress(state);
+        }
+    }
+
+private:
+    static constexpr int32_t WriterFlag = 1 << 30;
+    static constexpr int32_t ReadersWaitingFlag = 1 << 29;
+    static constexpr int32_t ReaderMask = ReadersWaitingFlag - 1;
+
+    void LockSharedSlow();
+
+    // Reader count, WriterFlag while a writer waits for the readers to drain or holds the lock, ReadersWaitingFlag
+    // once a reader sleeps until the writer is done.
+    Memory::Atomic<int32_t> state;
+    // Serializes writers: 0 free, 1 locked, 2 locked with sleeping writers.
+    Memory::Atomic<int32_t> writerGate;
+};
+
+class ScopedReadLock {
+public:
+    explicit ScopedReadLock(SharedMutex& InMutex) : mutex(InMutex) { mutex.LockShared(); }
+    ~ScopedReadLock() { mutex.ReleaseShared(); }
+    ScopedReadLock(const ScopedReadLock&) = delete;
+    ScopedReadLock& operator=(const ScopedReadLock&) = delete;
+
+private:
+    SharedMutex& mutex;
+};
+
+class ScopedWriteLock {
+public:
+    explicit ScopedWriteLock(SharedMutex& InMutex) : mutex(InMutex) { mutex.Lock(); }
+    ~ScopedWriteLock() { mutex.Release(); }
+    ScopedWriteLock(const ScopedWriteLock&) = delete;
+    ScopedWriteLock& operator=(const ScopedWriteLock&) = delete;
+
+private:
+    SharedMutex& mutex;
+};
+} // namespace Edvar::Threading
@@ -1,13 +1,55 @@
 #pragma once
 
+#include "Threading/WaitOnAddress.hpp"
+
 namespace Edvar::Threading {
-class Signal {
+/**
+ * @brief Event for waiting on a condition without a mutex, built on wait-on-address.
+ *
+ * Notifiers bump a generation counter and wake sleepers only if there are any, so notifying nobody costs one atomic
+ * add. Waiters sample the generation before checking their condition, a notification between the check and the
+ * sleep changes the generation and the sleep returns at once, no wakeup is lost.
+ */
+class EDVAR_CPP_CORE_API Signal {
 public:
-    Signal();
-    ~Signal();
+    Signal() : generation(0), waiterCount(0) {}
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
+
+    /**
+     * @brief Waits for the next notification.
+     * @param Milliseconds Timeout, -1 waits indefinitely.
+     * @return false if the timeout elapsed.
+     */
+    bool Wait(int32_t Milliseconds = -1);
+
+    /**
+     * @brief Waits until Predicate returns true. Notifiers must make the predicate true before notifying.
+     * @param Milliseconds Timeout, -1 waits indefinitely.
+     * @return The last result of Predicate, false only on timeout.
+     */
+    template <typename PredicateT> bool WaitFor(PredicateT&& Predicate, const int32_t Milliseconds = -1) {
+        const int64_t deadline = Milliseconds < 0 ? -1 : GetDeadline(Milliseconds);
+        while (true) {
+            const int32_t observed = generation.Load(Memory::MemoryOrder::SequentiallyConsistent);
+            if (Predicate()) {
+                return true;
+            }
+            if (!WaitForChange(observed, deadline)) {
+                return Predicate();
+            }
+        }
+    }
 
-    void Wait(int32_t milliseconds = -1);
     void NotifyOne();
     void NotifyAll();
+
+private:
+    static int64_t GetDeadline(int32_t Milliseconds);
+    /** @return false if the deadline passed before the generation changed away from Observed. */
+    bool WaitForChange(int32_t Observed, int64_t Deadline);
+
+    Memory::Atomic<int32_t> generation;
+    Memory::Atomic<int32_t> waiterCount;
 };
-} // namespace Edvar::Threading
\ No newline at end of file
+} // namespace Edvar::Threading
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Memory/Atomic.hpp"
+
+#if defined(_M_AMD64) || defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#    include <emmintrin.h>
+#    define EDVAR_CPP_CORE_CPU_RELAX() _mm_pause()
+#elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+#    include <intrin.h>
+#    define EDVAR_CPP_CORE_CPU_RELAX() __yield()
+#elif defined(__aarch64__) || defined(__arm__)
+#    define EDVAR_CPP_CORE_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#    define EDVAR_CPP_CORE_CPU_RELAX() ((void)0)
+#endif
+
+namespace Edvar::Threading {
+/** @brief Tells the core the thread is busy waiting, freeing resources for its sibling hyperthread. */
+EDVAR_CPP_CORE_FORCE_INLINE void CpuRelax() { EDVAR_CPP_CORE_CPU_RELAX(); }
+
+/**
+ * @brief Test-and-test-and-set spin lock with exponential pause backoff.
+ *
+ * Waiters spin on a plain load, so the cache line stays shared until the owner releases it. Only for very short
+ * critical sections, a waiter never sleeps.
+ */
+class SpinLock {
+public:
+    SpinLock() : locked(0) {}
+    SpinLock(const SpinLock&) = delete;
+    SpinLock& operator=(const SpinLock&) = delete;
+
+    void Lock() {
+        int32_t backoff = 1;
+        while (locked.Exchange(1, Memory::MemoryOrder::Acquire) != 0) {
+            do {
+                for (int32_t i = 0; i < backoff; ++i) {
+                    CpuRelax();
+                }
+                backoff = backoff < MaxBackoff ? backoff * 2 : MaxBackoff;
+            } while (locked.Load(Memory::MemoryOrder::Relaxed) != 0);
+        }
+    }
+    [[nodiscard]] bool TryLock() {
+        return locked.Load(Memory::MemoryOrder::Relaxed) == 0 &&
+               locked.Exchange(1, Memory::MemoryOrder::Acquire) == 0;
+    }
+    void Release() { locked.Store(0, Memory::MemoryOrder::Release); }
+
+private:
+    static constexpr int32_t MaxBackoff = 64;
+
+    Memory::Atomic<int32_t> locked;
+};
+
+/**
+ * @brief Fair spin lock: threads take a ticket and are served in arrival order.
+ *
+ * Waiters back off in proportion to their distance from the served ticket. Like SpinLock, a waiter never sleeps.
+ */
+class TicketLock {
+public:
+    TicketLock() : nextTicket(0), servedTicket(0) {}
+    TicketLock(const TicketLock&) = delete;
+    TicketLock& operator=(const TicketLock&) = delete;
+
+    void Lock() {
+        const uint32_t ticket = nextTicket.FetchAdd(1, Memory::MemoryOrder::Relaxed);
+        while (true) {
+            const uint32_t served = servedTicket.Load(Memory::MemoryOrder::Acquire);
+            if (served == ticket) {
+                return;
+            }
+            // Tickets wrap around, the unsigned difference stays correct.
+            const uint32_t distance = ticket - served;
+            for (uint32_t i = 0; i < distance * PausePerWaiter; ++i) {
+                CpuRelax();
+            }
+        }
+    }
+    [[nodiscard]] bool TryLock() {
+        uint32_t ticket = servedTicket.Load(Memory::MemoryOrder::Relaxed);
+        return nextTicket.CompareExchange(ticket, ticket + 1, Memory::MemoryOrder::Acquire);
+    }
+    void Release() {
+        // Only the owner writes the served ticket.
+        servedTicket.Store(servedTicket.Load(Memory::MemoryOrder::Relaxed) + 1, Memory::MemoryOrder::Release);
+    }
+
+private:
+    static constexpr uint32_t PausePerWaiter = 8;
+
+    // On separate cache lines, arriving threads do not disturb the waiters polling the served ticket.
+    alignas(64) Memory::Atomic<uint32_t> nextTicket;
+    alignas(64) Memory::Atomic<uint32_t> servedTicket;
+};
+} // namespace Edvar::Threading
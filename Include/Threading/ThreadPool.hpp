@@ -1,94 +1,124 @@
 #pragma once
 #include "Platform/IPlatformThreading.hpp"
-#include "Threading/Semaphore.hpp"
+#include "Threading/Signal.hpp"
 
 namespace Edvar::Threading {
 
 class ThreadPool : public Memory::EnableSharedFromThis<ThreadPool> {
 public:
     ThreadPool(const Containers::String& name, const int32_t maxThreads)
-        : taskReadySemaphore(0, maxThreads), maxThreadCount(maxThreads), poolName(name) {
+        : queuedJobCount(0), stopRequested(0), maxThreadCount(maxThreads), poolName(name) {
         workerThreads = new Platform::IThreadImplementation*[maxThreadCount];
+        crashHandles = new Utils::DelegateHandle[maxThreadCount];
         for (int32_t i = 0; i < maxThreadCount; ++i) {
             Containers::String threadName = name + u"_Worker_" + Containers::String::Format(u"{}", i);
-            workerThreads[i] = (&Platform::Get().GetThreading().CreateThread(threadName, WorkerThreadFunction, this));
-            workerThreads[i]->OnThreadCrashed.AddShared(this, &ThreadPool::OnThreadCrashed);
+            workerThreads[i] =
+                (&Platform::GetPlatform().GetThreading().CreateThread(threadName, WorkerThreadFunction, this));
+            // No SharedPointer owns the pool while it is being constructed, so the binding is raw and Shutdown
+            // removes it before the pool goes away.
+            crashHandles[i] = workerThreads[i]->OnThreadCrashed.AddRaw(this, &ThreadPool::OnThreadCrashed);
         }
     }
 
+    // Workers run against the address of the pool they were started for, so a pool is neither copied nor moved
     ThreadPool(const ThreadPool& other) = delete;
-
-    ThreadPool(ThreadPool&& other) noexcept : taskReadySemaphore(std::move(other.taskReadySemaphore)), poolMutex(other.poolMutex) {
-        workerThreads = other.workerThreads;
-        maxThreadCount = other.maxThreadCount;
-        other.workerThreads = nullptr;
-        other.maxThreadCount = 0;
-        other.poolMutex = Mutex();
+    ThreadPool(ThreadPool&& other) = delete;
+    ~ThreadPool() {
+        Shutdown();
+        delete[] crashHandles;
+        delete[] workerThreads;
     }
-    ~ThreadPool() { delete[] workerThreads; }
 
-    ThreadPool& operator=(ThreadPool&& other) noexcept {
-        if (this != &other) {
-            poolMutex = other.poolMutex;
-            delete[] workerThreads;
-            workerThreads = other.workerThreads;
-            maxThreadCount = other.maxThreadCount;
-            other.poolMutex = Mutex();
-            other.workerThreads = nullptr;
-            other.maxThreadCount = 0;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) = delete;
+
+    /**
+     * @brief Queues Job, called with Args on a worker. Job and the arguments are moved into a single UniqueFunction,
+     * which stores them inline when they fit, so small jobs enqueue without allocating beyond the queue itself.
+     */
+    template <typename FuncT, typename... ArgsT> void EnqueueJob(FuncT&& job, ArgsT&&... args) {
+        JobFunctionType boundJob;
+        if constexpr (sizeof...(ArgsT) == 0) {
+            boundJob = JobFunctionType(std::forward<FuncT>(job));
+        } else {
+            boundJob = JobFunctionType(
+                [job = std::forward<FuncT>(job), ... args = std::forward<ArgsT>(args)]() mutable -> int {
+                    return job(std::move(args)...);
+                });
         }
-        return *this;
+        {
+            Threading::ScopedLock lock(poolMutex);
+            jobQueue.Add(std::move(boundJob));
+            queuedJobCount.FetchAdd(1, Memory::MemoryOrder::Release);
+        }
+        // Wakes a sleeping worker only if there is one.
+        jobSignal.NotifyOne();
     }
 
-    ThreadPool& operator=(const ThreadPool& other) = delete;
-
-    template <typename... ArgsT> void EnqueueJob(const Utils::Function<int(ArgsT...)>& job, ArgsT... args) {
-        const Utils::Function<int()> boundJob = [job, args...]() -> int { return job(std::forward<ArgsT>(args)...); };
-        Threading::ScopedLock lock(poolMutex);
-        jobQueue.Add(boundJob);
-        // Each thread can handle one task at a time. So only signal if there are available threads.
-        if (taskReadySemaphore.GetCurrentCount() < maxThreadCount) {
-            taskReadySemaphore.Signal(1);
+    /**
+     * @brief Wakes all workers, lets them finish their current job and waits for them to exit. Jobs still queued are
+     * dropped.
+     */
+    void Shutdown() {
+        if (stopRequested.Exchange(1, Memory::MemoryOrder::AcquireAndRelease) != 0) {
+            return;
+        }
+        jobSignal.NotifyAll();
+        for (int32_t i = 0; i < maxThreadCount; ++i) {
+            workerThreads[i]->Join();
+            workerThreads[i]->OnThreadCrashed.RemoveDelegate(crashHandles[i]);
         }
     }
 
+    int32_t GetWorkerCount() const { return maxThreadCount; }
+
     int32_t GetRemainingJobCount() {
         Threading::ScopedLock lock(poolMutex);
         return jobQueue.Length();
     }
 
 private:
-    typedef Utils::Function<int()> JobFunctionType;
+    typedef Utils::UniqueFunction<int()> JobFunctionType;
 
     static int WorkerThreadFunction(void* arg) {
         ThreadPool* threadPool = static_cast<ThreadPool*>(arg);
 
         while (true) {
-            threadPool->taskReadySemaphore.Wait(1000);
-            bool shouldBeKilled = Platform::Get().GetThreading().GetCurrentThread().ShouldBeKilled();
-            // Wait for a task to be available. Time out must exist to check for thread termination. 1 second timeout
-            // looks fine.
-            if (shouldBeKilled) {
+            // Sleeps until there is work or the pool stops, no polling.
+            threadPool->jobSignal.WaitFor([threadPool] {
+                return threadPool->queuedJobCount.Load(Memory::MemoryOrder::Acquire) > 0 ||
+                       threadPool->stopRequested.Load(Memory::MemoryOrder::Acquire) != 0;
+            });
+            if (threadPool->stopRequested.Load(Memory::MemoryOrder::Acquire) != 0 ||
+                Platform::GetPlatform().GetThreading().GetCurrentThread().ShouldBeKilled()) {
                 break;
             }
             JobFunctionType job;
             {
                 Threading::ScopedLock lock(threadPool->poolMutex);
                 if (threadPool->jobQueue.Length() > 0) {
-                    job = threadPool->jobQueue.Get(0);
-                    threadPool->jobQueue.RemoveAt(0);
+                    job = threadPool->jobQueue.RemoveAt(0);
+                    threadPool->queuedJobCount.FetchAdd(-1, Memory::MemoryOrder::Relaxed);
                 }
             }
             if (job.IsValid()) {
                 job.Invoke();
             }
+            // Between jobs the worker holds no references, merge biased counts and apply deferred releases.
+            Memory::FlushBiasedReferenceCounts();
+            // Workers also free the retired objects other threads could not, e.g. while a reader was stalled.
+            Memory::EpochDomain::Global().Reclaim();
+            Memory::HazardPointerDomain::Global().Reclaim();
         }
         return 0;
     }
 
-    Threading::Semaphore taskReadySemaphore;
+    Threading::Signal jobSignal;
+    Memory::Atomic<int32_t> queuedJobCount;
+    Memory::Atomic<int32_t> stopRequested;
     Threading::Mutex poolMutex;
     Platform::IThreadImplementation** workerThreads;
+    Utils::DelegateHandle* crashHandles;
     int32_t maxThreadCount;
     Containers::List<JobFunctionType> jobQueue;
     String poolName;
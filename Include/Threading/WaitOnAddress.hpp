@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Memory/Atomic.hpp"
+
+namespace Edvar::Threading {
+/**
+ * @brief Blocks the calling thread while Address holds Expected, using the platform's wait-on-address mechanism
+ * (futex on Linux, WaitOnAddress on Windows).
+ *
+ * Wakeups can be spurious, callers re-check their condition in a loop.
+ * @param Milliseconds Timeout, -1 waits indefinitely.
+ * @return false if the timeout elapsed.
+ */
+EDVAR_CPP_CORE_API bool WaitOnAddress(const Memory::Atomic<int32_t>& Address, int32_t Expected,
+                                      int32_t Milliseconds = -1);
+/** @brief Wakes one thread waiting on Address. */
+EDVAR_CPP_CORE_API void WakeOnAddress(const Memory::Atomic<int32_t>& Address);
+/** @brief Wakes every thread waiting on Address. */
+EDVAR_CPP_CORE_API void WakeAllOnAddress(const Memory::Atomic<int32_t>& Address);
+} // namespace Edvar::Threading
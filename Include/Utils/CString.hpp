@@ -64,24 +64,42 @@ int32_t ConvertString(const FromT* inString, ToT* buffer, const int32_t bufferLe
     return -1;
 }
 /**
- * Create a new converted string
+ * Create a new null-terminated converted string
  *
  * It is the caller's responsibility to delete the returned buffer
  * Should use `delete[]` to delete the returned buffer.
  */
 template <typename ToT, typename FromT> inline ToT* CreateConvertedString(const FromT* inString) {
-    const int32_t bufferLength = ConvertString<FromT, ToT>(inString, nullptr, 0);
-    if (bufferLength <= 0) {
+    const int32_t length = ConvertString<FromT, ToT>(inString, nullptr, 0);
+    if (length <= 0) {
         return nullptr;
     }
-    ToT* buffer = new ToT[bufferLength];
-    ConvertString<FromT, ToT>(inString, buffer, bufferLength);
+    // The required length may or may not count the terminator depending on the conversion, always add one.
+    ToT* buffer = new ToT[length + 1];
+    ConvertString<FromT, ToT>(inString, buffer, length);
+    buffer[length] = 0;
+    return buffer;
+}
+/**
+ * Create a null-terminated converted string in scratch memory
+ *
+ * The buffer is allocated from the calling thread's scratch allocator, it stays valid until the caller's enclosing
+ * `Memory::ScratchMarker` goes out of scope and must not be deleted.
+ */
+template <typename ToT, typename FromT> inline ToT* CreateScratchConvertedString(const FromT* inString) {
+    const int32_t length = ConvertString<FromT, ToT>(inString, nullptr, 0);
+    if (length <= 0) {
+        return nullptr;
+    }
+    ToT* buffer = Memory::ScratchAllocator::Get().AllocateArray<ToT>(length + 1);
+    ConvertString<FromT, ToT>(inString, buffer, length);
+    buffer[length] = 0;
     return buffer;
 }
 
-EDVAR_CPP_CORE_API int32_t ToLower(char16_t* inString, char16_t* outString, int32_t bufferLength,
+EDVAR_CPP_CORE_API int32_t ToLower(const char16_t* inString, char16_t* outString, int32_t bufferLength,
                                    const I18N::Locale* inLocale = nullptr);
-EDVAR_CPP_CORE_API int32_t ToUpper(char16_t* inString, char16_t* outString, int32_t bufferLength,
+EDVAR_CPP_CORE_API int32_t ToUpper(const char16_t* inString, char16_t* outString, int32_t bufferLength,
                                    const I18N::Locale* inLocale = nullptr);
 
 EDVAR_CPP_CORE_API uint64_t StringToUInt64(const char16_t* str, int32_t base = 10);
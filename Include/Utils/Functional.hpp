@@ -1,69 +1,245 @@
 #pragma once
 
 namespace Edvar::Utils {
+namespace _z__Private {
+/** @brief Bytes of callable state Function and UniqueFunction keep inline before falling back to the heap. */
+inline constexpr int32_t FunctionInlineSize = 48;
+
+/**
+ * @brief Hand-written vtable shared by all Function and UniqueFunction instances holding the same callable type.
+ */
+template <typename RetT, typename... ArgsT> struct FunctionVTable {
+    RetT (*Invoke)(void* Storage, ArgsT&&... Args);
+    /** Copy-constructs the callable into Destination, null for move-only callables. */
+    void (*Copy)(void* Destination, const void* Source);
+    /** Move-constructs the callable into Destination and destroys the one in Source. */
+    void (*Relocate)(void* Destination, void* Source);
+    void (*Destroy)(void* Storage);
+};
+
+template <typename FuncT, typename RetT, typename... ArgsT> struct FunctionCallable {
+    // Moving a Function never throws, so only callables that move without throwing live inline.
+    static constexpr bool IsInline = sizeof(FuncT) <= FunctionInlineSize &&
+                                     alignof(FuncT) <= alignof(std::max_align_t) &&
+                                     std::is_nothrow_move_constructible_v<FuncT>;
+
+    static FuncT& Get(void* Storage) {
+        if constexpr (IsInline) {
+            return *std::launder(reinterpret_cast<FuncT*>(Storage));
+        } else {
+            return **static_cast<FuncT**>(Storage);
+        }
+    }
+    template <typename... CtorArgsT> static void Construct(void* Storage, CtorArgsT&&... CtorArgs) {
+        if constexpr (IsInline) {
+            new (Storage) FuncT(std::forward<CtorArgsT>(CtorArgs)...);
+        } else {
+            *static_cast<FuncT**>(Storage) = new FuncT(std::forward<CtorArgsT>(CtorArgs)...);
+        }
+    }
+
+    static RetT Invoke(void* Storage, ArgsT&&... Args) { return Get(Storage)(std::forward<ArgsT>(Args)...); }
+    static void Copy(void* Destination, const void* Source) {
+        Construct(Destination, static_cast<const FuncT&>(Get(const_cast<void*>(Source))));
+    }
+    static void Relocate(void* Destination, void* Source) {
+        if constexpr (IsInline) {
+            FuncT& source = Get(Source);
+            new (Destination) FuncT(std::move(source));
+            source.~FuncT();
+        } else {
+            // Heap-stored callables only hand over the pointer.
+            *static_cast<FuncT**>(Destination) = *static_cast<FuncT**>(Source);
+        }
+    }
+    static void Destroy(void* Storage) {
+        if constexpr (IsInline) {
+            Get(Storage).~FuncT();
+        } else {
+            delete *static_cast<FuncT**>(Storage);
+        }
+    }
+
+    static constexpr void (*GetCopy())(void*, const void*) {
+        if constexpr (std::is_copy_constructible_v<FuncT>) {
+            return &Copy;
+        } else {
+            return nullptr;
+        }
+    }
+
+    static constexpr FunctionVTable<RetT, ArgsT...> VTable = {&Invoke, GetCopy(), &Relocate, &Destroy};
+};
+
+/**
+ * @brief Type-erased callable storage behind Function and UniqueFunction.
+ *
+ * Callables up to FunctionInlineSize bytes are constructed in place, larger ones on the heap. Either way the whole
+ * state is one buffer and a vtable pointer, one cache line, and an empty storage is a null vtable.
+ */
+template <typename RetT, typename... ArgsT> class FunctionStorage {
+public:
+    FunctionStorage() = default;
+    FunctionStorage(const FunctionStorage&) = delete;
+    FunctionStorage& operator=(const FunctionStorage&) = delete;
+    ~FunctionStorage() { Reset(); }
+
+    template <typename FuncT, typename... CtorArgsT> void Emplace(CtorArgsT&&... CtorArgs) {
+        Reset();
+        FunctionCallable<FuncT, RetT, ArgsT...>::Construct(buffer, std::forward<CtorArgsT>(CtorArgs)...);
+        vtable = &FunctionCallable<FuncT, RetT, ArgsT...>::VTable;
+    }
+
+    /** @brief Copies the callable of Other, which must be copyable. */
+    void CopyFrom(const FunctionStorage& Other) {
+        if (this == &Other) {
+            return;
+        }
+        Reset();
+        if (Other.vtable != nullptr) {
+            Other.vtable->Copy(buffer, Other.buffer);
+            vtable = Other.vtable;
+        }
+    }
+    void MoveFrom(FunctionStorage& Other) noexcept {
+        if (this == &Other) {
+            return;
+        }
+        Reset();
+        if (Other.vtable != nullptr) {
+            Other.vtable->Relocate(buffer, Other.buffer);
+            vtable = Other.vtable;
+            Other.vtable = nullptr;
+        }
+    }
+    void Reset() {
+        if (vtable != nullptr) {
+            vtable->Destroy(buffer);
+            vtable = nullptr;
+        }
+    }
+
+    [[nodiscard]] bool IsValid() const { return vtable != nullptr; }
+    [[nodiscard]] bool IsCopyable() const { return vtable == nullptr || vtable->Copy != nullptr; }
+
+    RetT Invoke(ArgsT&&... Args) const {
+        // Like calling through a pointer, a const Function may still run a callable that mutates its captures.
+        return vtable->Invoke(const_cast<unsigned char*>(buffer), std::forward<ArgsT>(Args)...);
+    }
+
+private:
+    alignas(std::max_align_t) unsigned char buffer[FunctionInlineSize];
+    const FunctionVTable<RetT, ArgsT...>* vtable = nullptr;
+};
+
+template <typename FuncT, typename FunctionT, typename RetT, typename... ArgsT>
+concept FunctionCompatible =
+    !std::is_same_v<std::decay_t<FuncT>, FunctionT> && std::is_invocable_r_v<RetT, std::decay_t<FuncT>&, ArgsT...>;
+} // namespace _z__Private
+
 template <typename Signature> struct Function;
+template <typename Signature> struct UniqueFunction;
 
+/**
+ * @brief Copyable type-erased callable. Captures up to _z__Private::FunctionInlineSize bytes are stored inline,
+ * constructing, copying or moving such a Function does not allocate.
+ */
 template <typename RetT, typename... ArgsT> struct Function<RetT(ArgsT...)> {
     using ReturnType = RetT;
     using ArgsTuple = std::tuple<ArgsT...>;
 
-private:
-    struct ICallable {
-        virtual ~ICallable() = default;
-        virtual RetT Invoke(ArgsT... args) = 0;
-        virtual ICallable* Clone() const = 0;
-    };
-
-    template <typename FuncT> struct CallableImpl : public ICallable {
-        FuncT func;
-        CallableImpl(FuncT&& f) : func(std::forward<FuncT>(f)) {}
-        RetT Invoke(ArgsT... args) override { return func(std::forward<ArgsT>(args)...); }
-        ICallable* Clone() const override { return new CallableImpl<FuncT>(*this); }
-    };
-    ICallable* callable = nullptr;
-
-public:
     Function() = default;
-    ~Function() { delete callable; }
 
-    Function(const Function& other) {
-        if (other.callable != nullptr) {
-            callable = other.callable->Clone();
+    Function(const Function& other) { callable.CopyFrom(other.callable); }
+    Function(Function&& other) noexcept { callable.MoveFrom(other.callable); }
+
+    Function(RetT (*funcPtr)(ArgsT...)) {
+        if (funcPtr != nullptr) {
+            callable.template Emplace<RetT (*)(ArgsT...)>(funcPtr);
         }
     }
-    Function(Function&& other) noexcept : callable(other.callable) { other.callable = nullptr; }
-
-    Function(RetT (*funcPtr)(ArgsT...)) : callable(new CallableImpl(funcPtr)) {}
     template <typename FuncT>
-    explicit Function(FuncT&& func) : callable(new CallableImpl<std::decay_t<FuncT>>(std::forward<FuncT>(func))) {}
+        requires(_z__Private::FunctionCompatible<FuncT, Function, RetT, ArgsT...> &&
+                 std::is_copy_constructible_v<std::decay_t<FuncT>>)
+    explicit Function(FuncT&& func) {
+        callable.template Emplace<std::decay_t<FuncT>>(std::forward<FuncT>(func));
+    }
 
-    [[nodiscard]] bool IsValid() const { return callable != nullptr; }
+    [[nodiscard]] bool IsValid() const { return callable.IsValid(); }
     RetT Invoke(ArgsT... args) const {
-        if (callable != nullptr) {
-            return callable->Invoke(std::forward<ArgsT>(args)...);
+        if (callable.IsValid()) {
+            return callable.Invoke(std::forward<ArgsT>(args)...);
         }
         InvalidInvocation();
     }
     operator bool() const { return IsValid(); }
     RetT operator()(ArgsT... args) const { return Invoke(std::forward<ArgsT>(args)...); }
     Function& operator=(const Function& other) {
-        if (this != &other) {
-            delete callable;
-            callable = other.callable != nullptr ? other.callable->Clone() : nullptr;
-        }
+        callable.CopyFrom(other.callable);
         return *this;
     }
     Function& operator=(Function&& other) noexcept {
-        if (this != &other) {
-            delete callable;
-            callable = other.callable;
-            other.callable = nullptr;
-        }
+        callable.MoveFrom(other.callable);
         return *this;
     }
 
 private:
+    template <typename> friend struct UniqueFunction;
+
     [[noreturn]] static void InvalidInvocation() { Platform::GetPlatform().OnFatalError(u"Invalid invocation of Function."); }
+
+    _z__Private::FunctionStorage<RetT, ArgsT...> callable;
+};
+
+/**
+ * @brief Move-only counterpart of Function for one-shot work like jobs and completion callbacks. Accepts callables
+ * that cannot be copied, and taking over a Function moves its callable without wrapping it.
+ */
+template <typename RetT, typename... ArgsT> struct UniqueFunction<RetT(ArgsT...)> {
+    using ReturnType = RetT;
+    using ArgsTuple = std::tuple<ArgsT...>;
+
+    UniqueFunction() = default;
+    UniqueFunction(const UniqueFunction&) = delete;
+    UniqueFunction(UniqueFunction&& other) noexcept { callable.MoveFrom(other.callable); }
+
+    UniqueFunction(RetT (*funcPtr)(ArgsT...)) {
+        if (funcPtr != nullptr) {
+            callable.template Emplace<RetT (*)(ArgsT...)>(funcPtr);
+        }
+    }
+    UniqueFunction(const Function<RetT(ArgsT...)>& other) { callable.CopyFrom(other.callable); }
+    UniqueFunction(Function<RetT(ArgsT...)>&& other) noexcept { callable.MoveFrom(other.callable); }
+    template <typename FuncT>
+        requires(_z__Private::FunctionCompatible<FuncT, UniqueFunction, RetT, ArgsT...> &&
+                 !std::is_same_v<std::decay_t<FuncT>, Function<RetT(ArgsT...)>>)
+    explicit UniqueFunction(FuncT&& func) {
+        callable.template Emplace<std::decay_t<FuncT>>(std::forward<FuncT>(func));
+    }
+
+    [[nodiscard]] bool IsValid() const { return callable.IsValid(); }
+    RetT Invoke(ArgsT... args) const {
+        if (callable.IsValid()) {
+            return callable.Invoke(std::forward<ArgsT>(args)...);
+        }
+        InvalidInvocation();
+    }
+    operator bool() const { return IsValid(); }
+    RetT operator()(ArgsT... args) const { return Invoke(std::forward<ArgsT>(args)...); }
+    UniqueFunction& operator=(const UniqueFunction&) = delete;
+    UniqueFunction& operator=(UniqueFunction&& other) noexcept {
+        callable.MoveFrom(other.callable);
+        return *this;
+    }
+
+    void Reset() { callable.Reset(); }
+
+private:
+    [[noreturn]] static void InvalidInvocation() {
+        Platform::GetPlatform().OnFatalError(u"Invalid invocation of UniqueFunction.");
+    }
+
+    _z__Private::FunctionStorage<RetT, ArgsT...> callable;
 };
 
 template <typename Signature> struct FunctionRef;
@@ -88,226 +264,387 @@ private:
 
 template <typename Signature> struct Delegate;
 
+/**
+ * @brief Single rebindable callback. The binding and its bound arguments share the inline storage of Function, so
+ * binding a method of a raw or weak object with a few bound arguments does not allocate.
+ */
 template <typename RetT, typename... ArgsT> struct Delegate<RetT(ArgsT...)> {
     using ReturnType = RetT;
     using ArgsTuple = std::tuple<ArgsT...>;
 
-private:
-    struct ICallable {
-        virtual ~ICallable() = default;
-        virtual RetT Invoke(ArgsT... args) = 0;
-        virtual ICallable* Clone() const = 0;
-    };
-
-    template <typename FuncT, typename... BoundArgumentsT> struct FreeCallableImpl : public ICallable {
-        FuncT func;
-        FreeCallableImpl(FuncT&& f, BoundArgumentsT&&... boundArgs)
-            : func(std::forward<FuncT>(f)), boundArguments(std::forward<BoundArgumentsT>(boundArgs)...) {}
-        RetT Invoke(ArgsT... args) override {
-            return boundArguments.template Apply<RetT>([&](BoundArgumentsT&&... boundVars) {
-                return func(std::forward<ArgsT>(args)..., std::forward<BoundArgumentsT>(boundVars)...);
-            });
-        }
-        ICallable* Clone() const override { return new FreeCallableImpl<FuncT>(func); }
-
-        Containers::Tuple<BoundArgumentsT...> boundArguments;
-    };
-
-    template <typename ObjT, typename MethodT, typename... BoundArgumentsT> struct RawCallableImpl : public ICallable {
-        ObjT* object;
-        MethodT method;
-        Containers::Tuple<BoundArgumentsT...> boundArguments;
-        RawCallableImpl(ObjT* obj, MethodT m, BoundArgumentsT&&... boundArgs)
-            : object(obj), method(m), boundArguments(std::forward<BoundArgumentsT>(boundArgs)...) {}
-        RetT Invoke(ArgsT... args) override {
-            return boundArguments.template Apply<RetT>([&](BoundArgumentsT&&... boundVars) {
-                return (object->*method)(std::forward<ArgsT>(args)..., std::forward<BoundArgumentsT>(boundVars)...);
-            });
-        }
-        ICallable* Clone() const override {
-            return new RawCallableImpl<ObjT, MethodT, BoundArgumentsT...>(object, method, boundArguments);
-        }
-    };
-
-    template <typename ObjT, typename MethodT, typename... BoundArgumentsT> struct WeakCallableImpl : public ICallable {
-        WeakPointer<ObjT> object;
-        MethodT method;
-        Containers::Tuple<BoundArgumentsT...> boundArguments;
-        WeakCallableImpl(const WeakPointer<ObjT>& obj, MethodT m, BoundArgumentsT&&... boundArgs)
-            : object(obj), method(m), boundArguments(std::forward<BoundArgumentsT>(boundArgs)...) {}
-        RetT Invoke(ArgsT... args) override {
-            if (SharedPointer<ObjT> objShared = object.Lock()) {
-                return boundArguments.template Apply<RetT>([&](BoundArgumentsT&&... boundVars) {
-                    return (objShared->*method)(std::forward<ArgsT>(args)...,
-                                                std::forward<BoundArgumentsT>(boundVars)...);
-                });
-            }
-            return RetT();
-        }
-        ICallable* Clone() const override { return new WeakCallableImpl<ObjT, MethodT>(object, method); }
-    };
-
-    template <typename ObjT, typename MethodT, typename... BoundArgumentsT>
-    struct SharedCallableImpl : public ICallable {
-        // It is shared, but we don't want to hold a hard reference to avoid ownership/lifetime issues. So hold as weak.
-        WeakPointer<ObjT> object;
-        MethodT method;
-        Containers::Tuple<BoundArgumentsT...> boundArguments;
-        SharedCallableImpl(const SharedPointer<ObjT>& obj, MethodT m, BoundArgumentsT&&... boundArgs)
-            : object(obj), method(m), boundArguments(std::forward<BoundArgumentsT>(boundArgs)...) {}
-        RetT Invoke(ArgsT... args) override {
-            if (object.IsValid()) {
-                return boundArguments.template Apply<RetT>([&](BoundArgumentsT&&... boundVars) {
-                    return (object->*method)(std::forward<ArgsT>(args)..., std::forward<BoundArgumentsT>(boundVars)...);
-                });
-            }
-            return RetT();
-        }
-        ICallable* Clone() const override {
-            return new SharedCallableImpl<ObjT, MethodT, BoundArgumentsT...>(object, method, boundArguments);
-        }
-    };
-
-    ICallable* binding = nullptr;
-
-public:
     Delegate() = default;
-    ~Delegate() { delete binding; }
+    Delegate(const Delegate& other) { binding.CopyFrom(other.binding); }
+    Delegate(Delegate&& other) noexcept { binding.MoveFrom(other.binding); }
+    Delegate& operator=(const Delegate& other) {
+        binding.CopyFrom(other.binding);
+        return *this;
+    }
+    Delegate& operator=(Delegate&& other) noexcept {
+        binding.MoveFrom(other.binding);
+        return *this;
+    }
 
-    [[nodiscard]] bool IsBound() const { return binding != nullptr; }
+    [[nodiscard]] bool IsBound() const { return binding.IsValid(); }
 
-    RetT Invoke(ArgsT&&... args) const {
-        if (binding != nullptr) {
-            return binding->Invoke(std::forward<ArgsT>(args)...);
+    RetT Invoke(ArgsT... args) const {
+        if (binding.IsValid()) {
+            return binding.Invoke(std::forward<ArgsT>(args)...);
         }
         Platform::GetPlatform().OnFatalError(u"Delegate: Attempted to invoke an invalid delegate.");
         // Make sure compile is happy about this.
         return RetT();
     }
 
+    template <typename FuncT>
+        requires(std::is_invocable_r_v<RetT, std::decay_t<FuncT>&, ArgsT...> &&
+                 std::is_copy_constructible_v<std::decay_t<FuncT>>)
+    void BindLambda(FuncT&& func) {
+        binding.template Emplace<std::decay_t<FuncT>>(std::forward<FuncT>(func));
+    }
+
     template <typename... BoundArgumentsT>
     void BindStatic(RetT (*func)(ArgsT..., std::decay_t<BoundArgumentsT>...), BoundArgumentsT&&... boundArgs) {
-        delete binding;
-        binding = new FreeCallableImpl<decltype(func)>(func, std::forward<BoundArgumentsT>(boundArgs)...);
+        BindLambda([func, ... boundVars = std::forward<BoundArgumentsT>(boundArgs)](ArgsT... args) -> RetT {
+            return func(std::forward<ArgsT>(args)..., boundVars...);
+        });
     }
 
     template <typename ObjectT, typename... BoundArgumentsT>
     void BindRaw(ObjectT* object, RetT (ObjectT::*method)(ArgsT..., std::decay_t<BoundArgumentsT>...),
                  BoundArgumentsT&&... boundArgs) {
-        delete binding;
-        binding = new RawCallableImpl<ObjectT, decltype(method), BoundArgumentsT...>(
-            object, method, std::forward<BoundArgumentsT>(boundArgs)...);
+        BindLambda([object, method, ... boundVars = std::forward<BoundArgumentsT>(boundArgs)](ArgsT... args) -> RetT {
+            return (object->*method)(std::forward<ArgsT>(args)..., boundVars...);
+        });
     }
 
+    /**
+     * @brief Binds a method of a shared object. The object is held weakly to avoid ownership/lifetime issues, once it
+     * is destroyed invoking returns a default value.
+     */
     template <typename ObjectT, typename... BoundArgumentsT>
     void BindShared(const SharedPointer<ObjectT>& object,
                     RetT (ObjectT::*method)(ArgsT..., std::decay_t<BoundArgumentsT>...),
                     BoundArgumentsT&&... boundArgs) {
-        delete binding;
-        binding = new SharedCallableImpl<ObjectT, decltype(method), BoundArgumentsT...>(
-            object, method, std::forward<BoundArgumentsT>(boundArgs)...);
+        BindWeak(WeakPointer<ObjectT>(object), method, std::forward<BoundArgumentsT>(boundArgs)...);
     }
 
     template <typename ObjectT, typename... BoundArgumentsT>
     void BindWeak(const WeakPointer<ObjectT>& object,
                   RetT (ObjectT::*method)(ArgsT..., std::decay_t<BoundArgumentsT>...), BoundArgumentsT&&... boundArgs) {
-        delete binding;
-        binding = new WeakCallableImpl<ObjectT, decltype(method), BoundArgumentsT...>(
-            object, method, std::forward<BoundArgumentsT>(boundArgs)...);
-    }
-
-    void Reset() {
-        delete binding;
-        binding = nullptr;
+        BindLambda([object, method, ... boundVars = std::forward<BoundArgumentsT>(boundArgs)](ArgsT... args) -> RetT {
+            if (const SharedPointer<ObjectT> objShared = object.Lock()) {
+                return (objShared.Get()->*method)(std::forward<ArgsT>(args)..., boundVars...);
+            }
+            return RetT();
+        });
     }
-};
 
-typedef int64_t DelegateHandle;
+    void Reset() { binding.Reset(); }
 
-template <typename Signature> struct MultiDelegate;
-template <typename... ArgsT> struct MultiDelegate<void(ArgsT...)> {
 private:
-    struct DelegateData {
-        Delegate<void(ArgsT...)> DelegateInstance;
-        DelegateHandle Handle;
-    };
-
-public:
-    using ArgsTuple = std::tuple<ArgsT...>;
+    _z__Private::FunctionStorage<RetT, ArgsT...> binding;
+};
 
-    DelegateHandle AddDelegate(const Delegate<void(ArgsT...)>& delegate) {
-        DelegateData data;
-        data.DelegateInstance = delegate;
-        data.Handle = NextHandle++;
-        Delegates.Push(data);
-        return data.Handle;
+typedef int64_t DelegateHandle;
+/** @brief Never returned for a binding, safe to use as "not bound" marker. */
+inline constexpr DelegateHandle InvalidDelegateHandle = 0;
+
+template <typename Signature, bool ThreadSafe = false> struct MultiDelegate;
+
+namespace _z__Private {
+/**
+ * @brief Add* helpers shared by both MultiDelegate variants, each builds a delegate and hands it to AddDelegate.
+ */
+template <typename MultiDelegateT, typename... ArgsT> struct MultiDelegateBinders {
+    using DelegateType = Delegate<void(ArgsT...)>;
+
+    template <typename FuncT> DelegateHandle AddLambda(FuncT&& func) {
+        DelegateType delegate;
+        delegate.BindLambda(std::forward<FuncT>(func));
+        return Self().AddDelegate(std::move(delegate));
     }
 
     template <typename... BoundArgumentsT>
     DelegateHandle AddStatic(void (*func)(ArgsT..., std::decay_t<BoundArgumentsT>...), BoundArgumentsT&&... boundArgs) {
-        Delegate<void(ArgsT...)> delegate;
+        DelegateType delegate;
         delegate.BindStatic(func, std::forward<BoundArgumentsT>(boundArgs)...);
-        return AddDelegate(delegate);
+        return Self().AddDelegate(std::move(delegate));
     }
 
     template <typename ObjectT, typename... BoundArgumentsT>
-    DelegateHandle AddRaw(ObjectT* object, void (*method)(ArgsT..., std::decay_t<BoundArgumentsT>...),
+    DelegateHandle AddRaw(ObjectT* object, void (ObjectT::*method)(ArgsT..., std::decay_t<BoundArgumentsT>...),
                           BoundArgumentsT&&... boundArgs) {
-        Delegate<void(ArgsT...)> delegate;
+        DelegateType delegate;
         delegate.BindRaw(object, method, std::forward<BoundArgumentsT>(boundArgs)...);
-        return AddDelegate(delegate);
+        return Self().AddDelegate(std::move(delegate));
     }
 
     template <typename ObjectT, typename... BoundArgumentsT>
     DelegateHandle AddShared(const SharedPointer<ObjectT>& object,
                              void (ObjectT::*method)(ArgsT..., std::decay_t<BoundArgumentsT>...),
                              BoundArgumentsT&&... boundArgs) {
-        Delegate<void(ArgsT...)> delegate;
+        DelegateType delegate;
         delegate.template BindShared<ObjectT, BoundArgumentsT...>(object, method,
                                                                   std::forward<BoundArgumentsT>(boundArgs)...);
-        return AddDelegate(delegate);
+        return Self().AddDelegate(std::move(delegate));
     }
 
     template <typename ObjectT, typename... BoundArgumentsT>
     DelegateHandle AddShared(const Memory::EnableSharedFromThis<ObjectT>* object,
                              void (ObjectT::*method)(ArgsT..., std::decay_t<BoundArgumentsT>...),
                              BoundArgumentsT&&... boundArgs) {
-        Delegate<void(ArgsT...)> delegate;
-        delegate.template BindShared<ObjectT, BoundArgumentsT...>(object->AsShared(), method,
-                                                                  std::forward<BoundArgumentsT>(boundArgs)...);
-        return AddDelegate(delegate);
+        DelegateType delegate;
+        delegate.template BindWeak<ObjectT, BoundArgumentsT...>(WeakPointer<ObjectT>(object->AsShared()), method,
+                                                                std::forward<BoundArgumentsT>(boundArgs)...);
+        return Self().AddDelegate(std::move(delegate));
     }
 
     template <typename ObjectT, typename... BoundArgumentsT>
     DelegateHandle AddWeak(const WeakPointer<ObjectT>& object,
                            void (ObjectT::*method)(ArgsT..., std::decay_t<BoundArgumentsT>...),
                            BoundArgumentsT&&... boundArgs) {
-        Delegate<void(ArgsT...)> delegate;
+        DelegateType delegate;
         delegate.template BindWeak<ObjectT, BoundArgumentsT...>(object, method,
                                                                 std::forward<BoundArgumentsT>(boundArgs)...);
-        return AddDelegate(delegate);
+        return Self().AddDelegate(std::move(delegate));
     }
 
-    void RemoveDelegate(DelegateHandle handle) {
-        for (int32_t i = 0; i < Delegates.Length(); ++i) {
-            if (Delegates[i].Handle == handle) {
-                Delegates.RemoveAt(i);
-                return;
-            }
+private:
+    MultiDelegateT& Self() { return static_cast<MultiDelegateT&>(*this); }
+};
+} // namespace _z__Private
+
+/**
+ * @brief List of delegates invoked together by Broadcast, for use from a single thread.
+ *
+ * Bindings live in a slot array. A handle encodes the slot index and the slot generation, so RemoveDelegate is O(1)
+ * and a stale handle never removes a newer binding reusing the slot. Broadcast walks the slots without allocating.
+ *
+ * Delegates may add and remove bindings while being broadcast: a removed binding is not invoked anymore but is only
+ * destroyed once the outermost Broadcast returns, an added binding is first invoked by the next Broadcast.
+ */
+template <typename... ArgsT>
+struct MultiDelegate<void(ArgsT...), false>
+    : _z__Private::MultiDelegateBinders<MultiDelegate<void(ArgsT...), false>, ArgsT...> {
+private:
+    using DelegateType = Delegate<void(ArgsT...)>;
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    struct Binding {
+        DelegateType DelegateInstance;
+        // Odd while bound, removing makes it even which invalidates the handles given out for it.
+        uint32_t Generation = 0;
+        uint32_t NextFree = InvalidIndex;
+    };
+
+public:
+    using ArgsTuple = std::tuple<ArgsT...>;
+
+    MultiDelegate() = default;
+    MultiDelegate(const MultiDelegate& other)
+        : bindings(other.bindings), pendingBindings(other.pendingBindings), freeListHead(other.freeListHead),
+          hasDeferredRemovals(other.hasDeferredRemovals) {
+        // The copy is not being broadcast, settle what the source deferred.
+        ApplyDeferredChanges();
+    }
+    MultiDelegate& operator=(const MultiDelegate& other) {
+        if (this != &other) {
+            bindings = other.bindings;
+            pendingBindings = other.pendingBindings;
+            freeListHead = other.freeListHead;
+            hasDeferredRemovals = other.hasDeferredRemovals;
+            ApplyDeferredChanges();
         }
+        return *this;
     }
 
-    void Clear() { Delegates.Resize(0); }
+    DelegateHandle AddDelegate(const DelegateType& delegate) { return AddDelegate(DelegateType(delegate)); }
+    DelegateHandle AddDelegate(DelegateType&& delegate) {
+        if (!delegate.IsBound()) {
+            return InvalidDelegateHandle;
+        }
+        if (broadcastDepth > 0) {
+            // Appending could move the binding being invoked, park the new one until the broadcast returns. It gets
+            // the index it will have once appended.
+            const uint32_t index = static_cast<uint32_t>(bindings.Length() + pendingBindings.Length());
+            pendingBindings.Add(Binding{std::move(delegate), 1, InvalidIndex});
+            return MakeHandle(index, 1);
+        }
+        uint32_t index;
+        if (freeListHead != InvalidIndex) {
+            index = freeListHead;
+            freeListHead = bindings[static_cast<int32_t>(index)].NextFree;
+        } else {
+            index = static_cast<uint32_t>(bindings.Add(Binding{}));
+        }
+        Binding& binding = bindings[static_cast<int32_t>(index)];
+        binding.DelegateInstance = std::move(delegate);
+        ++binding.Generation;
+        return MakeHandle(index, binding.Generation);
+    }
+
+    /**
+     * @brief Removes the binding the handle was returned for. Does nothing for stale or invalid handles.
+     * @return true if a binding was removed.
+     */
+    bool RemoveDelegate(const DelegateHandle handle) {
+        const uint32_t index = static_cast<uint32_t>(static_cast<uint64_t>(handle));
+        const uint32_t generation = static_cast<uint32_t>(static_cast<uint64_t>(handle) >> 32);
+        Binding* binding = FindBinding(index);
+        if (binding == nullptr || binding->Generation != generation || (generation & 1u) == 0) {
+            return false;
+        }
+        ++binding->Generation;
+        if (broadcastDepth > 0) {
+            // The delegate may be the one running, destroying it now would pull its captures from under it.
+            hasDeferredRemovals = true;
+        } else {
+            ReleaseSlot(index);
+        }
+        return true;
+    }
+
+    void Clear() {
+        for (int32_t i = 0; i < bindings.Length(); ++i) {
+            if ((bindings[i].Generation & 1u) != 0) {
+                ++bindings[i].Generation;
+                if (broadcastDepth == 0) {
+                    ReleaseSlot(static_cast<uint32_t>(i));
+                }
+            }
+        }
+        for (int32_t i = 0; i < pendingBindings.Length(); ++i) {
+            ++pendingBindings[i].Generation;
+        }
+        hasDeferredRemovals = broadcastDepth > 0;
+    }
 
     void Broadcast(ArgsT... args) {
-        for (int32_t i = 0; i < Delegates.Length(); ++i) {
-            DelegateData& delegate = Delegates[i];
-            delegate.DelegateInstance.Invoke(std::forward<ArgsT>(args)...);
+        ++broadcastDepth;
+        // Bindings added meanwhile are parked, the array neither grows nor moves during the walk.
+        const int32_t count = bindings.Length();
+        for (int32_t i = 0; i < count; ++i) {
+            const Binding& binding = bindings[i];
+            if ((binding.Generation & 1u) != 0) {
+                binding.DelegateInstance.Invoke(args...);
+            }
+        }
+        if (--broadcastDepth == 0 && (hasDeferredRemovals || pendingBindings.Length() > 0)) [[unlikely]] {
+            ApplyDeferredChanges();
+        }
+    }
+
+private:
+    static DelegateHandle MakeHandle(const uint32_t index, const uint32_t generation) {
+        return static_cast<DelegateHandle>((static_cast<uint64_t>(generation) << 32) | index);
+    }
+
+    Binding* FindBinding(const uint32_t index) {
+        const uint32_t boundCount = static_cast<uint32_t>(bindings.Length());
+        if (index < boundCount) {
+            return &bindings[static_cast<int32_t>(index)];
+        }
+        if (index - boundCount < static_cast<uint32_t>(pendingBindings.Length())) {
+            return &pendingBindings[static_cast<int32_t>(index - boundCount)];
+        }
+        return nullptr;
+    }
+
+    void ReleaseSlot(const uint32_t index) {
+        Binding& binding = bindings[static_cast<int32_t>(index)];
+        binding.DelegateInstance.Reset();
+        binding.NextFree = freeListHead;
+        freeListHead = index;
+    }
+
+    void ApplyDeferredChanges() {
+        for (int32_t i = 0; i < pendingBindings.Length(); ++i) {
+            bindings.Add(std::move(pendingBindings[i]));
+        }
+        // Moved-from bindings hold no delegate, there is nothing left to destroy.
+        pendingBindings.Resize(0);
+        if (hasDeferredRemovals) {
+            // Removed during a broadcast: generation already even but the delegate is still bound.
+            for (int32_t i = 0; i < bindings.Length(); ++i) {
+                if ((bindings[i].Generation & 1u) == 0 && bindings[i].DelegateInstance.IsBound()) {
+                    ReleaseSlot(static_cast<uint32_t>(i));
+                }
+            }
+            hasDeferredRemovals = false;
+        }
+    }
+
+    Containers::List<Binding> bindings;
+    Containers::List<Binding> pendingBindings;
+    uint32_t freeListHead = InvalidIndex;
+    int32_t broadcastDepth = 0;
+    bool hasDeferredRemovals = false;
+};
+
+/**
+ * @brief MultiDelegate which may be bound, unbound and broadcast from any thread.
+ *
+ * The bindings are a Memory::Published list: Broadcast reads a snapshot without taking a lock or allocating, adding
+ * and removing copy the list under the writer lock, so they are O(n). A binding removed while another thread
+ * broadcasts may still be invoked by that broadcast, it is destroyed once no snapshot can reference it anymore.
+ */
+template <typename... ArgsT>
+struct MultiDelegate<void(ArgsT...), true>
+    : _z__Private::MultiDelegateBinders<MultiDelegate<void(ArgsT...), true>, ArgsT...> {
+private:
+    using DelegateType = Delegate<void(ArgsT...)>;
+
+    struct Binding {
+        DelegateType DelegateInstance;
+        DelegateHandle Handle;
+    };
+
+public:
+    using ArgsTuple = std::tuple<ArgsT...>;
+
+    MultiDelegate() : nextHandle(1) {}
+    MultiDelegate(const MultiDelegate&) = delete;
+    MultiDelegate& operator=(const MultiDelegate&) = delete;
+
+    DelegateHandle AddDelegate(const DelegateType& delegate) { return AddDelegate(DelegateType(delegate)); }
+    DelegateHandle AddDelegate(DelegateType&& delegate) {
+        if (!delegate.IsBound()) {
+            return InvalidDelegateHandle;
+        }
+        const DelegateHandle handle = nextHandle.FetchAdd(1, Memory::MemoryOrder::Relaxed);
+        bindings.Update([&](Containers::List<Binding>& list) { list.Add(Binding{std::move(delegate), handle}); });
+        return handle;
+    }
+
+    /**
+     * @brief Removes the binding the handle was returned for. Does nothing for stale or invalid handles.
+     * @return true if a binding was removed.
+     */
+    bool RemoveDelegate(const DelegateHandle handle) {
+        bool removed = false;
+        bindings.Update([&](Containers::List<Binding>& list) {
+            for (int32_t i = 0; i < list.Length(); ++i) {
+                if (list[i].Handle == handle) {
+                    list.RemoveAt(i);
+                    removed = true;
+                    return;
+                }
+            }
+        });
+        return removed;
+    }
+
+    void Clear() { bindings.Publish(Containers::List<Binding>()); }
+
+    void Broadcast(ArgsT... args) const {
+        const auto snapshot = bindings.Read();
+        for (int32_t i = 0; i < snapshot->Length(); ++i) {
+            snapshot->Get(i).DelegateInstance.Invoke(args...);
         }
     }
 
 private:
-    Containers::List<DelegateData> Delegates;
-    DelegateHandle NextHandle = 1;
+    Memory::Published<Containers::List<Binding>> bindings;
+    Memory::Atomic<DelegateHandle> nextHandle;
 };
 } // namespace Edvar::Utils
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "Containers/BitArray.hpp"
+#include "Platform/CPUFeatures.hpp"
+
+#ifndef EDVAR_CPP_CORE_MATH_ALLOW_SIMD
+#    define EDVAR_CPP_CORE_MATH_ALLOW_SIMD 1
+#endif
+
+#ifndef EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX
+#    define EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX 1 // Enable AVX by default, this can be disabled
+#endif
+
+// The AVX2 kernels are built with a target attribute next to the portable ones and only picked when the running
+// machine supports them. 32-bit x86 lacks the 64-bit lane extracts they use.
+#if EDVAR_CPP_CORE_MATH_ALLOW_SIMD && EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX &&                                         \
+    (defined(_M_AMD64) || defined(_M_X64) || defined(__x86_64__))
+#    define EDVAR_CPP_CORE_BITARRAY_AVX2 1
+#    include <immintrin.h>
+#else
+#    define EDVAR_CPP_CORE_BITARRAY_AVX2 0
+#endif
+
+namespace Edvar::Containers::_BitArrayPrivate {
+namespace {
+namespace Scalar {
+void AndWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    for (int32_t i = 0; i < Count; ++i) {
+        Destination[i] &= Source[i];
+    }
+}
+void OrWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    for (int32_t i = 0; i < Count; ++i) {
+        Destination[i] |= Source[i];
+    }
+}
+void XorWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    for (int32_t i = 0; i < Count; ++i) {
+        Destination[i] ^= Source[i];
+    }
+}
+int64_t CountSetBits(const uint64_t* Words, const int32_t Count) {
+    int64_t result = 0;
+    for (int32_t i = 0; i < Count; ++i) {
+        result += std::popcount(Words[i]);
+    }
+    return result;
+}
+} // namespace Scalar
+
+#if EDVAR_CPP_CORE_BITARRAY_AVX2
+namespace AVX2 {
+enum class WordOperation : uint8_t { And, Or, Xor };
+
+template <WordOperation Operation>
+EDVAR_CPP_CORE_TARGET_AVX2 void ApplyWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    int32_t i = 0;
+    for (; i + 4 <= Count; i += 4) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Destination + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Source + i));
+        __m256i result;
+        if constexpr (Operation == WordOperation::And) {
+            result = _mm256_and_si256(a, b);
+        } else if constexpr (Operation == WordOperation::Or) {
+            result = _mm256_or_si256(a, b);
+        } else {
+            result = _mm256_xor_si256(a, b);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination + i), result);
+    }
+    for (; i < Count; ++i) {
+        if constexpr (Operation == WordOperation::And) {
+            Destination[i] &= Source[i];
+        } else if constexpr (Operation == WordOperation::Or) {
+            Destination[i] |= Source[i];
+        } else {
+            Destination[i] ^= Source[i];
+        }
+    }
+}
+
+EDVAR_CPP_CORE_TARGET_AVX2 void AndWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    ApplyWords<WordOperation::And>(Destination, Source, Count);
+}
+EDVAR_CPP_CORE_TARGET_AVX2 void OrWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    ApplyWords<WordOperation::Or>(Destination, Source, Count);
+}
+EDVAR_CPP_CORE_TARGET_AVX2 void XorWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    ApplyWords<WordOperation::Xor>(Destination, Source, Count);
+}
+
+EDVAR_CPP_CORE_TARGET_AVX2 int64_t CountSetBits(const uint64_t* Words, const int32_t Count) {
+    // Per nibble lookup with a byte shuffle, summed into 64-bit lanes with SAD against zero.
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1,
+                                            2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowMask = _mm256_set1_epi8(0x0F);
+    __m256i total = _mm256_setzero_si256();
+    int32_t i = 0;
+    for (; i + 4 <= Count; i += 4) {
+        const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Words + i));
+        const __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(words, lowMask));
+        const __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(words, 4), lowMask));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+    }
+    int64_t result = _mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+                     _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3);
+    for (; i < Count; ++i) {
+        result += std::popcount(Words[i]);
+    }
+    return result;
+}
+} // namespace AVX2
+#endif
+
+struct KernelTable {
+    void (*And)(uint64_t* Destination, const uint64_t* Source, int32_t Count);
+    void (*Or)(uint64_t* Destination, const uint64_t* Source, int32_t Count);
+    void (*Xor)(uint64_t* Destination, const uint64_t* Source, int32_t Count);
+    int64_t (*CountSetBits)(const uint64_t* Words, int32_t Count);
+};
+
+KernelTable SelectKernels() {
+#if EDVAR_CPP_CORE_BITARRAY_AVX2
+    // Every extension EDVAR_CPP_CORE_TARGET_AVX2 lets the compiler use, not only the ones the intrinsics name
+    if (Platform::HasTargetAVX2Features()) {
+        return {AVX2::AndWords, AVX2::OrWords, AVX2::XorWords, AVX2::CountSetBits};
+    }
+#endif
+    return {Scalar::AndWords, Scalar::OrWords, Scalar::XorWords, Scalar::CountSetBits};
+}
+
+EDVAR_CPP_CORE_FORCE_INLINE const KernelTable& GetKernels() {
+    static const KernelTable kernels = SelectKernels();
+    return kernels;
+}
+} // namespace
+
+void AndWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    GetKernels().And(Destination, Source, Count);
+}
+void OrWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    GetKernels().Or(Destination, Source, Count);
+}
+void XorWords(uint64_t* Destination, const uint64_t* Source, const int32_t Count) {
+    GetKernels().Xor(Destination, Source, Count);
+}
+int64_t CountSetBitsInWords(const uint64_t* Words, const int32_t Count) {
+    return GetKernels().CountSetBits(Words, Count);
+}
+} // namespace Edvar::Containers::_BitArrayPrivate
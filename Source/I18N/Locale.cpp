@@ -1,5 +1,5 @@
 ﻿#include "I18N/Locale.hpp"
-#include "Threading/Mutex.hpp"
+#include "Memory/Published.hpp"
 #include "Utils/CString.hpp"
 #include "unicode/locid.h"
 #include "unicode/uclean.h"
@@ -7,8 +7,7 @@
 
 namespace Edvar::I18N {
 
-Containers::List<Locale*> Locale::createdLocales;
-Threading::Mutex Locale::createdLocalesMutex;
+Memory::Published<Containers::List<Locale::RegisteredLocale>> Locale::createdLocales;
 
 extern "C" const char U_ICUDATA_ENTRY_POINT[];
 
@@ -19,18 +18,18 @@ static struct AutoInitICU {
         if (udata_setCommonData(&U_ICUDATA_ENTRY_POINT, &errorCode); U_FAILURE(errorCode)) {
             const char* errorName = u_errorName(errorCode);
             Platform::GetPlatform().PrintMessageToDebugger(u"Error setting ICU common data: \n");
-            const auto* converted = Utils::CStrings::CreateConvertedString<char16_t>(errorName);
-            Platform::GetPlatform().PrintMessageToDebugger(converted);
-            delete[] converted;
+            const Memory::ScratchMarker scratch;
+            Platform::GetPlatform().PrintMessageToDebugger(
+                Utils::CStrings::CreateScratchConvertedString<char16_t>(errorName));
         }
         errorCode = U_ZERO_ERROR;
         u_init(&errorCode);
         if (U_FAILURE(errorCode)) {
             const char* errorName = u_errorName(errorCode);
             Platform::GetPlatform().PrintMessageToDebugger(u"Error initializing ICU: \n");
-            const auto* converted = Utils::CStrings::CreateConvertedString<char16_t>(errorName);
-            Platform::GetPlatform().PrintMessageToDebugger(converted);
-            delete[] converted;
+            const Memory::ScratchMarker scratch;
+            Platform::GetPlatform().PrintMessageToDebugger(
+                Utils::CStrings::CreateScratchConvertedString<char16_t>(errorName));
         }
     }
 } autoInitICUInstance;
@@ -55,31 +54,51 @@ Locale::Locale(const char16_t* language, const char16_t* country, const char16_t
 
     icuLocale = new icu::Locale(langBuffer, countryBuffer, variantBuffer);
     if (addToRegistry) {
-        Threading::ScopedLock lock(createdLocalesMutex);
-        createdLocales.Add(this);
+        createdLocales.Update([this](Containers::List<RegisteredLocale>& locales) { locales.Add({this, icuLocale}); });
     }
     delete[] langBuffer;
     delete[] countryBuffer;
     delete[] variantBuffer;
 }
 Locale::~Locale() {
-    Threading::ScopedLock lock(createdLocalesMutex);
-    createdLocales.Remove(this);
-    delete static_cast<icu::Locale*>(icuLocale);
+    bool registered = false;
+    {
+        // Temporary locales are never registered, spare them the copy of the registry.
+        const auto locales = createdLocales.Read();
+        for (int32_t i = 0; i < locales->Length() && !registered; ++i) {
+            registered = locales->Get(i).Owner == this;
+        }
+    }
+    if (!registered) {
+        delete static_cast<icu::Locale*>(icuLocale);
+        return;
+    }
+    createdLocales.Update([this](Containers::List<RegisteredLocale>& locales) {
+        for (int32_t i = 0; i < locales.Length(); ++i) {
+            if (locales[i].Owner == this) {
+                locales.RemoveAt(i);
+                return;
+            }
+        }
+    });
+    // Find may still be comparing against it through an older snapshot.
+    Memory::EpochDomain::Global().Retire(static_cast<icu::Locale*>(icuLocale));
 }
 const Locale* Locale::Find(const char16_t* language, const char16_t* country, const char16_t* variant) {
     // try to find in existing locales
     const Locale tempLocale(language, country, variant, false);
     if (tempLocale.icuLocale == nullptr)
         return nullptr;
-    Threading::ScopedLock lock(createdLocalesMutex);
-    for (int i = 0; i < createdLocales.Length(); ++i) {
-        const Locale* locale = createdLocales.Get(i);
-        if (locale->icuLocale == nullptr)
-            continue;
-        if (const auto* icuLocalePtr = static_cast<icu::Locale*>(locale->icuLocale);
-            *icuLocalePtr == *static_cast<icu::Locale*>(tempLocale.icuLocale)) {
-            return locale;
+    {
+        const auto locales = createdLocales.Read();
+        for (int i = 0; i < locales->Length(); ++i) {
+            const RegisteredLocale& locale = locales->Get(i);
+            if (locale.IcuLocale == nullptr)
+                continue;
+            if (const auto* icuLocalePtr = static_cast<const icu::Locale*>(locale.IcuLocale);
+                *icuLocalePtr == *static_cast<icu::Locale*>(tempLocale.icuLocale)) {
+                return locale.Owner;
+            }
         }
     }
     // linear-search couldn't find it, create a new one
@@ -94,18 +113,16 @@ const Locale& Locale::Default() {
     static Locale* defaultLocale = nullptr;
     if (defaultLocale == nullptr) [[unlikely]] {
         const icu::Locale& icuDefaultLocale = icu::Locale::getDefault();
-        const auto* country = Utils::CStrings::CreateConvertedString<char16_t>(icuDefaultLocale.getCountry());
-        const auto* language = Utils::CStrings::CreateConvertedString<char16_t>(icuDefaultLocale.getLanguage());
-        const auto* variant = Utils::CStrings::CreateConvertedString<char16_t>(icuDefaultLocale.getVariant());
+        const Memory::ScratchMarker scratch;
+        const auto* country = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuDefaultLocale.getCountry());
+        const auto* language = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuDefaultLocale.getLanguage());
+        const auto* variant = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuDefaultLocale.getVariant());
 
         const Locale* foundLocale = Find(language, country, variant);
         defaultLocale = const_cast<Locale*>(foundLocale);
         if (defaultLocale == nullptr) {
             defaultLocale = const_cast<Locale*>(&Invariant());
         }
-        delete[] country;
-        delete[] language;
-        delete[] variant;
     }
     return *defaultLocale;
 }
@@ -113,15 +130,14 @@ const Locale& Locale::Invariant() {
     static Locale* invariantLocale = nullptr;
     if (invariantLocale == nullptr) [[unlikely]] {
         const icu::Locale& icuInvariantLocale = icu::Locale::getRoot();
-        const auto* country = Utils::CStrings::CreateConvertedString<char16_t>(icuInvariantLocale.getCountry());
-        const auto* language = Utils::CStrings::CreateConvertedString<char16_t>(icuInvariantLocale.getLanguage());
-        const auto* variant = Utils::CStrings::CreateConvertedString<char16_t>(icuInvariantLocale.getVariant());
+        const Memory::ScratchMarker scratch;
+        const auto* country = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuInvariantLocale.getCountry());
+        const auto* language =
+            Utils::CStrings::CreateScratchConvertedString<char16_t>(icuInvariantLocale.getLanguage());
+        const auto* variant = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuInvariantLocale.getVariant());
         const Locale* foundLocale = Find(language, country, variant);
         invariantLocale = const_cast<Locale*>(foundLocale);
         // This should always be found
-        delete[] country;
-        delete[] language;
-        delete[] variant;
     }
     return *invariantLocale;
 }
@@ -129,15 +145,13 @@ const Locale& Locale::English() {
     static Locale* englishLocale = nullptr;
     if (englishLocale == nullptr) [[unlikely]] {
         icu::Locale icuEnglishLocale = icu::Locale::getEnglish();
-        auto* country = Utils::CStrings::CreateConvertedString<char16_t>(icuEnglishLocale.getCountry());
-        auto* language = Utils::CStrings::CreateConvertedString<char16_t>(icuEnglishLocale.getLanguage());
-        auto* variant = Utils::CStrings::CreateConvertedString<char16_t>(icuEnglishLocale.getVariant());
+        const Memory::ScratchMarker scratch;
+        auto* country = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuEnglishLocale.getCountry());
+        auto* language = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuEnglishLocale.getLanguage());
+        auto* variant = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuEnglishLocale.getVariant());
         const Locale* foundLocale = Find(language, country, variant);
         englishLocale = const_cast<Locale*>(foundLocale);
         // This should always be found
-        delete[] country;
-        delete[] language;
-        delete[] variant;
     }
     return *englishLocale;
 }
@@ -145,17 +159,15 @@ const Locale& Locale::Turkish() {
     static Locale* turkishLocale = nullptr;
     if (turkishLocale == nullptr) [[unlikely]] {
         icu::Locale icuEnglishLocale = icu::Locale("tr", "TR");
-        auto* country = Utils::CStrings::CreateConvertedString<char16_t>(icuEnglishLocale.getCountry());
-        auto* language = Utils::CStrings::CreateConvertedString<char16_t>(icuEnglishLocale.getLanguage());
-        auto* variant = Utils::CStrings::CreateConvertedString<char16_t>(icuEnglishLocale.getVariant());
+        const Memory::ScratchMarker scratch;
+        auto* country = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuEnglishLocale.getCountry());
+        auto* language = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuEnglishLocale.getLanguage());
+        auto* variant = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuEnglishLocale.getVariant());
         const Locale* foundLocale = Find(language, country, variant);
         if (foundLocale == nullptr) {
             foundLocale = &Default();
         }
         turkishLocale = const_cast<Locale*>(foundLocale);
-        delete[] country;
-        delete[] language;
-        delete[] variant;
     }
     return *turkishLocale;
 }
@@ -163,15 +175,13 @@ const Locale& Locale::Japanese() {
     static Locale* japaneseLocale = nullptr;
     if (japaneseLocale == nullptr) [[unlikely]] {
         icu::Locale icuJapaneseLocale = icu::Locale::getJapanese();
-        auto* country = Utils::CStrings::CreateConvertedString<char16_t>(icuJapaneseLocale.getCountry());
-        auto* language = Utils::CStrings::CreateConvertedString<char16_t>(icuJapaneseLocale.getLanguage());
-        auto* variant = Utils::CStrings::CreateConvertedString<char16_t>(icuJapaneseLocale.getVariant());
+        const Memory::ScratchMarker scratch;
+        auto* country = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuJapaneseLocale.getCountry());
+        auto* language = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuJapaneseLocale.getLanguage());
+        auto* variant = Utils::CStrings::CreateScratchConvertedString<char16_t>(icuJapaneseLocale.getVariant());
         const Locale* foundLocale = Find(language, country, variant);
         japaneseLocale = const_cast<Locale*>(foundLocale);
         // This should always be found
-        delete[] country;
-        delete[] language;
-        delete[] variant;
     }
     return *japaneseLocale;
 }
@@ -0,0 +1,99 @@
+#include "Math/BatchQuaternion.hpp"
+#include "Math/All.hpp"
+
+namespace Edvar::Math {
+namespace {
+using Lanes = SIMD::Float_8;
+constexpr int32_t BatchWidth = Quaternionx8::Width;
+
+// BatchWidth elements, value initialized past the ones copied in
+template <typename ElementT> struct PaddedGroup {
+    ElementT Elements[BatchWidth] = {};
+
+    PaddedGroup() = default;
+    PaddedGroup(const ElementT* elements, const int32_t count) {
+        for (int32_t i = 0; i < count; ++i) {
+            Elements[i] = elements[i];
+        }
+    }
+};
+
+/**
+ * Calls step(out + i, in + i...) for every group of BatchWidth elements. A trailing partial group is copied into
+ * padded groups first and only its real elements are copied back to out.
+ */
+template <typename OutT, typename StepT, typename... InTs>
+void ForEachGroup(const int32_t count, OutT* out, const StepT& step, const InTs*... in) {
+    int32_t i = 0;
+    for (; i + BatchWidth <= count; i += BatchWidth) {
+        step(out + i, (in + i)...);
+    }
+    const int32_t remaining = count - i;
+    if (remaining > 0) {
+        PaddedGroup<OutT> tail;
+        step(tail.Elements, PaddedGroup<InTs>(in + i, remaining).Elements...);
+        for (int32_t j = 0; j < remaining; ++j) {
+            out[i + j] = tail.Elements[j];
+        }
+    }
+}
+} // namespace
+
+void MultiplyQuaternions(const Quaternion* a, const Quaternion* b, Quaternion* out, const int32_t count) {
+    ForEachGroup(
+        count, out,
+        [](Quaternion* groupOut, const Quaternion* groupA, const Quaternion* groupB) {
+            (Quaternionx8::Load(groupA) * Quaternionx8::Load(groupB)).Store(groupOut);
+        },
+        a, b);
+}
+
+void NormalizeQuaternions(const Quaternion* in, Quaternion* out, const int32_t count) {
+    ForEachGroup(
+        count, out,
+        [](Quaternion* groupOut, const Quaternion* groupIn) {
+            Quaternionx8::Load(groupIn).Normalized().Store(groupOut);
+        },
+        in);
+}
+
+void NlerpQuaternions(const Quaternion* a, const Quaternion* b, const float* alphas, Quaternion* out,
+                      const int32_t count) {
+    ForEachGroup(
+        count, out,
+        [](Quaternion* groupOut, const Quaternion* groupA, const Quaternion* groupB, const float* groupAlphas) {
+            const Lanes alpha = Lanes::LoadUnaligned(groupAlphas);
+            Quaternionx8::Nlerp(Quaternionx8::Load(groupA), Quaternionx8::Load(groupB), alpha).Store(groupOut);
+        },
+        a, b, alphas);
+}
+
+void SlerpQuaternions(const Quaternion* a, const Quaternion* b, const float* alphas, Quaternion* out,
+                      const int32_t count) {
+    ForEachGroup(
+        count, out,
+        [](Quaternion* groupOut, const Quaternion* groupA, const Quaternion* groupB, const float* groupAlphas) {
+            const Lanes alpha = Lanes::LoadUnaligned(groupAlphas);
+            Quaternionx8::Slerp(Quaternionx8::Load(groupA), Quaternionx8::Load(groupB), alpha).Store(groupOut);
+        },
+        a, b, alphas);
+}
+
+void RotateVectors(const Quaternion* rotations, const Vector3f* in, Vector3f* out, const int32_t count) {
+    ForEachGroup(
+        count, out,
+        [](Vector3f* groupOut, const Quaternion* groupRotations, const Vector3f* groupIn) {
+            Quaternionx8::Load(groupRotations).RotateVector(Vector3fx8::Load(groupIn)).Store(groupOut);
+        },
+        rotations, in);
+}
+
+void ToRotationMatrices(const Quaternion* in, Matrix4x4f* out, const int32_t count) {
+    ForEachGroup(
+        count, out,
+        [](Matrix4x4f* groupOut, const Quaternion* groupIn) {
+            Quaternionx8::Load(groupIn).ToRotationMatrix().Store(groupOut);
+        },
+        in);
+}
+} // namespace Edvar::Math
@@ -0,0 +1,319 @@
+#include "Math/BatchTransform.hpp"
+#include "Platform/RuntimeDispatch.hpp"
+
+namespace Edvar::Math {
+namespace {
+// The kernels in BatchTransformKernels.inl are built once per instruction set, see Platform/RuntimeDispatch.hpp. The
+// lanes types use the raw intrinsic types instead of the SIMD wrappers, those are bound to the instruction set the
+// translation unit is compiled for.
+
+#if EDVAR_CPP_CORE_DISPATCH_AVX2
+namespace AVX2 {
+#    define EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_TARGET_AVX2
+struct FloatLanes {
+    using ScalarType = float;
+    using VectorType = __m256;
+    static constexpr int32_t Width = 8;
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static VectorType Load(const float* ptr) {
+        return _mm256_loadu_ps(ptr);
+    }
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static void Store(float* ptr, const VectorType v) {
+        _mm256_storeu_ps(ptr, v);
+    }
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static VectorType Splat(const float value) {
+        return _mm256_set1_ps(value);
+    }
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static VectorType MulAdd(const VectorType a,
+                                                                                        const VectorType b,
+                                                                                        const VectorType c) {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+    // Points 0-3 go to the low halves and points 4-7 to the high halves, so the SSE shuffles below work per half.
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static void LoadPoints(const float* in, VectorType& x,
+                                                                                      VectorType& y, VectorType& z) {
+        const __m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in)), _mm_loadu_ps(in + 12), 1);
+        const __m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 4)), _mm_loadu_ps(in + 16), 1);
+        const __m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 8)), _mm_loadu_ps(in + 20), 1);
+        const __m256 ab = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+        const __m256 bc = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+        x = _mm256_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm256_shuffle_ps(ab, bc, _MM_SHUFFLE(3, 1, 2, 0));
+        z = _mm256_shuffle_ps(ab, c, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static void StorePoints(float* out, const VectorType x,
+                                                                                       const VectorType y,
+                                                                                       const VectorType z) {
+        const __m256 xyLow = _mm256_unpacklo_ps(x, y);
+        const __m256 xyHigh = _mm256_unpackhi_ps(x, y);
+        const __m256 a = _mm256_shuffle_ps(xyLow, _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+                                           _MM_SHUFFLE(2, 0, 1, 0));
+        const __m256 b = _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), xyHigh,
+                                           _MM_SHUFFLE(1, 0, 2, 0));
+        const __m256 c = _mm256_shuffle_ps(_mm256_shuffle_ps(z, xyHigh, _MM_SHUFFLE(2, 2, 2, 2)),
+                                           _mm256_shuffle_ps(xyHigh, z, _MM_SHUFFLE(3, 3, 3, 3)),
+                                           _MM_SHUFFLE(2, 0, 2, 0));
+        _mm_storeu_ps(out, _mm256_castps256_ps128(a));
+        _mm_storeu_ps(out + 4, _mm256_castps256_ps128(b));
+        _mm_storeu_ps(out + 8, _mm256_castps256_ps128(c));
+        _mm_storeu_ps(out + 12, _mm256_extractf128_ps(a, 1));
+        _mm_storeu_ps(out + 16, _mm256_extractf128_ps(b, 1));
+        _mm_storeu_ps(out + 20, _mm256_extractf128_ps(c, 1));
+    }
+};
+struct DoubleLanes {
+    using ScalarType = double;
+    using VectorType = __m256d;
+    static constexpr int32_t Width = 4;
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static VectorType Load(const double* ptr) {
+        return _mm256_loadu_pd(ptr);
+    }
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static void Store(double* ptr, const VectorType v) {
+        _mm256_storeu_pd(ptr, v);
+    }
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static VectorType Splat(const double value) {
+        return _mm256_set1_pd(value);
+    }
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static VectorType MulAdd(const VectorType a,
+                                                                                        const VectorType b,
+                                                                                        const VectorType c) {
+        return _mm256_fmadd_pd(a, b, c);
+    }
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static void LoadPoints(const double* in, VectorType& x,
+                                                                                      VectorType& y, VectorType& z) {
+        // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+        const __m256d a = _mm256_loadu_pd(in);
+        const __m256d b = _mm256_loadu_pd(in + 4);
+        const __m256d c = _mm256_loadu_pd(in + 8);
+        const __m256d p = _mm256_blend_pd(a, b, 0b1100);      // x0 y0 x2 y2
+        const __m256d q = _mm256_permute2f128_pd(a, c, 0x21); // z0 x1 z2 x3
+        const __m256d r = _mm256_blend_pd(b, c, 0b1100);      // y1 z1 y3 z3
+        x = _mm256_shuffle_pd(p, q, 0b1010);
+        y = _mm256_shuffle_pd(p, r, 0b0101);
+        z = _mm256_shuffle_pd(q, r, 0b1010);
+    }
+    EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE static void StorePoints(double* out, const VectorType x,
+                                                                                       const VectorType y,
+                                                                                       const VectorType z) {
+        const __m256d p = _mm256_shuffle_pd(x, y, 0b0000); // x0 y0 x2 y2
+        const __m256d q = _mm256_shuffle_pd(z, x, 0b1010); // z0 x1 z2 x3
+        const __m256d r = _mm256_shuffle_pd(y, z, 0b1111); // y1 z1 y3 z3
+        _mm256_storeu_pd(out, _mm256_permute2f128_pd(p, q, 0x20));
+        _mm256_storeu_pd(out + 4, _mm256_blend_pd(r, p, 0b1100));
+        _mm256_storeu_pd(out + 8, _mm256_permute2f128_pd(q, r, 0x31));
+    }
+};
+#    include "BatchTransformKernels.inl"
+#    undef EDVAR_CPP_CORE_DISPATCH_TARGET
+} // namespace AVX2
+#endif
+
+#if EDVAR_CPP_CORE_DISPATCH_X86
+namespace SSE2 {
+#    define EDVAR_CPP_CORE_DISPATCH_TARGET
+struct FloatLanes {
+    using ScalarType = float;
+    using VectorType = __m128;
+    static constexpr int32_t Width = 4;
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Load(const float* ptr) { return _mm_loadu_ps(ptr); }
+    EDVAR_CPP_CORE_FORCE_INLINE static void Store(float* ptr, const VectorType v) { _mm_storeu_ps(ptr, v); }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Splat(const float value) { return _mm_set1_ps(value); }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType MulAdd(const VectorType a, const VectorType b, const VectorType c) {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void LoadPoints(const float* in, VectorType& x, VectorType& y, VectorType& z) {
+        // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+        const __m128 a = _mm_loadu_ps(in);
+        const __m128 b = _mm_loadu_ps(in + 4);
+        const __m128 c = _mm_loadu_ps(in + 8);
+        const __m128 ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+        const __m128 bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+        x = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(ab, bc, _MM_SHUFFLE(3, 1, 2, 0));
+        z = _mm_shuffle_ps(ab, c, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void StorePoints(float* out, const VectorType x, const VectorType y,
+                                                        const VectorType z) {
+        const __m128 xyLow = _mm_unpacklo_ps(x, y);  // x0 y0 x1 y1
+        const __m128 xyHigh = _mm_unpackhi_ps(x, y); // x2 y2 x3 y3
+        _mm_storeu_ps(out, _mm_shuffle_ps(xyLow, _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+                                          _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(out + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), xyHigh,
+                                              _MM_SHUFFLE(1, 0, 2, 0)));
+        _mm_storeu_ps(out + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, xyHigh, _MM_SHUFFLE(2, 2, 2, 2)),
+                                              _mm_shuffle_ps(xyHigh, z, _MM_SHUFFLE(3, 3, 3, 3)),
+                                              _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+};
+struct DoubleLanes {
+    using ScalarType = double;
+    using VectorType = __m128d;
+    static constexpr int32_t Width = 2;
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Load(const double* ptr) { return _mm_loadu_pd(ptr); }
+    EDVAR_CPP_CORE_FORCE_INLINE static void Store(double* ptr, const VectorType v) { _mm_storeu_pd(ptr, v); }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Splat(const double value) { return _mm_set1_pd(value); }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType MulAdd(const VectorType a, const VectorType b, const VectorType c) {
+        return _mm_add_pd(_mm_mul_pd(a, b), c);
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void LoadPoints(const double* in, VectorType& x, VectorType& y,
+                                                       VectorType& z) {
+        // a = x0 y0, b = z0 x1, c = y1 z1
+        const __m128d a = _mm_loadu_pd(in);
+        const __m128d b = _mm_loadu_pd(in + 2);
+        const __m128d c = _mm_loadu_pd(in + 4);
+        x = _mm_shuffle_pd(a, b, 0b10);
+        y = _mm_shuffle_pd(a, c, 0b01);
+        z = _mm_shuffle_pd(b, c, 0b10);
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void StorePoints(double* out, const VectorType x, const VectorType y,
+                                                        const VectorType z) {
+        _mm_storeu_pd(out, _mm_unpacklo_pd(x, y));
+        _mm_storeu_pd(out + 2, _mm_shuffle_pd(z, x, 0b10));
+        _mm_storeu_pd(out + 4, _mm_unpackhi_pd(y, z));
+    }
+};
+#    include "BatchTransformKernels.inl"
+#    undef EDVAR_CPP_CORE_DISPATCH_TARGET
+} // namespace SSE2
+#elif EDVAR_CPP_CORE_DISPATCH_ARM64
+namespace NEON {
+#    define EDVAR_CPP_CORE_DISPATCH_TARGET
+struct FloatLanes {
+    using ScalarType = float;
+    using VectorType = float32x4_t;
+    static constexpr int32_t Width = 4;
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Load(const float* ptr) { return vld1q_f32(ptr); }
+    EDVAR_CPP_CORE_FORCE_INLINE static void Store(float* ptr, const VectorType v) { vst1q_f32(ptr, v); }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Splat(const float value) { return vdupq_n_f32(value); }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType MulAdd(const VectorType a, const VectorType b, const VectorType c) {
+        return vfmaq_f32(c, a, b);
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void LoadPoints(const float* in, VectorType& x, VectorType& y, VectorType& z) {
+        const float32x4x3_t points = vld3q_f32(in);
+        x = points.val[0];
+        y = points.val[1];
+        z = points.val[2];
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void StorePoints(float* out, const VectorType x, const VectorType y,
+                                                        const VectorType z) {
+        vst3q_f32(out, float32x4x3_t{{x, y, z}});
+    }
+};
+struct DoubleLanes {
+    using ScalarType = double;
+    using VectorType = float64x2_t;
+    static constexpr int32_t Width = 2;
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Load(const double* ptr) { return vld1q_f64(ptr); }
+    EDVAR_CPP_CORE_FORCE_INLINE static void Store(double* ptr, const VectorType v) { vst1q_f64(ptr, v); }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Splat(const double value) { return vdupq_n_f64(value); }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType MulAdd(const VectorType a, const VectorType b, const VectorType c) {
+        return vfmaq_f64(c, a, b);
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void LoadPoints(const double* in, VectorType& x, VectorType& y,
+                                                       VectorType& z) {
+        const float64x2x3_t points = vld3q_f64(in);
+        x = points.val[0];
+        y = points.val[1];
+        z = points.val[2];
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void StorePoints(double* out, const VectorType x, const VectorType y,
+                                                        const VectorType z) {
+        vst3q_f64(out, float64x2x3_t{{x, y, z}});
+    }
+};
+#    include "BatchTransformKernels.inl"
+#    undef EDVAR_CPP_CORE_DISPATCH_TARGET
+} // namespace NEON
+#else
+namespace Scalar {
+#    define EDVAR_CPP_CORE_DISPATCH_TARGET
+template <typename T>
+struct ScalarLanes {
+    using ScalarType = T;
+    using VectorType = T;
+    static constexpr int32_t Width = 1;
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Load(const T* ptr) { return *ptr; }
+    EDVAR_CPP_CORE_FORCE_INLINE static void Store(T* ptr, const VectorType v) { *ptr = v; }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType Splat(const T value) { return value; }
+    EDVAR_CPP_CORE_FORCE_INLINE static VectorType MulAdd(const VectorType a, const VectorType b, const VectorType c) {
+        return a * b + c;
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void LoadPoints(const T* in, VectorType& x, VectorType& y, VectorType& z) {
+        x = in[0];
+        y = in[1];
+        z = in[2];
+    }
+    EDVAR_CPP_CORE_FORCE_INLINE static void StorePoints(T* out, const VectorType x, const VectorType y,
+                                                        const VectorType z) {
+        out[0] = x;
+        out[1] = y;
+        out[2] = z;
+    }
+};
+using FloatLanes = ScalarLanes<float>;
+using DoubleLanes = ScalarLanes<double>;
+#    include "BatchTransformKernels.inl"
+#    undef EDVAR_CPP_CORE_DISPATCH_TARGET
+} // namespace Scalar
+#endif
+
+template <typename T>
+using PackedKernel = void (*)(const T* matrix, const T* in, T* out, int32_t count, T w);
+template <typename T>
+using SplitKernel = void (*)(const T* matrix, const T* inX, const T* inY, const T* inZ, T* outX, T* outY, T* outZ,
+                             int32_t count, T w);
+
+struct KernelTable {
+    PackedKernel<float> PackedFloat;
+    SplitKernel<float> SplitFloat;
+    PackedKernel<double> PackedDouble;
+    SplitKernel<double> SplitDouble;
+};
+
+#define EDVAR_CPP_CORE_MATH_KERNEL_TABLE(Namespace)                                                                    \
+    KernelTable {                                                                                                      \
+        Namespace::TransformPacked<Namespace::FloatLanes>, Namespace::TransformSplit<Namespace::FloatLanes>,           \
+            Namespace::TransformPacked<Namespace::DoubleLanes>, Namespace::TransformSplit<Namespace::DoubleLanes>      \
+    }
+
+EDVAR_CPP_CORE_DEFINE_KERNEL_DISPATCH(KernelTable, EDVAR_CPP_CORE_MATH_KERNEL_TABLE)
+#undef EDVAR_CPP_CORE_MATH_KERNEL_TABLE
+
+// Vector3 is a plain union of its components, an array of them is an array of packed XYZ triples.
+static_assert(sizeof(Vector3f) == 3 * sizeof(float));
+static_assert(sizeof(Vector3d) == 3 * sizeof(double));
+} // namespace
+
+void TransformPoints(const Matrix4x4f& matrix, const Vector3f* in, Vector3f* out, const int32_t count) {
+    GetKernels().PackedFloat(matrix.Elements, reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count,
+                             1.0f);
+}
+void TransformPoints(const Matrix4x4d& matrix, const Vector3d* in, Vector3d* out, const int32_t count) {
+    GetKernels().PackedDouble(matrix.Elements, reinterpret_cast<const double*>(in), reinterpret_cast<double*>(out),
+                              count, 1.0);
+}
+void TransformDirections(const Matrix4x4f& matrix, const Vector3f* in, Vector3f* out, const int32_t count) {
+    GetKernels().PackedFloat(matrix.Elements, reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count,
+                             0.0f);
+}
+void TransformDirections(const Matrix4x4d& matrix, const Vector3d* in, Vector3d* out, const int32_t count) {
+    GetKernels().PackedDouble(matrix.Elements, reinterpret_cast<const double*>(in), reinterpret_cast<double*>(out),
+                              count, 0.0);
+}
+
+void TransformPoints(const Matrix4x4f& matrix, const float* inX, const float* inY, const float* inZ, float* outX,
+                     float* outY, float* outZ, const int32_t count) {
+    GetKernels().SplitFloat(matrix.Elements, inX, inY, inZ, outX, outY, outZ, count, 1.0f);
+}
+void TransformPoints(const Matrix4x4d& matrix, const double* inX, const double* inY, const double* inZ,
+                     double* outX, double* outY, double* outZ, const int32_t count) {
+    GetKernels().SplitDouble(matrix.Elements, inX, inY, inZ, outX, outY, outZ, count, 1.0);
+}
+void TransformDirections(const Matrix4x4f& matrix, const float* inX, const float* inY, const float* inZ, float* outX,
+                         float* outY, float* outZ, const int32_t count) {
+    GetKernels().SplitFloat(matrix.Elements, inX, inY, inZ, outX, outY, outZ, count, 0.0f);
+}
+void TransformDirections(const Matrix4x4d& matrix, const double* inX, const double* inY, const double* inZ,
+                         double* outX, double* outY, double* outZ, const int32_t count) {
+    GetKernels().SplitDouble(matrix.Elements, inX, inY, inZ, outX, outY, outZ, count, 0.0);
+}
+} // namespace Edvar::Math
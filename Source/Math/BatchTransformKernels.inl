@@ -0,0 +1,75 @@
+// Kernels behind the batch transforms, included by BatchTransform.cpp once per instruction set. The including namespace
+// provides FloatLanes and DoubleLanes, EDVAR_CPP_CORE_DISPATCH_TARGET holds the function attributes needed to emit
+// that instruction set. Each lanes type has ScalarType, VectorType, Width, unaligned Load and Store, Splat,
+// MulAdd(a, b, c) = a * b + c, and LoadPoints/StorePoints which convert Width packed XYZ triples to and from one vector
+// per component.
+
+// Matrix points at the 16 row-major elements, w is 1 for points and 0 for directions. Every vector is loaded before its
+// result is stored, so in and out may be the same array.
+template <typename LanesT>
+EDVAR_CPP_CORE_DISPATCH_TARGET void TransformPacked(const typename LanesT::ScalarType* matrix,
+                                                    const typename LanesT::ScalarType* in,
+                                                    typename LanesT::ScalarType* out, const int32_t count,
+                                                    const typename LanesT::ScalarType w) {
+    using ScalarType = typename LanesT::ScalarType;
+    using VectorType = typename LanesT::VectorType;
+    const VectorType m00 = LanesT::Splat(matrix[0]), m01 = LanesT::Splat(matrix[1]), m02 = LanesT::Splat(matrix[2]);
+    const VectorType m10 = LanesT::Splat(matrix[4]), m11 = LanesT::Splat(matrix[5]), m12 = LanesT::Splat(matrix[6]);
+    const VectorType m20 = LanesT::Splat(matrix[8]), m21 = LanesT::Splat(matrix[9]), m22 = LanesT::Splat(matrix[10]);
+    const ScalarType t0 = matrix[3] * w, t1 = matrix[7] * w, t2 = matrix[11] * w;
+    const VectorType translation0 = LanesT::Splat(t0), translation1 = LanesT::Splat(t1),
+                     translation2 = LanesT::Splat(t2);
+
+    int32_t i = 0;
+    for (; i + LanesT::Width <= count; i += LanesT::Width) {
+        VectorType x, y, z;
+        LanesT::LoadPoints(in + 3 * i, x, y, z);
+        const VectorType outX = LanesT::MulAdd(m00, x, LanesT::MulAdd(m01, y, LanesT::MulAdd(m02, z, translation0)));
+        const VectorType outY = LanesT::MulAdd(m10, x, LanesT::MulAdd(m11, y, LanesT::MulAdd(m12, z, translation1)));
+        const VectorType outZ = LanesT::MulAdd(m20, x, LanesT::MulAdd(m21, y, LanesT::MulAdd(m22, z, translation2)));
+        LanesT::StorePoints(out + 3 * i, outX, outY, outZ);
+    }
+    for (; i < count; ++i) {
+        const ScalarType x = in[3 * i], y = in[3 * i + 1], z = in[3 * i + 2];
+        out[3 * i] = matrix[0] * x + matrix[1] * y + matrix[2] * z + t0;
+        out[3 * i + 1] = matrix[4] * x + matrix[5] * y + matrix[6] * z + t1;
+        out[3 * i + 2] = matrix[8] * x + matrix[9] * y + matrix[10] * z + t2;
+    }
+}
+
+template <typename LanesT>
+EDVAR_CPP_CORE_DISPATCH_TARGET void TransformSplit(const typename LanesT::ScalarType* matrix,
+                                                   const typename LanesT::ScalarType* inX,
+                                                   const typename LanesT::ScalarType* inY,
+                                                   const typename LanesT::ScalarType* inZ,
+                                                   typename LanesT::ScalarType* outX, typename LanesT::ScalarType* outY,
+                                                   typename LanesT::ScalarType* outZ, const int32_t count,
+                                                   const typename LanesT::ScalarType w) {
+    using ScalarType = typename LanesT::ScalarType;
+    using VectorType = typename LanesT::VectorType;
+    const VectorType m00 = LanesT::Splat(matrix[0]), m01 = LanesT::Splat(matrix[1]), m02 = LanesT::Splat(matrix[2]);
+    const VectorType m10 = LanesT::Splat(matrix[4]), m11 = LanesT::Splat(matrix[5]), m12 = LanesT::Splat(matrix[6]);
+    const VectorType m20 = LanesT::Splat(matrix[8]), m21 = LanesT::Splat(matrix[9]), m22 = LanesT::Splat(matrix[10]);
+    const ScalarType t0 = matrix[3] * w, t1 = matrix[7] * w, t2 = matrix[11] * w;
+    const VectorType translation0 = LanesT::Splat(t0), translation1 = LanesT::Splat(t1),
+                     translation2 = LanesT::Splat(t2);
+
+    int32_t i = 0;
+    for (; i + LanesT::Width <= count; i += LanesT::Width) {
+        const VectorType x = LanesT::Load(inX + i);
+        const VectorType y = LanesT::Load(inY + i);
+        const VectorType z = LanesT::Load(inZ + i);
+        LanesT::Store(outX + i,
+                      LanesT::MulAdd(m00, x, LanesT::MulAdd(m01, y, LanesT::MulAdd(m02, z, translation0))));
+        LanesT::Store(outY + i,
+                      LanesT::MulAdd(m10, x, LanesT::MulAdd(m11, y, LanesT::MulAdd(m12, z, translation1))));
+        LanesT::Store(outZ + i,
+                      LanesT::MulAdd(m20, x, LanesT::MulAdd(m21, y, LanesT::MulAdd(m22, z, translation2))));
+    }
+    for (; i < count; ++i) {
+        const ScalarType x = inX[i], y = inY[i], z = inZ[i];
+        outX[i] = matrix[0] * x + matrix[1] * y + matrix[2] * z + t0;
+        outY[i] = matrix[4] * x + matrix[5] * y + matrix[6] * z + t1;
+        outZ[i] = matrix[8] * x + matrix[9] * y + matrix[10] * z + t2;
+    }
+}
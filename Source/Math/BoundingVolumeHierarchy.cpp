@@ -0,0 +1,818 @@
+#include "Math/BoundingVolumeHierarchy.hpp"
+#include "Threading/ParallelFor.hpp"
+#include <bit>
+
+namespace Edvar::Math {
+namespace {
+using Node = BoundingVolumeHierarchy::Node;
+using Lanes = SIMD::Float_4;
+constexpr int32_t BinCount = BoundingVolumeHierarchy::BinCount;
+constexpr int32_t MaxLeafSize = BoundingVolumeHierarchy::MaxLeafSize;
+constexpr int32_t ParallelBuildThreshold = BoundingVolumeHierarchy::ParallelBuildThreshold;
+// Primitives per job when a pass over a large node is split across the pool
+constexpr int32_t ReduceChunkSize = 16384;
+// Cost of visiting a node relative to testing one primitive
+constexpr float TraversalCost = 1.0f;
+constexpr int32_t QuadWidth = Vector3fx4::Width;
+
+static_assert(sizeof(Node) == 32);
+
+// ============================================================================
+// Build
+// ============================================================================
+
+// Primitives are partitioned by value rather than through an index array, so every pass over a range reads memory in
+// order however far the build has shuffled it. The W lanes are unused.
+struct BuildPrimitive {
+    Lanes Min;
+    Lanes Max;
+    int32_t Index;
+
+    Lanes GetCenter() const { return (Min + Max) * Lanes(0.5f, 0.5f, 0.5f, 0.5f); }
+};
+
+// The build accumulates boxes in SIMD registers, one lane per axis
+struct LaneBox {
+    Lanes Min = Lanes(Infinity, Infinity, Infinity, Infinity);
+    Lanes Max = Lanes(-Infinity, -Infinity, -Infinity, -Infinity);
+
+    void Expand(const Lanes& point) {
+        Min = Min.Min(point);
+        Max = Max.Max(point);
+    }
+    void Expand(const Lanes& min, const Lanes& max) {
+        Min = Min.Min(min);
+        Max = Max.Max(max);
+    }
+    void Expand(const LaneBox& other) { Expand(other.Min, other.Max); }
+
+    float GetSurfaceArea() const {
+        const Lanes size = Max - Min;
+        return 2.0f * (size.X * size.Y + size.Y * size.Z + size.Z * size.X);
+    }
+    Vector3f GetMin() const { return Vector3f(Min.X, Min.Y, Min.Z); }
+    Vector3f GetMax() const { return Vector3f(Max.X, Max.Y, Max.Z); }
+
+private:
+    static constexpr float Infinity = std::numeric_limits<float>::infinity();
+};
+
+struct RangeBounds {
+    LaneBox Bounds;
+    LaneBox CenterBounds;
+
+    void Merge(const RangeBounds& other) {
+        Bounds.Expand(other.Bounds);
+        CenterBounds.Expand(other.CenterBounds);
+    }
+};
+
+struct BinSet {
+    LaneBox Bounds[3][BinCount];
+    int32_t Counts[3][BinCount] = {};
+
+    void Merge(const BinSet& other) {
+        for (int32_t axis = 0; axis < 3; ++axis) {
+            for (int32_t bin = 0; bin < BinCount; ++bin) {
+                Bounds[axis][bin].Expand(other.Bounds[axis][bin]);
+                Counts[axis][bin] += other.Counts[axis][bin];
+            }
+        }
+    }
+};
+
+// Maps centers to the bins of one node, every axis split evenly over the extent of the centers
+struct BinMapping {
+    Lanes Origin;
+    // Zero on axes where all centers are equal
+    Lanes Scale;
+
+    explicit BinMapping(const LaneBox& centerBounds) : Origin(centerBounds.Min) {
+        const Lanes extents = centerBounds.Max - centerBounds.Min;
+        for (int32_t axis = 0; axis < 3; ++axis) {
+            Scale.XYZW[axis] = extents.XYZW[axis] > 0.0f ? static_cast<float>(BinCount) / extents.XYZW[axis] : 0.0f;
+        }
+    }
+
+    // The bin of center along each axis, in lanes X to Z
+    Lanes GetBins(const Lanes& center) const {
+        const float last = static_cast<float>(BinCount - 1);
+        return ((center - Origin) * Scale).Min(Lanes(last, last, last, last));
+    }
+};
+
+// Primitives whose center falls in a bin below Bin along Axis go to the left child
+struct Split {
+    int32_t Axis = -1;
+    int32_t Bin = 0;
+    // Sum over both sides of surface area times primitive count
+    float Cost = std::numeric_limits<float>::infinity();
+};
+
+struct BuildRange {
+    int32_t NodeIndex;
+    int32_t Begin;
+    int32_t End;
+    // Of the node itself, the root has depth 1
+    int32_t Depth;
+};
+
+/**
+ * Calls accumulate(partial, begin, end) for chunks of [begin, end) and merges the partials. Large ranges are split
+ * across pool when there is one.
+ */
+template <typename PartialT, typename AccumulateT>
+PartialT ReduceRange(Threading::ThreadPool* pool, const int32_t begin, const int32_t end,
+                     const AccumulateT& accumulate) {
+    PartialT result;
+    const int32_t count = end - begin;
+    if (pool == nullptr || count <= 2 * ReduceChunkSize) {
+        accumulate(result, begin, end);
+        return result;
+    }
+    const int32_t chunkCount = (count - 1) / ReduceChunkSize + 1;
+    Containers::List<PartialT> partials;
+    partials.EnsureCapacity(chunkCount);
+    partials.AddDefaulted(chunkCount);
+    Threading::ParallelFor(*pool, count, ReduceChunkSize, [&](const int32_t Begin, const int32_t End) {
+        accumulate(partials[Begin / ReduceChunkSize], begin + Begin, begin + End);
+    });
+    for (int32_t i = 0; i < chunkCount; ++i) {
+        result.Merge(partials[i]);
+    }
+    return result;
+}
+
+Split FindBestSplit(const BinSet& bins) {
+    Split best;
+    for (int32_t axis = 0; axis < 3; ++axis) {
+        // Cost of everything right of each boundary, swept from the right
+        float rightCosts[BinCount];
+        LaneBox right;
+        int32_t rightCount = 0;
+        for (int32_t bin = BinCount - 1; bin > 0; --bin) {
+            right.Expand(bins.Bounds[axis][bin]);
+            rightCount += bins.Counts[axis][bin];
+            rightCosts[bin] = rightCount > 0 ? right.GetSurfaceArea() * static_cast<float>(rightCount) : -1.0f;
+        }
+        LaneBox left;
+        int32_t leftCount = 0;
+        for (int32_t bin = 1; bin < BinCount; ++bin) {
+            left.Expand(bins.Bounds[axis][bin - 1]);
+            leftCount += bins.Counts[axis][bin - 1];
+            // Boundaries with an empty side do not split anything
+            if (leftCount == 0 || rightCosts[bin] < 0.0f) {
+                continue;
+            }
+            const float cost = left.GetSurfaceArea() * static_cast<float>(leftCount) + rightCosts[bin];
+            if (cost < best.Cost) {
+                best.Axis = axis;
+                best.Bin = bin;
+                best.Cost = cost;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * Builds subtrees depth first into nodes. Ranges other than the first with at most deferSize primitives are appended
+ * to deferred instead of being built, their node is left for the caller to fill.
+ */
+class SubtreeBuilder {
+public:
+    SubtreeBuilder(BuildPrimitive* primitives, Containers::List<Node>& nodes, Threading::ThreadPool* pool,
+                   const int32_t deferSize, Containers::List<BuildRange>* deferred)
+        : primitives(primitives), nodes(nodes), pool(pool), deferSize(deferSize), deferred(deferred) {}
+
+    /** Builds range, whose node has already been allocated. Returns the depth of its deepest leaf. */
+    int32_t Build(const BuildRange& range) {
+        int32_t maxDepth = 0;
+        pending.Add(range);
+        while (pending.Length() > 0) {
+            const BuildRange current = pending.Pop();
+            const int32_t leafDepth = BuildNode(current);
+            maxDepth = leafDepth > maxDepth ? leafDepth : maxDepth;
+        }
+        return maxDepth;
+    }
+
+private:
+    BuildPrimitive* primitives;
+    Containers::List<Node>& nodes;
+    Threading::ThreadPool* pool;
+    int32_t deferSize;
+    Containers::List<BuildRange>* deferred;
+    Containers::List<BuildRange> pending;
+
+    // Fills the node of range and queues its children. Returns its depth if it became a leaf, 0 otherwise.
+    int32_t BuildNode(const BuildRange& range) {
+        const int32_t count = range.End - range.Begin;
+
+        const RangeBounds rangeBounds = ReduceRange<RangeBounds>(
+            pool, range.Begin, range.End, [&](RangeBounds& partial, const int32_t begin, const int32_t end) {
+                for (int32_t i = begin; i < end; ++i) {
+                    partial.Bounds.Expand(primitives[i].Min, primitives[i].Max);
+                    partial.CenterBounds.Expand(primitives[i].GetCenter());
+                }
+            });
+        Node& node = nodes[range.NodeIndex];
+        node.Min = rangeBounds.Bounds.GetMin();
+        node.Max = rangeBounds.Bounds.GetMax();
+
+        int32_t middle = range.Begin + count / 2;
+        if (count > 1) {
+            const BinMapping mapping(rangeBounds.CenterBounds);
+            const BinSet bins = ReduceRange<BinSet>(
+                pool, range.Begin, range.End, [&](BinSet& partial, const int32_t begin, const int32_t end) {
+                    for (int32_t i = begin; i < end; ++i) {
+                        const BuildPrimitive& primitive = primitives[i];
+                        const Lanes bins = mapping.GetBins(primitive.GetCenter());
+                        for (int32_t axis = 0; axis < 3; ++axis) {
+                            const int32_t bin = static_cast<int32_t>(bins.XYZW[axis]);
+                            partial.Bounds[axis][bin].Expand(primitive.Min, primitive.Max);
+                            ++partial.Counts[axis][bin];
+                        }
+                    }
+                });
+            const Split split = FindBestSplit(bins);
+
+            // Splitting pays off when TraversalCost + split.Cost / area < count
+            const float area = rangeBounds.Bounds.GetSurfaceArea();
+            const bool shouldSplit =
+                count > MaxLeafSize || split.Cost < (static_cast<float>(count) - TraversalCost) * area;
+            if (!shouldSplit) {
+                return MakeLeaf(range);
+            }
+            if (split.Axis >= 0) {
+                middle = Partition(range, mapping, split);
+            }
+            // Otherwise every center is the same and the primitives are split in halves
+        } else {
+            return MakeLeaf(range);
+        }
+
+        const int32_t left = nodes.AddDefaulted(2);
+        nodes[range.NodeIndex].Index = left;
+        nodes[range.NodeIndex].Count = 0;
+        // Right first so the left subtree is built next and stored right after its parent
+        Queue(BuildRange{left + 1, middle, range.End, range.Depth + 1});
+        Queue(BuildRange{left, range.Begin, middle, range.Depth + 1});
+        return 0;
+    }
+
+    int32_t MakeLeaf(const BuildRange& range) {
+        Node& node = nodes[range.NodeIndex];
+        node.Index = range.Begin;
+        node.Count = range.End - range.Begin;
+        return range.Depth;
+    }
+
+    int32_t Partition(const BuildRange& range, const BinMapping& mapping, const Split& split) {
+        int32_t first = range.Begin;
+        int32_t last = range.End - 1;
+        while (first <= last) {
+            const Lanes bins = mapping.GetBins(primitives[first].GetCenter());
+            if (static_cast<int32_t>(bins.XYZW[split.Axis]) < split.Bin) {
+                ++first;
+            } else {
+                const BuildPrimitive swapped = primitives[first];
+                primitives[first] = primitives[last];
+                primitives[last] = swapped;
+                --last;
+            }
+        }
+        return first;
+    }
+
+    void Queue(const BuildRange& range) {
+        if (deferred != nullptr && range.End - range.Begin <= deferSize) {
+            deferred->Add(range);
+        } else {
+            pending.Add(range);
+        }
+    }
+};
+
+// ============================================================================
+// Traversal
+// ============================================================================
+
+struct StackEntry {
+    int32_t Node;
+    // Lower bound of the query distance to anything below the node, entries past the best result are skipped
+    float Distance;
+};
+
+// Nodes still to visit. Trees of typical depth fit in the inline entries.
+class TraversalStack {
+public:
+    explicit TraversalStack(const int32_t treeDepth) {
+        // Each visited node pushes at most four entries and is itself at least one level below the previous one
+        const int32_t capacity = 3 * treeDepth + QuadWidth;
+        if (capacity > InlineCapacity) {
+            overflow.Resize(capacity);
+            entries = overflow.Data();
+        }
+    }
+
+    void Push(const int32_t node, const float distance) { entries[size++] = StackEntry{node, distance}; }
+    StackEntry Pop() { return entries[--size]; }
+    bool IsEmpty() const { return size == 0; }
+
+private:
+    static constexpr int32_t InlineCapacity = 128;
+    StackEntry inlineEntries[InlineCapacity];
+    Containers::List<StackEntry> overflow;
+    StackEntry* entries = inlineEntries;
+    int32_t size = 0;
+};
+
+/**
+ * The up to four nodes tested together below an internal node: the children of each internal child, or the child
+ * itself when it is a leaf. Unused lanes are zero and excluded from ValidBits.
+ */
+struct NodeQuad {
+    int32_t Nodes[QuadWidth];
+    int32_t ValidBits;
+    Vector3fx4 Min;
+    Vector3fx4 Max;
+
+    NodeQuad(const Node* nodes, const Node& parent) {
+        int32_t count = 0;
+        for (int32_t child = parent.Index; child <= parent.Index + 1; ++child) {
+            if (nodes[child].IsLeaf()) {
+                Nodes[count++] = child;
+            } else {
+                Nodes[count++] = nodes[child].Index;
+                Nodes[count++] = nodes[child].Index + 1;
+            }
+        }
+        ValidBits = (1 << count) - 1;
+        const Node empty{};
+        const Node& n0 = nodes[Nodes[0]];
+        const Node& n1 = nodes[Nodes[1]];
+        const Node& n2 = count > 2 ? nodes[Nodes[2]] : empty;
+        const Node& n3 = count > 3 ? nodes[Nodes[3]] : empty;
+        Min = Vector3fx4(Lanes(n0.Min.X, n1.Min.X, n2.Min.X, n3.Min.X), Lanes(n0.Min.Y, n1.Min.Y, n2.Min.Y, n3.Min.Y),
+                         Lanes(n0.Min.Z, n1.Min.Z, n2.Min.Z, n3.Min.Z));
+        Max = Vector3fx4(Lanes(n0.Max.X, n1.Max.X, n2.Max.X, n3.Max.X), Lanes(n0.Max.Y, n1.Max.Y, n2.Max.Y, n3.Max.Y),
+                         Lanes(n0.Max.Z, n1.Max.Z, n2.Max.Z, n3.Max.Z));
+    }
+};
+
+// Pushes the nodes of quad selected by bits, the closest last so it is visited first
+void PushClosestLast(TraversalStack& stack, const NodeQuad& quad, int32_t bits, const Lanes& distances) {
+    alignas(16) float laneDistances[QuadWidth];
+    distances.StoreAligned(laneDistances);
+    StackEntry hits[QuadWidth];
+    int32_t hitCount = 0;
+    for (; bits != 0; bits &= bits - 1) {
+        const int32_t lane = std::countr_zero(static_cast<uint32_t>(bits));
+        // Insertion sort, farthest first
+        int32_t position = hitCount++;
+        for (; position > 0 && hits[position - 1].Distance < laneDistances[lane]; --position) {
+            hits[position] = hits[position - 1];
+        }
+        hits[position] = StackEntry{quad.Nodes[lane], laneDistances[lane]};
+    }
+    for (int32_t i = 0; i < hitCount; ++i) {
+        stack.Push(hits[i].Node, hits[i].Distance);
+    }
+}
+
+// The index range of the primitives below node, subtrees always cover a contiguous range
+void GetPrimitiveRange(const Node* nodes, const int32_t node, int32_t& outBegin, int32_t& outEnd) {
+    int32_t first = node;
+    while (!nodes[first].IsLeaf()) {
+        first = nodes[first].Index;
+    }
+    int32_t last = node;
+    while (!nodes[last].IsLeaf()) {
+        last = nodes[last].Index + 1;
+    }
+    outBegin = nodes[first].Index;
+    outEnd = nodes[last].Index + nodes[last].Count;
+}
+
+struct RayLanes {
+    Vector3fx4 Origin;
+    Vector3fx4 InverseDirection;
+    Vector3f ScalarOrigin;
+    Vector3f ScalarInverseDirection;
+
+    RayLanes(const Vector3f& origin, const Vector3f& direction) : Origin(origin), ScalarOrigin(origin) {
+        // Huge instead of infinite for axis parallel rays, so origins on a slab plane give 0 instead of NaN
+        for (int32_t axis = 0; axis < 3; ++axis) {
+            const float component = Abs(direction[axis]) > 1e-30f ? direction[axis] : 1e-30f;
+            ScalarInverseDirection[axis] = 1.0f / component;
+        }
+        InverseDirection = Vector3fx4(ScalarInverseDirection);
+    }
+
+    /** Entry distances into the boxes of quad, with the bits of the lanes entered within [0, closest]. */
+    int32_t Intersect(const NodeQuad& quad, const Lanes& closest, Lanes& outEntry) const {
+        const Vector3fx4 t0 = (quad.Min - Origin) * InverseDirection;
+        const Vector3fx4 t1 = (quad.Max - Origin) * InverseDirection;
+        const Vector3fx4 near = t0.Min(t1);
+        const Vector3fx4 far = t0.Max(t1);
+        outEntry = near.X.Max(near.Y).Max(near.Z).Max(Lanes(0.0f, 0.0f, 0.0f, 0.0f));
+        const Lanes exit = far.X.Min(far.Y).Min(far.Z).Min(closest);
+        return ~exit.LessThan(outEntry).GetMaskBits() & quad.ValidBits;
+    }
+
+    /** Entry distance into box, or a negative value when the ray misses it within [0, closest]. */
+    float Intersect(const AABB& box, const float closest) const {
+        float entry = 0.0f;
+        float exit = closest;
+        for (int32_t axis = 0; axis < 3; ++axis) {
+            const float t0 = (box.Min[axis] - ScalarOrigin[axis]) * ScalarInverseDirection[axis];
+            const float t1 = (box.Max[axis] - ScalarOrigin[axis]) * ScalarInverseDirection[axis];
+            entry = Max(entry, Min(t0, t1));
+            exit = Min(exit, Max(t0, t1));
+        }
+        return entry <= exit ? entry : -1.0f;
+    }
+};
+
+// The frustum planes splatted across the lanes once per query
+struct FrustumLanes {
+    Vector3fx4 Normals[Frustum::PlaneCount];
+    Vector3fx4 AbsNormals[Frustum::PlaneCount];
+    Lanes Distances[Frustum::PlaneCount];
+
+    explicit FrustumLanes(const Frustum& frustum) {
+        for (int32_t i = 0; i < Frustum::PlaneCount; ++i) {
+            const Plane& plane = frustum.Planes[i];
+            Normals[i] = Vector3fx4(plane.Normal);
+            AbsNormals[i] = Vector3fx4(plane.Normal.Abs());
+            Distances[i] = Lanes(plane.Distance, plane.Distance, plane.Distance, plane.Distance);
+        }
+    }
+
+    /** Bits of the boxes of quad that intersect the frustum, and of those completely inside it. */
+    int32_t Intersect(const NodeQuad& quad, int32_t& outInsideBits) const {
+        const Lanes half(0.5f, 0.5f, 0.5f, 0.5f);
+        const Lanes zero(0.0f, 0.0f, 0.0f, 0.0f);
+        const Vector3fx4 center = (quad.Min + quad.Max) * half;
+        const Vector3fx4 extents = (quad.Max - quad.Min) * half;
+        Lanes outside = zero;
+        Lanes crossing = zero;
+        for (int32_t i = 0; i < Frustum::PlaneCount; ++i) {
+            const Lanes distance = center.Dot(Normals[i]) + Distances[i];
+            const Lanes radius = extents.Dot(AbsNormals[i]);
+            outside = outside | (distance + radius).LessThan(zero);
+            crossing = crossing | (distance - radius).LessThan(zero);
+        }
+        const int32_t visibleBits = ~outside.GetMaskBits() & quad.ValidBits;
+        outInsideBits = ~crossing.GetMaskBits() & visibleBits;
+        return visibleBits;
+    }
+};
+
+struct TreeView {
+    const Node* Nodes;
+    const int32_t* PrimitiveIndices;
+    const AABB* PrimitiveBounds;
+    int32_t Depth;
+};
+
+/** intersect(slot, boxEntry, closest) returns the hit distance of the primitive in leaf slot slot. */
+template <typename IntersectT>
+int32_t RaycastTree(const TreeView& tree, const Vector3f& origin, const Vector3f& direction, const float maxDistance,
+                    const IntersectT& intersect, float* outDistance) {
+    const RayLanes ray(origin, direction);
+    float closest = maxDistance;
+    int32_t closestSlot = BoundingVolumeHierarchy::InvalidIndex;
+    TraversalStack stack(tree.Depth);
+    stack.Push(0, 0.0f);
+    while (!stack.IsEmpty()) {
+        const StackEntry entry = stack.Pop();
+        if (entry.Distance > closest) {
+            continue;
+        }
+        const Node& node = tree.Nodes[entry.Node];
+        if (node.IsLeaf()) {
+            for (int32_t slot = node.Index; slot < node.Index + node.Count; ++slot) {
+                const float boxEntry = ray.Intersect(tree.PrimitiveBounds[slot], closest);
+                if (boxEntry < 0.0f) {
+                    continue;
+                }
+                const float distance = intersect(slot, boxEntry, closest);
+                if (distance >= 0.0f && distance < closest) {
+                    closest = distance;
+                    closestSlot = slot;
+                }
+            }
+            continue;
+        }
+        const NodeQuad quad(tree.Nodes, node);
+        Lanes entries;
+        const int32_t hits = ray.Intersect(quad, Lanes(closest, closest, closest, closest), entries);
+        PushClosestLast(stack, quad, hits, entries);
+    }
+    if (closestSlot == BoundingVolumeHierarchy::InvalidIndex) {
+        return BoundingVolumeHierarchy::InvalidIndex;
+    }
+    if (outDistance != nullptr) {
+        *outDistance = closest;
+    }
+    return tree.PrimitiveIndices[closestSlot];
+}
+
+/** distanceSquared(slot, boxDistanceSquared) returns the squared distance to the primitive in leaf slot slot. */
+template <typename DistanceT>
+int32_t FindNearestInTree(const TreeView& tree, const Vector3f& point, const float maxDistance,
+                          const DistanceT& distanceSquared, float* outDistanceSquared) {
+    const Vector3fx4 pointLanes(point);
+    const Lanes zero(0.0f, 0.0f, 0.0f, 0.0f);
+    float best = maxDistance * maxDistance;
+    int32_t bestSlot = BoundingVolumeHierarchy::InvalidIndex;
+    TraversalStack stack(tree.Depth);
+    stack.Push(0, 0.0f);
+    while (!stack.IsEmpty()) {
+        const StackEntry entry = stack.Pop();
+        if (entry.Distance > best) {
+            continue;
+        }
+        const Node& node = tree.Nodes[entry.Node];
+        if (node.IsLeaf()) {
+            for (int32_t slot = node.Index; slot < node.Index + node.Count; ++slot) {
+                const float boxDistance = tree.PrimitiveBounds[slot].DistanceSquared(point);
+                if (boxDistance > best) {
+                    continue;
+                }
+                const float distance = distanceSquared(slot, boxDistance);
+                if (distance <= best) {
+                    best = distance;
+                    bestSlot = slot;
+                }
+            }
+            continue;
+        }
+        const NodeQuad quad(tree.Nodes, node);
+        const Vector3fx4 outside = (quad.Min - pointLanes).Max(pointLanes - quad.Max).Max(Vector3fx4(Vector3f::Zero));
+        const Lanes distances = outside.LengthSquared();
+        const int32_t hits = ~Lanes(best, best, best, best).LessThan(distances).GetMaskBits() & quad.ValidBits;
+        PushClosestLast(stack, quad, hits, distances);
+    }
+    if (bestSlot == BoundingVolumeHierarchy::InvalidIndex) {
+        return BoundingVolumeHierarchy::InvalidIndex;
+    }
+    if (outDistanceSquared != nullptr) {
+        *outDistanceSquared = best;
+    }
+    return tree.PrimitiveIndices[bestSlot];
+}
+} // namespace
+
+void BoundingVolumeHierarchy::Build(const AABB* bounds, const int32_t count) { BuildInternal(bounds, count, nullptr); }
+
+void BoundingVolumeHierarchy::Build(const AABB* bounds, const int32_t count, Threading::ThreadPool& pool) {
+    BuildInternal(bounds, count, &pool);
+}
+
+void BoundingVolumeHierarchy::BuildInternal(const AABB* bounds, const int32_t count, Threading::ThreadPool* pool) {
+    if (count < 0) [[unlikely]] {
+        Platform::GetPlatform().OnFatalError(
+            *String::Format(u"BoundingVolumeHierarchy: Invalid primitive count {}.", count));
+    }
+    Clear();
+    if (count == 0) {
+        return;
+    }
+
+    Containers::List<BuildPrimitive> primitives;
+    primitives.Resize(count);
+    const auto prepare = [&](const int32_t begin, const int32_t end) {
+        for (int32_t i = begin; i < end; ++i) {
+            const AABB& box = bounds[i];
+            primitives[i] = BuildPrimitive{Lanes(box.Min.X, box.Min.Y, box.Min.Z, 0.0f),
+                                           Lanes(box.Max.X, box.Max.Y, box.Max.Z, 0.0f), i};
+        }
+    };
+    if (pool != nullptr) {
+        Threading::ParallelFor(*pool, count, ReduceChunkSize, prepare);
+    } else {
+        prepare(0, count);
+    }
+
+    // A binary tree over count leaves of at least one primitive has at most 2 * count - 1 nodes
+    nodes.EnsureCapacity(2 * count - 1);
+    nodes.AddDefaulted(1);
+    const BuildRange root{0, 0, count, 1};
+
+    // Subtrees small enough for one job are set aside while the top of the tree is built, a few per worker so they
+    // even out. The top passes over large nodes are split across the pool themselves.
+    const int32_t workerCount = pool != nullptr ? pool->GetWorkerCount() : 0;
+    const int32_t taskSize = Max(ParallelBuildThreshold, count / (4 * (workerCount + 1)));
+    if (workerCount == 0 || count <= taskSize) {
+        depth = SubtreeBuilder(primitives.Data(), nodes, nullptr, 0, nullptr).Build(root);
+    } else {
+        Containers::List<BuildRange> tasks;
+        depth = SubtreeBuilder(primitives.Data(), nodes, pool, taskSize, &tasks).Build(root);
+
+        // Every task builds into its own list with its root at 0, these are appended after the top nodes
+        const int32_t taskCount = tasks.Length();
+        Containers::List<Containers::List<Node>> taskNodes;
+        taskNodes.EnsureCapacity(taskCount);
+        taskNodes.AddDefaulted(taskCount);
+        Containers::List<int32_t> taskDepths;
+        taskDepths.Resize(taskCount);
+        Threading::ParallelFor(*pool, taskCount, 1, [&](const int32_t Begin, const int32_t End) {
+            for (int32_t task = Begin; task < End; ++task) {
+                const BuildRange& range = tasks[task];
+                Containers::List<Node>& localNodes = taskNodes[task];
+                localNodes.EnsureCapacity(2 * (range.End - range.Begin) - 1);
+                localNodes.AddDefaulted(1);
+                taskDepths[task] = SubtreeBuilder(primitives.Data(), localNodes, nullptr, 0, nullptr)
+                                       .Build(BuildRange{0, range.Begin, range.End, range.Depth});
+            }
+        });
+
+        for (int32_t task = 0; task < taskCount; ++task) {
+            const Containers::List<Node>& localNodes = taskNodes[task];
+            // Local node i > 0 lands at base + i - 1, the local root replaces the node set aside for the task
+            const int32_t base = nodes.Length();
+            const auto relocate = [base](Node node) {
+                if (!node.IsLeaf()) {
+                    node.Index += base - 1;
+                }
+                return node;
+            };
+            nodes[tasks[task].NodeIndex] = relocate(localNodes[0]);
+            for (int32_t i = 1; i < localNodes.Length(); ++i) {
+                nodes.Add(relocate(localNodes[i]));
+            }
+            depth = Max(depth, taskDepths[task]);
+        }
+    }
+
+    primitiveIndices.Resize(count);
+    primitiveBounds.Resize(count);
+    for (int32_t i = 0; i < count; ++i) {
+        primitiveIndices[i] = primitives[i].Index;
+        primitiveBounds[i] = AABB(Vector3f(primitives[i].Min.X, primitives[i].Min.Y, primitives[i].Min.Z),
+                                  Vector3f(primitives[i].Max.X, primitives[i].Max.Y, primitives[i].Max.Z));
+    }
+}
+
+void BoundingVolumeHierarchy::Refit(const AABB* bounds) {
+    const int32_t count = primitiveIndices.Length();
+    for (int32_t i = 0; i < count; ++i) {
+        primitiveBounds[i] = bounds[primitiveIndices[i]];
+    }
+    // Children are stored after their parents, so a backwards pass sees every child before its parent
+    for (int32_t i = nodes.Length() - 1; i >= 0; --i) {
+        Node& node = nodes[i];
+        AABB box;
+        if (node.IsLeaf()) {
+            for (int32_t slot = node.Index; slot < node.Index + node.Count; ++slot) {
+                box.Expand(primitiveBounds[slot]);
+            }
+        } else {
+            box = AABB::Union(nodes[node.Index].GetBounds(), nodes[node.Index + 1].GetBounds());
+        }
+        node.Min = box.Min;
+        node.Max = box.Max;
+    }
+}
+
+void BoundingVolumeHierarchy::Clear() {
+    nodes.Clear();
+    primitiveIndices.Clear();
+    primitiveBounds.Clear();
+    depth = 0;
+}
+
+int32_t BoundingVolumeHierarchy::Raycast(const Vector3f& origin, const Vector3f& direction, const float maxDistance,
+                                         const Utils::FunctionRef<float(int32_t primitive, float closest)> intersect,
+                                         float* outDistance) const {
+    if (nodes.Length() == 0) {
+        return InvalidIndex;
+    }
+    const int32_t* indices = primitiveIndices.Data();
+    return RaycastTree(
+        TreeView{nodes.Data(), indices, primitiveBounds.Data(), depth}, origin, direction, maxDistance,
+        [&](const int32_t slot, float, const float closest) { return intersect(indices[slot], closest); },
+        outDistance);
+}
+
+int32_t BoundingVolumeHierarchy::Raycast(const Vector3f& origin, const Vector3f& direction, const float maxDistance,
+                                         float* outDistance) const {
+    if (nodes.Length() == 0) {
+        return InvalidIndex;
+    }
+    return RaycastTree(
+        TreeView{nodes.Data(), primitiveIndices.Data(), primitiveBounds.Data(), depth}, origin, direction,
+        maxDistance, [](int32_t, const float boxEntry, float) { return boxEntry; }, outDistance);
+}
+
+void BoundingVolumeHierarchy::QueryOverlaps(const AABB& box,
+                                            const Utils::FunctionRef<void(int32_t primitive)> visit) const {
+    if (nodes.Length() == 0) {
+        return;
+    }
+    const Vector3fx4 queryMin(box.Min);
+    const Vector3fx4 queryMax(box.Max);
+    const auto visitRange = [&](const int32_t begin, const int32_t end) {
+        for (int32_t slot = begin; slot < end; ++slot) {
+            visit(primitiveIndices[slot]);
+        }
+    };
+    TraversalStack stack(depth);
+    stack.Push(0, 0.0f);
+    while (!stack.IsEmpty()) {
+        const Node& node = nodes[stack.Pop().Node];
+        if (node.IsLeaf()) {
+            for (int32_t slot = node.Index; slot < node.Index + node.Count; ++slot) {
+                if (primitiveBounds[slot].Intersects(box)) {
+                    visit(primitiveIndices[slot]);
+                }
+            }
+            continue;
+        }
+        const NodeQuad quad(nodes.Data(), node);
+        const Lanes separated = queryMax.X.LessThan(quad.Min.X) | queryMax.Y.LessThan(quad.Min.Y) |
+                                queryMax.Z.LessThan(quad.Min.Z) | quad.Max.X.LessThan(queryMin.X) |
+                                quad.Max.Y.LessThan(queryMin.Y) | quad.Max.Z.LessThan(queryMin.Z);
+        const Lanes sticksOut = quad.Min.X.LessThan(queryMin.X) | quad.Min.Y.LessThan(queryMin.Y) |
+                                quad.Min.Z.LessThan(queryMin.Z) | queryMax.X.LessThan(quad.Max.X) |
+                                queryMax.Y.LessThan(quad.Max.Y) | queryMax.Z.LessThan(quad.Max.Z);
+        const int32_t overlapping = ~separated.GetMaskBits() & quad.ValidBits;
+        const int32_t contained = ~sticksOut.GetMaskBits() & overlapping;
+        for (int32_t bits = overlapping; bits != 0; bits &= bits - 1) {
+            const int32_t lane = std::countr_zero(static_cast<uint32_t>(bits));
+            if ((contained & (1 << lane)) != 0) {
+                // Everything below a node inside the query overlaps it
+                int32_t begin, end;
+                GetPrimitiveRange(nodes.Data(), quad.Nodes[lane], begin, end);
+                visitRange(begin, end);
+            } else {
+                stack.Push(quad.Nodes[lane], 0.0f);
+            }
+        }
+    }
+}
+
+void BoundingVolumeHierarchy::QueryFrustum(const Frustum& frustum,
+                                           const Utils::FunctionRef<void(int32_t primitive)> visit) const {
+    if (nodes.Length() == 0) {
+        return;
+    }
+    const FrustumLanes planes(frustum);
+    TraversalStack stack(depth);
+    stack.Push(0, 0.0f);
+    while (!stack.IsEmpty()) {
+        const Node& node = nodes[stack.Pop().Node];
+        if (node.IsLeaf()) {
+            for (int32_t slot = node.Index; slot < node.Index + node.Count; ++slot) {
+                if (frustum.Intersects(primitiveBounds[slot])) {
+                    visit(primitiveIndices[slot]);
+                }
+            }
+            continue;
+        }
+        const NodeQuad quad(nodes.Data(), node);
+        int32_t inside;
+        const int32_t visible = planes.Intersect(quad, inside);
+        for (int32_t bits = visible; bits != 0; bits &= bits - 1) {
+            const int32_t lane = std::countr_zero(static_cast<uint32_t>(bits));
+            if ((inside & (1 << lane)) != 0) {
+                // Every box below a node inside all planes passes as well
+                int32_t begin, end;
+                GetPrimitiveRange(nodes.Data(), quad.Nodes[lane], begin, end);
+                for (int32_t slot = begin; slot < end; ++slot) {
+                    visit(primitiveIndices[slot]);
+                }
+            } else {
+                stack.Push(quad.Nodes[lane], 0.0f);
+            }
+        }
+    }
+}
+
+int32_t BoundingVolumeHierarchy::FindNearest(const Vector3f& point, const float maxDistance,
+                                             const Utils::FunctionRef<float(int32_t primitive)> distanceSquared,
+                                             float* outDistanceSquared) const {
+    if (nodes.Length() == 0) {
+        return InvalidIndex;
+    }
+    const int32_t* indices = primitiveIndices.Data();
+    return FindNearestInTree(
+        TreeView{nodes.Data(), indices, primitiveBounds.Data(), depth}, point, maxDistance,
+        [&](const int32_t slot, float) { return distanceSquared(indices[slot]); }, outDistanceSquared);
+}
+
+int32_t BoundingVolumeHierarchy::FindNearest(const Vector3f& point, const float maxDistance,
+                                             float* outDistanceSquared) const {
+    if (nodes.Length() == 0) {
+        return InvalidIndex;
+    }
+    return FindNearestInTree(
+        TreeView{nodes.Data(), primitiveIndices.Data(), primitiveBounds.Data(), depth}, point, maxDistance,
+        [](int32_t, const float boxDistance) { return boxDistance; }, outDistanceSquared);
+}
+
+AABB BoundingVolumeHierarchy::GetBounds() const { return nodes.Length() > 0 ? nodes[0].GetBounds() : AABB(); }
+} // namespace Edvar::Math
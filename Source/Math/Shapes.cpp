@@ -0,0 +1,317 @@
+#include "Math/Shapes.hpp"
+#include "Math/All.hpp"
+
+namespace Edvar::Math {
+namespace {
+// Index of the point farthest from origin
+int32_t FindFarthest(const Vector3f& origin, const Vector3f* points, const int32_t count) {
+    int32_t farthest = 0;
+    float farthestDistance = -1.0f;
+    for (int32_t i = 0; i < count; ++i) {
+        const float distance = origin.DistanceSquared(points[i]);
+        if (distance > farthestDistance) {
+            farthest = i;
+            farthestDistance = distance;
+        }
+    }
+    return farthest;
+}
+
+// Largest length of the three basis columns, the most a direction can be stretched by the upper 3x3 of transform
+float GetMaxAxisScale(const Matrix4x4f& transform) {
+    float maxLengthSquared = 0.0f;
+    for (int32_t column = 0; column < 3; ++column) {
+        const Vector3f axis(transform.M[0][column], transform.M[1][column], transform.M[2][column]);
+        maxLengthSquared = std::max(maxLengthSquared, axis.LengthSquared());
+    }
+    return SquareRoot(maxLengthSquared);
+}
+} // namespace
+
+// ============================================================================
+// AABB
+// ============================================================================
+
+AABB AABB::Transformed(const Matrix4x4f& transform) const {
+    // Arvo's method: the new extents along each axis are the extents weighted by the absolute matrix elements
+    const Vector3f center = transform.TransformPoint(GetCenter());
+    const Vector3f extents = GetExtents();
+    Vector3f newExtents;
+    for (int32_t row = 0; row < 3; ++row) {
+        newExtents[row] = Abs(transform.M[row][0]) * extents.X + Abs(transform.M[row][1]) * extents.Y +
+                          Abs(transform.M[row][2]) * extents.Z;
+    }
+    return FromCenterExtents(center, newExtents);
+}
+
+// ============================================================================
+// BoundingSphere
+// ============================================================================
+
+BoundingSphere BoundingSphere::FromPoints(const Vector3f* points, const int32_t count) {
+    if (count <= 0) {
+        return BoundingSphere();
+    }
+    // Ritter: start from the two points farthest apart along an approximate diameter, then grow the sphere to take in
+    // every point left outside
+    const Vector3f a = points[FindFarthest(points[0], points, count)];
+    const Vector3f b = points[FindFarthest(a, points, count)];
+    BoundingSphere result((a + b) * 0.5f, a.Distance(b) * 0.5f);
+    for (int32_t i = 0; i < count; ++i) {
+        const float distance = result.Center.Distance(points[i]);
+        if (distance > result.Radius) {
+            const float newRadius = (result.Radius + distance) * 0.5f;
+            result.Center += (points[i] - result.Center) * ((newRadius - result.Radius) / distance);
+            result.Radius = newRadius;
+        }
+    }
+    return result;
+}
+
+BoundingSphere BoundingSphere::Transformed(const Matrix4x4f& transform) const {
+    return BoundingSphere(transform.TransformPoint(Center), Radius * GetMaxAxisScale(transform));
+}
+
+// ============================================================================
+// OBB
+// ============================================================================
+
+bool OBB::Contains(const Vector3f& point) const {
+    const Vector3f local = Orientation.UnrotateVector(point - Center).Abs();
+    return local.X <= Extents.X && local.Y <= Extents.Y && local.Z <= Extents.Z;
+}
+
+Vector3f OBB::ClosestPoint(const Vector3f& point) const {
+    const Vector3f local = Orientation.UnrotateVector(point - Center).Clamp(-Extents, Extents);
+    return Center + Orientation.RotateVector(local);
+}
+
+bool OBB::Intersects(const OBB& other) const {
+    // Separating axis test from Real-Time Collision Detection 4.4.1, in the frame of this box. An epsilon on the
+    // absolute rotation keeps near parallel edges from producing zero cross product axes that falsely separate.
+    constexpr float epsilon = 1e-6f;
+    Vector3f axes[3], otherAxes[3];
+    GetAxes(axes[0], axes[1], axes[2]);
+    other.GetAxes(otherAxes[0], otherAxes[1], otherAxes[2]);
+
+    float rotation[3][3], absRotation[3][3];
+    for (int32_t i = 0; i < 3; ++i) {
+        for (int32_t j = 0; j < 3; ++j) {
+            rotation[i][j] = axes[i].Dot(otherAxes[j]);
+            absRotation[i][j] = Abs(rotation[i][j]) + epsilon;
+        }
+    }
+    const Vector3f offset = other.Center - Center;
+    const float t[3] = {offset.Dot(axes[0]), offset.Dot(axes[1]), offset.Dot(axes[2])};
+    const float* a = Extents.XYZ;
+    const float* b = other.Extents.XYZ;
+
+    // Axes of this box
+    for (int32_t i = 0; i < 3; ++i) {
+        const float radiusB = b[0] * absRotation[i][0] + b[1] * absRotation[i][1] + b[2] * absRotation[i][2];
+        if (Abs(t[i]) > a[i] + radiusB) {
+            return false;
+        }
+    }
+    // Axes of the other box
+    for (int32_t j = 0; j < 3; ++j) {
+        const float radiusA = a[0] * absRotation[0][j] + a[1] * absRotation[1][j] + a[2] * absRotation[2][j];
+        if (Abs(t[0] * rotation[0][j] + t[1] * rotation[1][j] + t[2] * rotation[2][j]) > radiusA + b[j]) {
+            return false;
+        }
+    }
+    // Cross products of one axis of each box
+    for (int32_t i = 0; i < 3; ++i) {
+        const int32_t i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+        for (int32_t j = 0; j < 3; ++j) {
+            const int32_t j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+            const float radiusA = a[i1] * absRotation[i2][j] + a[i2] * absRotation[i1][j];
+            const float radiusB = b[j1] * absRotation[i][j2] + b[j2] * absRotation[i][j1];
+            if (Abs(t[i2] * rotation[i1][j] - t[i1] * rotation[i2][j]) > radiusA + radiusB) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+AABB OBB::GetBounds() const {
+    Vector3f axes[3];
+    GetAxes(axes[0], axes[1], axes[2]);
+    const Vector3f extents = axes[0].Abs() * Extents.X + axes[1].Abs() * Extents.Y + axes[2].Abs() * Extents.Z;
+    return AABB::FromCenterExtents(Center, extents);
+}
+
+// ============================================================================
+// Frustum
+// ============================================================================
+
+Frustum::Frustum(const Matrix4x4f& viewProjection) {
+    // A point is inside when its clip coordinates satisfy -w <= x <= w, -w <= y <= w and 0 <= z <= w. Each inequality
+    // is a plane whose coefficients are a sum or difference of matrix rows.
+    const auto row = [&viewProjection](const int32_t index) {
+        return Plane(Vector3f(viewProjection.M[index][0], viewProjection.M[index][1], viewProjection.M[index][2]),
+                     viewProjection.M[index][3]);
+    };
+    const auto add = [](const Plane& a, const Plane& b) { return Plane(a.Normal + b.Normal, a.Distance + b.Distance); };
+    const auto subtract = [](const Plane& a, const Plane& b) {
+        return Plane(a.Normal - b.Normal, a.Distance - b.Distance);
+    };
+    const Plane w = row(3);
+    Planes[LeftPlane] = add(w, row(0)).Normalized();
+    Planes[RightPlane] = subtract(w, row(0)).Normalized();
+    Planes[BottomPlane] = add(w, row(1)).Normalized();
+    Planes[TopPlane] = subtract(w, row(1)).Normalized();
+    Planes[NearPlane] = row(2).Normalized();
+    Planes[FarPlane] = subtract(w, row(2)).Normalized();
+}
+
+bool Frustum::Contains(const Vector3f& point) const {
+    for (const Plane& plane : Planes) {
+        if (plane.SignedDistance(point) < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::Intersects(const AABB& box) const {
+    const Vector3f center = box.GetCenter();
+    const Vector3f extents = box.GetExtents();
+    for (const Plane& plane : Planes) {
+        if (plane.SignedDistance(center) + plane.Normal.Abs().Dot(extents) < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::Intersects(const BoundingSphere& sphere) const {
+    for (const Plane& plane : Planes) {
+        if (plane.SignedDistance(sphere.Center) + sphere.Radius < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::Intersects(const OBB& box) const {
+    Vector3f axes[3];
+    box.GetAxes(axes[0], axes[1], axes[2]);
+    for (const Plane& plane : Planes) {
+        const float radius = Abs(plane.Normal.Dot(axes[0])) * box.Extents.X +
+                             Abs(plane.Normal.Dot(axes[1])) * box.Extents.Y +
+                             Abs(plane.Normal.Dot(axes[2])) * box.Extents.Z;
+        if (plane.SignedDistance(box.Center) + radius < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Batch culling
+// ============================================================================
+
+namespace {
+using Lanes = SIMD::Float_8;
+constexpr int32_t CullWidth = Vector3fx8::Width;
+constexpr int32_t BitsPerWord = 64;
+
+// The frustum planes splatted across the lanes once per call
+struct FrustumLanes {
+    Vector3fx8 Normals[Frustum::PlaneCount];
+    Vector3fx8 AbsNormals[Frustum::PlaneCount];
+    Lanes Distances[Frustum::PlaneCount];
+
+    explicit FrustumLanes(const Frustum& frustum) {
+        for (int32_t i = 0; i < Frustum::PlaneCount; ++i) {
+            Normals[i] = Vector3fx8(frustum.Planes[i].Normal);
+            AbsNormals[i] = Vector3fx8(frustum.Planes[i].Normal.Abs());
+            Distances[i] = SIMD::Splat<Lanes>(frustum.Planes[i].Distance);
+        }
+    }
+
+    /** Bits of the lanes whose volume reaches in front of every plane, radius being its extent along each normal. */
+    template <typename RadiusT> int32_t GetVisibleBits(const Vector3fx8& center, const RadiusT& radius) const {
+        const Lanes zero(0.0f);
+        Lanes outside = zero;
+        for (int32_t i = 0; i < Frustum::PlaneCount; ++i) {
+            outside = outside | (center.Dot(Normals[i]) + Distances[i] + radius(i)).LessThan(zero);
+        }
+        return ~outside.GetMaskBits() & ((1 << CullWidth) - 1);
+    }
+};
+
+/**
+ * Packs visibleBits(first) of every group of CullWidth elements into words. The last partial group goes through
+ * tailBits(first, remaining), which pads it to a full group.
+ */
+template <typename VisibleBitsT, typename TailBitsT>
+void PackVisibility(const int32_t count, uint64_t* outVisible, const VisibleBitsT& visibleBits,
+                    const TailBitsT& tailBits) {
+    uint64_t word = 0;
+    int32_t i = 0;
+    for (; i + CullWidth <= count; i += CullWidth) {
+        word |= static_cast<uint64_t>(visibleBits(i)) << (i % BitsPerWord);
+        if ((i + CullWidth) % BitsPerWord == 0) {
+            outVisible[i / BitsPerWord] = word;
+            word = 0;
+        }
+    }
+    const int32_t remaining = count - i;
+    if (remaining > 0) {
+        const int32_t bits = tailBits(i, remaining) & ((1 << remaining) - 1);
+        word |= static_cast<uint64_t>(bits) << (i % BitsPerWord);
+    }
+    if (count % BitsPerWord != 0) {
+        outVisible[count / BitsPerWord] = word;
+    }
+}
+} // namespace
+
+void CullAABBs(const Frustum& frustum, const AABB* boxes, const int32_t count, uint64_t* outVisible) {
+    static_assert(sizeof(AABB) == 6 * sizeof(float));
+    const FrustumLanes planes(frustum);
+    const Lanes half(0.5f);
+    const auto groupBits = [&planes, &half](const AABB* group) {
+        Vector3fx8 min, max;
+        SIMD::_z__Private::LoadInterleaved6(reinterpret_cast<const float*>(group), min.X, min.Y, min.Z, max.X, max.Y,
+                                            max.Z);
+        const Vector3fx8 center = (min + max) * half;
+        const Vector3fx8 extents = (max - min) * half;
+        return planes.GetVisibleBits(center,
+                                     [&](const int32_t plane) { return extents.Dot(planes.AbsNormals[plane]); });
+    };
+    PackVisibility(
+        count, outVisible, [&](const int32_t first) { return groupBits(boxes + first); },
+        [&](const int32_t first, const int32_t remaining) {
+            AABB group[CullWidth];
+            for (int32_t i = 0; i < remaining; ++i) {
+                group[i] = boxes[first + i];
+            }
+            return groupBits(group);
+        });
+}
+
+void CullSpheres(const Frustum& frustum, const BoundingSphere* spheres, const int32_t count, uint64_t* outVisible) {
+    static_assert(sizeof(BoundingSphere) == 4 * sizeof(float));
+    const FrustumLanes planes(frustum);
+    const auto groupBits = [&planes](const BoundingSphere* group) {
+        Vector3fx8 center;
+        Lanes radius;
+        SIMD::_z__Private::LoadInterleaved4(reinterpret_cast<const float*>(group), center.X, center.Y, center.Z,
+                                            radius);
+        return planes.GetVisibleBits(center, [&radius](int32_t) { return radius; });
+    };
+    PackVisibility(
+        count, outVisible, [&](const int32_t first) { return groupBits(spheres + first); },
+        [&](const int32_t first, const int32_t remaining) {
+            BoundingSphere group[CullWidth];
+            for (int32_t i = 0; i < remaining; ++i) {
+                group[i] = spheres[first + i];
+            }
+            return groupBits(group);
+        });
+}
+} // namespace Edvar::Math
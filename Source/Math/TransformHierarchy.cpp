@@ -0,0 +1,304 @@
+#include "Math/TransformHierarchy.hpp"
+#include "Threading/ParallelFor.hpp"
+
+namespace Edvar::Math {
+namespace {
+constexpr int32_t BatchWidth = Matrix4x4fx8::Width;
+
+// Translation * Rotation * Scale for BatchWidth consecutive nodes, as Transform::ToMatrix does for one
+void ComputeLocalMatrices(const Vector3f* translations, const Quaternion* rotations, const Vector3f* scales,
+                          Matrix4x4f* out) {
+    using Lanes = SIMD::Float_8;
+    const Vector3fx8 t = Vector3fx8::Load(translations);
+    const Quaternionx8 r = Quaternionx8::Load(rotations);
+    const Vector3fx8 s = Vector3fx8::Load(scales);
+
+    const Lanes one(1.0f);
+    const Lanes two(2.0f);
+    const Lanes x2 = r.X * two;
+    const Lanes y2 = r.Y * two;
+    const Lanes z2 = r.Z * two;
+    const Lanes xx = r.X * x2;
+    const Lanes yy = r.Y * y2;
+    const Lanes zz = r.Z * z2;
+    const Lanes xy = r.X * y2;
+    const Lanes xz = r.X * z2;
+    const Lanes yz = r.Y * z2;
+    const Lanes wx = r.W * x2;
+    const Lanes wy = r.W * y2;
+    const Lanes wz = r.W * z2;
+
+    Matrix4x4fx8 local;
+    local.M[0][0] = (one - (yy + zz)) * s.X;
+    local.M[1][0] = (xy + wz) * s.X;
+    local.M[2][0] = (xz - wy) * s.X;
+    local.M[0][1] = (xy - wz) * s.Y;
+    local.M[1][1] = (one - (xx + zz)) * s.Y;
+    local.M[2][1] = (yz + wx) * s.Y;
+    local.M[0][2] = (xz + wy) * s.Z;
+    local.M[1][2] = (yz - wx) * s.Z;
+    local.M[2][2] = (one - (xx + yy)) * s.Z;
+    local.M[0][3] = t.X;
+    local.M[1][3] = t.Y;
+    local.M[2][3] = t.Z;
+    local.M[3][0] = Lanes(0.0f);
+    local.M[3][1] = Lanes(0.0f);
+    local.M[3][2] = Lanes(0.0f);
+    local.M[3][3] = one;
+    local.Store(out);
+}
+} // namespace
+
+int32_t TransformHierarchy::AddNode(const int32_t parent, const Vector3f& translation, const Quaternion& rotation,
+                                    const Vector3f& scale) {
+    const int32_t parentSlot = parent == InvalidNode ? InvalidNode : GetSlot(parent);
+    int32_t node;
+    if (freeNodeIds.Length() > 0) {
+        node = freeNodeIds.Pop();
+    } else {
+        node = slotOfNode.Add(InvalidNode);
+    }
+    // Appending keeps parents before children, only the level boundaries need the rebuild
+    slotOfNode[node] = nodes.Add(translation, rotation, scale, parentSlot, node, static_cast<uint8_t>(1),
+                                 Matrix4x4f::Identity);
+    needsRebuild = true;
+    hasChanges = true;
+    return node;
+}
+
+int32_t TransformHierarchy::AddNode(const int32_t parent, const Transform& local) {
+    const Vector3d translation = local.GetTranslation();
+    const Vector3d scale = local.GetScale();
+    return AddNode(parent,
+                   Vector3f(static_cast<float>(translation.X), static_cast<float>(translation.Y),
+                            static_cast<float>(translation.Z)),
+                   local.GetRotation(),
+                   Vector3f(static_cast<float>(scale.X), static_cast<float>(scale.Y), static_cast<float>(scale.Z)));
+}
+
+void TransformHierarchy::RemoveNode(const int32_t node) {
+    const int32_t slot = GetSlot(node);
+    int32_t* nodeIds = nodes.Data<NodeIdField>();
+    const int32_t* parents = nodes.Data<ParentField>();
+    nodeIds[slot] = InvalidNode;
+    slotOfNode[node] = InvalidNode;
+    freeNodeIds.Add(node);
+
+    // Descendants sit after their parents, so one forward pass reaches the whole subtree
+    const int32_t count = nodes.Length();
+    for (int32_t i = slot + 1; i < count; ++i) {
+        if (nodeIds[i] != InvalidNode && parents[i] != InvalidNode && nodeIds[parents[i]] == InvalidNode) {
+            slotOfNode[nodeIds[i]] = InvalidNode;
+            freeNodeIds.Add(nodeIds[i]);
+            nodeIds[i] = InvalidNode;
+        }
+    }
+    needsRebuild = true;
+}
+
+void TransformHierarchy::SetLocal(const int32_t node, const Vector3f& translation, const Quaternion& rotation,
+                                  const Vector3f& scale) {
+    const int32_t slot = GetSlot(node);
+    nodes.Data<TranslationField>()[slot] = translation;
+    nodes.Data<RotationField>()[slot] = rotation;
+    nodes.Data<ScaleField>()[slot] = scale;
+    nodes.Data<ChangedField>()[slot] = 1;
+    hasChanges = true;
+}
+
+void TransformHierarchy::SetLocal(const int32_t node, const Transform& local) {
+    const Vector3d translation = local.GetTranslation();
+    const Vector3d scale = local.GetScale();
+    SetLocal(node,
+             Vector3f(static_cast<float>(translation.X), static_cast<float>(translation.Y),
+                      static_cast<float>(translation.Z)),
+             local.GetRotation(),
+             Vector3f(static_cast<float>(scale.X), static_cast<float>(scale.Y), static_cast<float>(scale.Z)));
+}
+
+Transform TransformHierarchy::GetLocal(const int32_t node) const {
+    const int32_t slot = GetSlot(node);
+    return Transform(nodes.Data<TranslationField>()[slot], nodes.Data<RotationField>()[slot],
+                     nodes.Data<ScaleField>()[slot]);
+}
+
+int32_t TransformHierarchy::GetParent(const int32_t node) const {
+    const int32_t parentSlot = nodes.Data<ParentField>()[GetSlot(node)];
+    return parentSlot == InvalidNode ? InvalidNode : nodes.Data<NodeIdField>()[parentSlot];
+}
+
+const Matrix4x4f& TransformHierarchy::GetWorldMatrix(const int32_t node) const {
+    return nodes.Data<WorldField>()[GetSlot(node)];
+}
+
+int32_t TransformHierarchy::GetNodeCount() const { return slotOfNode.Length() - freeNodeIds.Length(); }
+
+bool TransformHierarchy::IsValidNode(const int32_t node) const {
+    return node >= 0 && node < slotOfNode.Length() && slotOfNode[node] != InvalidNode;
+}
+
+void TransformHierarchy::UpdateWorldMatrices() { UpdateLevels(nullptr); }
+
+void TransformHierarchy::UpdateWorldMatrices(Threading::ThreadPool& pool) { UpdateLevels(&pool); }
+
+int32_t TransformHierarchy::GetSlot(const int32_t node) const {
+    if (!IsValidNode(node)) [[unlikely]] {
+        Platform::GetPlatform().OnFatalError(*String::Format(u"TransformHierarchy: Invalid node {}.", node));
+    }
+    return slotOfNode[node];
+}
+
+void TransformHierarchy::Rebuild() {
+    const int32_t count = nodes.Length();
+    const int32_t* parents = nodes.Data<ParentField>();
+    const int32_t* nodeIds = nodes.Data<NodeIdField>();
+
+    // Depth of every live slot, parents come first so theirs is always known
+    Containers::List<int32_t> depths;
+    depths.Resize(count);
+    Containers::List<int32_t> levelCounts;
+    for (int32_t i = 0; i < count; ++i) {
+        if (nodeIds[i] == InvalidNode) {
+            depths[i] = InvalidNode;
+            continue;
+        }
+        const int32_t depth = parents[i] == InvalidNode ? 0 : depths[parents[i]] + 1;
+        depths[i] = depth;
+        if (depth == levelCounts.Length()) {
+            levelCounts.Add(0);
+        }
+        ++levelCounts[depth];
+    }
+
+    levelStarts.Clear();
+    levelStarts.EnsureCapacity(levelCounts.Length() + 1);
+    int32_t liveCount = 0;
+    for (int32_t level = 0; level < levelCounts.Length(); ++level) {
+        levelStarts.Add(liveCount);
+        liveCount += levelCounts[level];
+    }
+    levelStarts.Add(liveCount);
+
+    // Counting sort by depth, stable so siblings keep their relative order
+    Containers::List<int32_t> newSlots;
+    newSlots.Resize(count);
+    Containers::List<int32_t> order;
+    order.Resize(liveCount);
+    Containers::List<int32_t> nextSlot;
+    nextSlot.Append(levelStarts.Data(), levelCounts.Length());
+    for (int32_t i = 0; i < count; ++i) {
+        if (depths[i] == InvalidNode) {
+            continue;
+        }
+        const int32_t newSlot = nextSlot[depths[i]]++;
+        newSlots[i] = newSlot;
+        order[newSlot] = i;
+    }
+
+    decltype(nodes) sorted;
+    sorted.Resize(liveCount);
+    const Vector3f* translations = nodes.Data<TranslationField>();
+    const Quaternion* rotations = nodes.Data<RotationField>();
+    const Vector3f* scales = nodes.Data<ScaleField>();
+    const uint8_t* changed = nodes.Data<ChangedField>();
+    const Matrix4x4f* worlds = nodes.Data<WorldField>();
+    Vector3f* sortedTranslations = sorted.Data<TranslationField>();
+    Quaternion* sortedRotations = sorted.Data<RotationField>();
+    Vector3f* sortedScales = sorted.Data<ScaleField>();
+    int32_t* sortedParents = sorted.Data<ParentField>();
+    int32_t* sortedNodeIds = sorted.Data<NodeIdField>();
+    uint8_t* sortedChanged = sorted.Data<ChangedField>();
+    Matrix4x4f* sortedWorlds = sorted.Data<WorldField>();
+    for (int32_t newSlot = 0; newSlot < liveCount; ++newSlot) {
+        const int32_t i = order[newSlot];
+        sortedTranslations[newSlot] = translations[i];
+        sortedRotations[newSlot] = rotations[i];
+        sortedScales[newSlot] = scales[i];
+        sortedParents[newSlot] = parents[i] == InvalidNode ? InvalidNode : newSlots[parents[i]];
+        sortedNodeIds[newSlot] = nodeIds[i];
+        sortedChanged[newSlot] = changed[i];
+        sortedWorlds[newSlot] = worlds[i];
+        slotOfNode[nodeIds[i]] = newSlot;
+    }
+    nodes = std::move(sorted);
+    needsRebuild = false;
+}
+
+void TransformHierarchy::UpdateRange(const int32_t begin, const int32_t end) {
+    const Vector3f* translations = nodes.Data<TranslationField>();
+    const Quaternion* rotations = nodes.Data<RotationField>();
+    const Vector3f* scales = nodes.Data<ScaleField>();
+    const int32_t* parents = nodes.Data<ParentField>();
+    uint8_t* changed = nodes.Data<ChangedField>();
+    Matrix4x4f* worlds = nodes.Data<WorldField>();
+
+    alignas(64) Matrix4x4f locals[BatchWidth];
+    for (int32_t batch = begin; batch < end; batch += BatchWidth) {
+        const int32_t batchCount = end - batch < BatchWidth ? end - batch : BatchWidth;
+
+        // A node is recomputed if it or its parent changed, the parent level has already been flagged by now
+        uint32_t pending = 0;
+        for (int32_t i = 0; i < batchCount; ++i) {
+            const int32_t slot = batch + i;
+            if (changed[slot] != 0 || (parents[slot] != InvalidNode && changed[parents[slot]] != 0)) {
+                pending |= 1u << i;
+            }
+        }
+        if (pending == 0) {
+            continue;
+        }
+
+        if (batchCount == BatchWidth) {
+            ComputeLocalMatrices(translations + batch, rotations + batch, scales + batch, locals);
+        } else {
+            // Pad the tail with identities so it takes the same path as full batches
+            Vector3f tailTranslations[BatchWidth];
+            Quaternion tailRotations[BatchWidth];
+            Vector3f tailScales[BatchWidth];
+            for (int32_t i = 0; i < BatchWidth; ++i) {
+                const bool inRange = i < batchCount;
+                tailTranslations[i] = inRange ? translations[batch + i] : Vector3f::Zero;
+                tailRotations[i] = inRange ? rotations[batch + i] : Quaternion::Identity;
+                tailScales[i] = inRange ? scales[batch + i] : Vector3f::One;
+            }
+            ComputeLocalMatrices(tailTranslations, tailRotations, tailScales, locals);
+        }
+
+        for (int32_t i = 0; i < batchCount; ++i) {
+            if ((pending & (1u << i)) == 0) {
+                continue;
+            }
+            const int32_t slot = batch + i;
+            const int32_t parentSlot = parents[slot];
+            worlds[slot] = parentSlot == InvalidNode ? locals[i] : worlds[parentSlot] * locals[i];
+            changed[slot] = 1;
+        }
+    }
+}
+
+void TransformHierarchy::UpdateLevels(Threading::ThreadPool* pool) {
+    if (needsRebuild) {
+        Rebuild();
+    }
+    if (!hasChanges) {
+        return;
+    }
+
+    // Levels run one after the other, nodes within a level only read the finished level above
+    for (int32_t level = 0; level + 1 < levelStarts.Length(); ++level) {
+        const int32_t begin = levelStarts[level];
+        const int32_t count = levelStarts[level + 1] - begin;
+        if (pool != nullptr && count > UpdateChunkSize) {
+            Threading::ParallelFor(*pool, count, UpdateChunkSize,
+                                   [this, begin](const int32_t Begin, const int32_t End) {
+                                       UpdateRange(begin + Begin, begin + End);
+                                   });
+        } else {
+            UpdateRange(begin, begin + count);
+        }
+    }
+
+    Memory::ZeroMemory(nodes.Data<ChangedField>(), static_cast<uint64_t>(nodes.Length()));
+    hasChanges = false;
+}
+} // namespace Edvar::Math
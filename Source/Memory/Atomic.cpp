@@ -26,6 +26,17 @@ inline int32_t _getMemorder(MemoryOrder order) {
         return __ATOMIC_SEQ_CST;
     }
 }
+// The failure order of a compare-exchange can not contain a release.
+inline int32_t _getFailureMemorder(MemoryOrder order) {
+    switch (order) {
+    case MemoryOrder::Release:
+        return __ATOMIC_RELAXED;
+    case MemoryOrder::AcquireAndRelease:
+        return __ATOMIC_ACQUIRE;
+    default:
+        return _getMemorder(order);
+    }
+}
 #endif
 void Impl::Store(Atomic<int8_t>& atomic, int8_t value, MemoryOrder order) {
 #if EDVAR_MEMORY_ATOMIC_WINDOWS
@@ -393,4 +404,156 @@ int64_t Impl::FetchAdd(Atomic<int64_t>& atomic, int64_t value, MemoryOrder order
 #endif
 }
 
+int8_t Impl::Exchange(Atomic<int8_t>& atomic, int8_t value, MemoryOrder order) {
+#if EDVAR_MEMORY_ATOMIC_WINDOWS
+    // Interlocked operations are full barriers, every order is satisfied.
+    (void)order;
+    return _InterlockedExchange8(reinterpret_cast<volatile CHAR*>(&atomic.storage), value);
+#elif EDVAR_MEMORY_ATOMIC_GNUC
+    return __atomic_exchange_n(reinterpret_cast<volatile int8_t*>(&atomic.storage), value, _getMemorder(order));
+#else
+    ScopedLock lock(*atomic.mutex);
+    const int8_t oldValue = atomic.storage;
+    atomic.storage = value;
+    return oldValue;
+#endif
+}
+bool Impl::CompareExchange(Atomic<int8_t>& atomic, int8_t& expected, int8_t desired, MemoryOrder order) {
+#if EDVAR_MEMORY_ATOMIC_WINDOWS
+    (void)order;
+    const int8_t oldValue =
+        _InterlockedCompareExchange8(reinterpret_cast<volatile CHAR*>(&atomic.storage), desired, expected);
+    if (oldValue == expected) {
+        return true;
+    }
+    expected = oldValue;
+    return false;
+#elif EDVAR_MEMORY_ATOMIC_GNUC
+    return __atomic_compare_exchange_n(reinterpret_cast<volatile int8_t*>(&atomic.storage), &expected, desired, false,
+                                       _getMemorder(order), _getFailureMemorder(order));
+#else
+    ScopedLock lock(*atomic.mutex);
+    if (atomic.storage == expected) {
+        atomic.storage = desired;
+        return true;
+    }
+    expected = atomic.storage;
+    return false;
+#endif
+}
+
+int16_t Impl::Exchange(Atomic<int16_t>& atomic, int16_t value, MemoryOrder order) {
+#if EDVAR_MEMORY_ATOMIC_WINDOWS
+    // Interlocked operations are full barriers, every order is satisfied.
+    (void)order;
+    return _InterlockedExchange16(reinterpret_cast<volatile SHORT*>(&atomic.storage), value);
+#elif EDVAR_MEMORY_ATOMIC_GNUC
+    return __atomic_exchange_n(reinterpret_cast<volatile int16_t*>(&atomic.storage), value, _getMemorder(order));
+#else
+    ScopedLock lock(*atomic.mutex);
+    const int16_t oldValue = atomic.storage;
+    atomic.storage = value;
+    return oldValue;
+#endif
+}
+bool Impl::CompareExchange(Atomic<int16_t>& atomic, int16_t& expected, int16_t desired, MemoryOrder order) {
+#if EDVAR_MEMORY_ATOMIC_WINDOWS
+    (void)order;
+    const int16_t oldValue =
+        _InterlockedCompareExchange16(reinterpret_cast<volatile SHORT*>(&atomic.storage), desired, expected);
+    if (oldValue == expected) {
+        return true;
+    }
+    expected = oldValue;
+    return false;
+#elif EDVAR_MEMORY_ATOMIC_GNUC
+    return __atomic_compare_exchange_n(reinterpret_cast<volatile int16_t*>(&atomic.storage), &expected, desired, false,
+                                       _getMemorder(order), _getFailureMemorder(order));
+#else
+    ScopedLock lock(*atomic.mutex);
+    if (atomic.storage == expected) {
+        atomic.storage = desired;
+        return true;
+    }
+    expected = atomic.storage;
+    return false;
+#endif
+}
+
+int32_t Impl::Exchange(Atomic<int32_t>& atomic, int32_t value, MemoryOrder order) {
+#if EDVAR_MEMORY_ATOMIC_WINDOWS
+    // Interlocked operations are full barriers, every order is satisfied.
+    (void)order;
+    return _InterlockedExchange(reinterpret_cast<volatile LONG*>(&atomic.storage), value);
+#elif EDVAR_MEMORY_ATOMIC_GNUC
+    return __atomic_exchange_n(reinterpret_cast<volatile int32_t*>(&atomic.storage), value, _getMemorder(order));
+#else
+    ScopedLock lock(*atomic.mutex);
+    const int32_t oldValue = atomic.storage;
+    atomic.storage = value;
+    return oldValue;
+#endif
+}
+bool Impl::CompareExchange(Atomic<int32_t>& atomic, int32_t& expected, int32_t desired, MemoryOrder order) {
+#if EDVAR_MEMORY_ATOMIC_WINDOWS
+    (void)order;
+    const int32_t oldValue =
+        _InterlockedCompareExchange(reinterpret_cast<volatile LONG*>(&atomic.storage), desired, expected);
+    if (oldValue == expected) {
+        return true;
+    }
+    expected = oldValue;
+    return false;
+#elif EDVAR_MEMORY_ATOMIC_GNUC
+    return __atomic_compare_exchange_n(reinterpret_cast<volatile int32_t*>(&atomic.storage), &expected, desired, false,
+                                       _getMemorder(order), _getFailureMemorder(order));
+#else
+    ScopedLock lock(*atomic.mutex);
+    if (atomic.storage == expected) {
+        atomic.storage = desired;
+        return true;
+    }
+    expected = atomic.storage;
+    return false;
+#endif
+}
+
+int64_t Impl::Exchange(Atomic<int64_t>& atomic, int64_t value, MemoryOrder order) {
+#if EDVAR_MEMORY_ATOMIC_WINDOWS
+    // Interlocked operations are full barriers, every order is satisfied.
+    (void)order;
+    return _InterlockedExchange64(reinterpret_cast<volatile LONGLONG*>(&atomic.storage), value);
+#elif EDVAR_MEMORY_ATOMIC_GNUC
+    return __atomic_exchange_n(reinterpret_cast<volatile int64_t*>(&atomic.storage), value, _getMemorder(order));
+#else
+    ScopedLock lock(*atomic.mutex);
+    const int64_t oldValue = atomic.storage;
+    atomic.storage = value;
+    return oldValue;
+#endif
+}
+bool Impl::CompareExchange(Atomic<int64_t>& atomic, int64_t& expected, int64_t desired, MemoryOrder order) {
+#if EDVAR_MEMORY_ATOMIC_WINDOWS
+    (void)order;
+    const int64_t oldValue =
+        _InterlockedCompareExchange64(reinterpret_cast<volatile LONGLONG*>(&atomic.storage), desired, expected);
+    if (oldValue == expected) {
+        return true;
+    }
+    expected = oldValue;
+    return false;
+#elif EDVAR_MEMORY_ATOMIC_GNUC
+    return __atomic_compare_exchange_n(reinterpret_cast<volatile int64_t*>(&atomic.storage), &expected, desired, false,
+                                       _getMemorder(order), _getFailureMemorder(order));
+#else
+    ScopedLock lock(*atomic.mutex);
+    if (atomic.storage == expected) {
+        atomic.storage = desired;
+        return true;
+    }
+    expected = atomic.storage;
+    return false;
+#endif
+}
+
 }; // namespace Edvar::Memory::_z_private_AtomicDetails
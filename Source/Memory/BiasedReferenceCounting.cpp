@@ -0,0 +1,197 @@
+#include "Memory/BiasedReferenceCounting.hpp"
+#include "Memory/SmartPointers.hpp"
+#include "Threading/Mutex.hpp"
+#include <algorithm>
+
+namespace Edvar::Memory {
+namespace _z__Private {
+int64_t AcquireThreadToken() {
+    static Atomic<int64_t> nextToken(1);
+    return nextToken.FetchAdd(1, MemoryOrder::Relaxed);
+}
+
+// Biased counts other threads handed back to the owner, merged at the owner's next quiescent point.
+struct BiasedReferenceQueue : IntrusiveRefCounted<true> {
+    Threading::Mutex QueueMutex;
+    BiasedReferenceCount* Head = nullptr;
+    // Set once the owner thread has exited, releasing threads then merge by themselves.
+    bool Closed = false;
+
+    /** @return false if the owner has exited and the caller has to merge. */
+    bool Push(BiasedReferenceCount* count) {
+        Threading::ScopedLock lock(QueueMutex);
+        if (Closed) {
+            return false;
+        }
+        count->queueNext = Head;
+        Head = count;
+        return true;
+    }
+    BiasedReferenceCount* TakeAll(const bool close) {
+        Threading::ScopedLock lock(QueueMutex);
+        BiasedReferenceCount* taken = Head;
+        Head = nullptr;
+        Closed = Closed || close;
+        return taken;
+    }
+    static void MergeAll(BiasedReferenceCount* list) {
+        while (list != nullptr) {
+            // Merge may destroy the count.
+            BiasedReferenceCount* next = list->queueNext;
+            list->queueNext = nullptr;
+            list->Merge();
+            list = next;
+        }
+    }
+};
+
+struct BiasedThreadState {
+    IntrusivePtr<BiasedReferenceQueue> Queue;
+    Containers::List<BiasedReferenceCount*> Deferred;
+    int32_t DeferDepth = 0;
+
+    ~BiasedThreadState() {
+        Flush();
+        if (Queue.IsValid()) {
+            BiasedReferenceQueue::MergeAll(Queue->TakeAll(true));
+        }
+    }
+
+    BiasedReferenceQueue* GetQueue() {
+        if (!Queue.IsValid()) {
+            Queue = new BiasedReferenceQueue();
+        }
+        return Queue.Get();
+    }
+
+    void Flush() {
+        // Destroying an object can release further references, loop until nothing is left.
+        while (Deferred.Length() > 0) {
+            Containers::List<BiasedReferenceCount*> batch;
+            batch.Append(Deferred.Data(), Deferred.Length());
+            Deferred.Resize(0);
+            // Group releases of the same object into a single atomic operation.
+            std::sort(batch.Data(), batch.Data() + batch.Length());
+            for (int32_t i = 0; i < batch.Length();) {
+                BiasedReferenceCount* count = batch[i];
+                int32_t run = 1;
+                while (i + run < batch.Length() && batch[i + run] == count) {
+                    ++run;
+                }
+                if (count->SharedRelease(run)) {
+                    count->destroyObject(count);
+                }
+                i += run;
+            }
+        }
+        if (Queue.IsValid()) {
+            BiasedReferenceQueue::MergeAll(Queue->TakeAll(false));
+        }
+    }
+
+    static bool IsDeferring();
+    static void Defer(BiasedReferenceCount* count);
+};
+
+thread_local BiasedThreadState ThreadState;
+
+bool BiasedThreadState::IsDeferring() { return ThreadState.DeferDepth > 0; }
+void BiasedThreadState::Defer(BiasedReferenceCount* count) { ThreadState.Deferred.Add(count); }
+} // namespace _z__Private
+
+BiasedReferenceCount::BiasedReferenceCount(const DestroyFunctionType InDestroyObject)
+    : ownerToken(_z__Private::CurrentThreadToken), shared(0), ownerQueue(_z__Private::ThreadState.GetQueue()),
+      destroyObject(InDestroyObject) {
+    ownerQueue->AddReference();
+}
+
+BiasedReferenceCount::~BiasedReferenceCount() {
+    if (ownerQueue->ReleaseReference()) {
+        delete ownerQueue;
+    }
+}
+
+int BiasedReferenceCount::Load() const {
+    const int32_t value = shared.Load(MemoryOrder::Acquire);
+    const int32_t count = value >> CountShift;
+    if ((value & MergedFlag) != 0) {
+        return count;
+    }
+    // The owner still holds at least one reference, the shared part can be negative until merged.
+    return (count > 0 ? count : 0) + 1;
+}
+
+int BiasedReferenceCount::MergeFromOwner() {
+    ownerMerged = true;
+    int32_t expected = shared.Load(MemoryOrder::Relaxed);
+    int32_t desired;
+    do {
+        desired = expected | MergedFlag;
+    } while (!shared.CompareExchange(expected, desired, MemoryOrder::AcquireAndRelease));
+    // A queued count is destroyed by the merge of the queue, not here.
+    return desired == MergedFlag ? 1 : 2;
+}
+
+int BiasedReferenceCount::SharedFetchAdd(const int Delta) {
+    if (Delta > 0) {
+        const int32_t previous = shared.FetchAdd(Delta << CountShift, MemoryOrder::Relaxed);
+        const int32_t previousCount = previous >> CountShift;
+        if ((previous & MergedFlag) != 0) {
+            return previousCount;
+        }
+        return (previousCount > 0 ? previousCount : 0) + 1;
+    }
+    if (_z__Private::BiasedThreadState::IsDeferring()) {
+        for (int i = 0; i < -Delta; ++i) {
+            _z__Private::BiasedThreadState::Defer(this);
+        }
+        return 2;
+    }
+    return SharedRelease(-Delta) ? 1 : 2;
+}
+
+bool BiasedReferenceCount::SharedRelease(const int32_t Count) {
+    int32_t expected = shared.Load(MemoryOrder::Relaxed);
+    int32_t desired;
+    bool enqueue;
+    do {
+        enqueue = false;
+        const int32_t newCount = (expected >> CountShift) - Count;
+        int32_t flags = expected & (MergedFlag | QueuedFlag);
+        if ((flags & (MergedFlag | QueuedFlag)) == 0 && newCount < 0) {
+            // Released references the owner handed out, only the owner can tell whether they were the last.
+            flags |= QueuedFlag;
+            enqueue = true;
+        }
+        desired = (newCount << CountShift) | flags;
+    } while (!shared.CompareExchange(expected, desired, MemoryOrder::AcquireAndRelease));
+
+    if (enqueue) {
+        if (!ownerQueue->Push(this)) {
+            Merge();
+        }
+        return false;
+    }
+    return desired == MergedFlag;
+}
+
+void BiasedReferenceCount::Merge() {
+    // Runs on the owner thread, or after it exited when biasedCount can no longer change.
+    const int32_t biased = ownerMerged ? 0 : biasedCount;
+    ownerMerged = true;
+    biasedCount = 0;
+    int32_t expected = shared.Load(MemoryOrder::Relaxed);
+    int32_t desired;
+    do {
+        desired = (((expected >> CountShift) + biased) << CountShift) | MergedFlag;
+    } while (!shared.CompareExchange(expected, desired, MemoryOrder::AcquireAndRelease));
+    if (desired == MergedFlag) {
+        destroyObject(this);
+    }
+}
+
+void FlushBiasedReferenceCounts() { _z__Private::ThreadState.Flush(); }
+
+ScopedDeferredReleases::ScopedDeferredReleases() { ++_z__Private::ThreadState.DeferDepth; }
+ScopedDeferredReleases::~ScopedDeferredReleases() { --_z__Private::ThreadState.DeferDepth; }
+} // namespace Edvar::Memory
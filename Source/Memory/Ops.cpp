@@ -0,0 +1,166 @@
+#include "Memory/Ops.hpp"
+#include "Platform/RuntimeDispatch.hpp"
+
+namespace Edvar::Memory::_z__Private {
+namespace {
+// Copies and fills larger than this would evict most of the cache for data the caller is unlikely to read back soon,
+// they bypass it with non-temporal stores.
+constexpr uint64_t NonTemporalThreshold = 2 * 1024 * 1024;
+
+// The kernels in OpsKernels.inl are built once per instruction set, see Platform/RuntimeDispatch.hpp.
+
+#if EDVAR_CPP_CORE_DISPATCH_AVX2
+namespace AVX2 {
+#    define EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_TARGET_AVX2
+using VectorType = __m256i;
+constexpr uint64_t VectorWidth = 32;
+constexpr bool HasNonTemporalStore = true;
+EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE VectorType LoadVector(const unsigned char* Ptr) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Ptr));
+}
+EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE void StoreVector(unsigned char* Ptr,
+                                                                            const VectorType Value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(Ptr), Value);
+}
+EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE void StreamVector(unsigned char* Ptr,
+                                                                             const VectorType Value) {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(Ptr), Value);
+}
+EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE VectorType SplatVector(const uint8_t Value) {
+    return _mm256_set1_epi8(static_cast<char>(Value));
+}
+EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE VectorType EqualMask(const VectorType A,
+                                                                                const VectorType B) {
+    return _mm256_cmpeq_epi8(A, B);
+}
+EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE VectorType AndMasks(const VectorType A, const VectorType B) {
+    return _mm256_and_si256(A, B);
+}
+EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE bool IsAllEqual(const VectorType Mask) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(Mask)) == 0xFFFFFFFFu;
+}
+// Non-temporal stores are weakly ordered, publish them before returning.
+EDVAR_CPP_CORE_FORCE_INLINE void StoreFence() { _mm_sfence(); }
+#    include "OpsKernels.inl"
+#    undef EDVAR_CPP_CORE_DISPATCH_TARGET
+} // namespace AVX2
+#endif
+
+#if EDVAR_CPP_CORE_DISPATCH_X86
+namespace SSE2 {
+#    define EDVAR_CPP_CORE_DISPATCH_TARGET
+using VectorType = __m128i;
+constexpr uint64_t VectorWidth = 16;
+constexpr bool HasNonTemporalStore = true;
+EDVAR_CPP_CORE_FORCE_INLINE VectorType LoadVector(const unsigned char* Ptr) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(Ptr));
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StoreVector(unsigned char* Ptr, const VectorType Value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(Ptr), Value);
+}
+EDVAR_CPP_CORE_FORCE_INLINE void StreamVector(unsigned char* Ptr, const VectorType Value) {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(Ptr), Value);
+}
+EDVAR_CPP_CORE_FORCE_INLINE VectorType SplatVector(const uint8_t Value) {
+    return _mm_set1_epi8(static_cast<char>(Value));
+}
+EDVAR_CPP_CORE_FORCE_INLINE VectorType EqualMask(const VectorType A, const VectorType B) {
+    return _mm_cmpeq_epi8(A, B);
+}
+EDVAR_CPP_CORE_FORCE_INLINE VectorType AndMasks(const VectorType A, const VectorType B) { return _mm_and_si128(A, B); }
+EDVAR_CPP_CORE_FORCE_INLINE bool IsAllEqual(const VectorType Mask) { return _mm_movemask_epi8(Mask) == 0xFFFF; }
+EDVAR_CPP_CORE_FORCE_INLINE void StoreFence() { _mm_sfence(); }
+#    include "OpsKernels.inl"
+#    undef EDVAR_CPP_CORE_DISPATCH_TARGET
+} // namespace SSE2
+#elif EDVAR_CPP_CORE_DISPATCH_ARM64
+namespace NEON {
+#    define EDVAR_CPP_CORE_DISPATCH_TARGET
+using VectorType = uint8x16_t;
+constexpr uint64_t VectorWidth = 16;
+constexpr bool HasNonTemporalStore = false;
+EDVAR_CPP_CORE_FORCE_INLINE VectorType LoadVector(const unsigned char* Ptr) { return vld1q_u8(Ptr); }
+EDVAR_CPP_CORE_FORCE_INLINE void StoreVector(unsigned char* Ptr, const VectorType Value) { vst1q_u8(Ptr, Value); }
+EDVAR_CPP_CORE_FORCE_INLINE void StreamVector(unsigned char* Ptr, const VectorType Value) { vst1q_u8(Ptr, Value); }
+EDVAR_CPP_CORE_FORCE_INLINE VectorType SplatVector(const uint8_t Value) { return vdupq_n_u8(Value); }
+EDVAR_CPP_CORE_FORCE_INLINE VectorType EqualMask(const VectorType A, const VectorType B) { return vceqq_u8(A, B); }
+EDVAR_CPP_CORE_FORCE_INLINE VectorType AndMasks(const VectorType A, const VectorType B) { return vandq_u8(A, B); }
+EDVAR_CPP_CORE_FORCE_INLINE bool IsAllEqual(const VectorType Mask) { return vminvq_u8(Mask) == 0xFF; }
+EDVAR_CPP_CORE_FORCE_INLINE void StoreFence() {}
+#    include "OpsKernels.inl"
+#    undef EDVAR_CPP_CORE_DISPATCH_TARGET
+} // namespace NEON
+#else
+namespace Scalar {
+#    define EDVAR_CPP_CORE_DISPATCH_TARGET
+using VectorType = uint64_t;
+constexpr uint64_t VectorWidth = 8;
+constexpr bool HasNonTemporalStore = false;
+EDVAR_CPP_CORE_FORCE_INLINE VectorType LoadVector(const unsigned char* Ptr) { return LoadWord<uint64_t>(Ptr); }
+EDVAR_CPP_CORE_FORCE_INLINE void StoreVector(unsigned char* Ptr, const VectorType Value) { StoreWord(Ptr, Value); }
+EDVAR_CPP_CORE_FORCE_INLINE void StreamVector(unsigned char* Ptr, const VectorType Value) { StoreWord(Ptr, Value); }
+EDVAR_CPP_CORE_FORCE_INLINE VectorType SplatVector(const uint8_t Value) { return 0x0101010101010101ull * Value; }
+// All bits set where the words agree.
+EDVAR_CPP_CORE_FORCE_INLINE VectorType EqualMask(const VectorType A, const VectorType B) { return ~(A ^ B); }
+EDVAR_CPP_CORE_FORCE_INLINE VectorType AndMasks(const VectorType A, const VectorType B) { return A & B; }
+EDVAR_CPP_CORE_FORCE_INLINE bool IsAllEqual(const VectorType Mask) { return Mask == ~0ull; }
+EDVAR_CPP_CORE_FORCE_INLINE void StoreFence() {}
+#    include "OpsKernels.inl"
+#    undef EDVAR_CPP_CORE_DISPATCH_TARGET
+} // namespace Scalar
+#endif
+
+struct KernelTable {
+    void (*Copy)(unsigned char* Dest, const unsigned char* Src, uint64_t Size);
+    void (*Set)(unsigned char* Dest, uint8_t Value, uint64_t Size);
+    int32_t (*Compare)(const unsigned char* Ptr1, const unsigned char* Ptr2, uint64_t Size);
+};
+
+#define EDVAR_CPP_CORE_MEMORY_OPS_KERNEL_TABLE(Namespace)                                                              \
+    KernelTable { Namespace::CopyBytes, Namespace::SetBytes, Namespace::CompareBytes }
+
+// AVX-512 is left out on purpose, 64 byte stores lower the clock on several cores and copies larger than a few vectors
+// are bound by memory bandwidth anyway.
+EDVAR_CPP_CORE_DEFINE_KERNEL_DISPATCH(KernelTable, EDVAR_CPP_CORE_MEMORY_OPS_KERNEL_TABLE)
+#undef EDVAR_CPP_CORE_MEMORY_OPS_KERNEL_TABLE
+} // namespace
+
+// Sizes up to twice the inline limit are handled before the dispatch, they take less time than the indirect call.
+
+void CopyBytes(unsigned char* Dest, const unsigned char* Src, const uint64_t Size) {
+    if (Size <= InlineOpsSize) {
+        CopySmall(Dest, Src, Size);
+        return;
+    }
+    if (Size <= 2 * InlineOpsSize) {
+        CopyHeadTail<uint64_t>(Dest, Src, 16);
+        CopyHeadTail<uint64_t>(Dest + Size - 16, Src + Size - 16, 16);
+        return;
+    }
+    GetKernels().Copy(Dest, Src, Size);
+}
+
+void SetBytes(unsigned char* Dest, const uint8_t Value, const uint64_t Size) {
+    if (Size <= InlineOpsSize) {
+        SetSmall(Dest, Value, Size);
+        return;
+    }
+    if (Size <= 2 * InlineOpsSize) {
+        SetSmall(Dest, Value, 16);
+        SetSmall(Dest + Size - 16, Value, 16);
+        return;
+    }
+    GetKernels().Set(Dest, Value, Size);
+}
+
+int32_t CompareBytes(const unsigned char* Ptr1, const unsigned char* Ptr2, const uint64_t Size) {
+    if (Size <= InlineOpsSize) {
+        return CompareSmall(Ptr1, Ptr2, Size);
+    }
+    if (Size <= 2 * InlineOpsSize) {
+        const int32_t head = CompareHeadTail<uint64_t>(Ptr1, Ptr2, 16);
+        return head != 0 ? head : CompareHeadTail<uint64_t>(Ptr1 + Size - 16, Ptr2 + Size - 16, 16);
+    }
+    return GetKernels().Compare(Ptr1, Ptr2, Size);
+}
+} // namespace Edvar::Memory::_z__Private
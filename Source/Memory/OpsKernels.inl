@@ -0,0 +1,132 @@
+// Kernels behind the Memory ops, included by Ops.cpp once per instruction set. The including namespace provides
+// VectorType, VectorWidth, HasNonTemporalStore and the vector primitives, EDVAR_CPP_CORE_DISPATCH_TARGET holds the
+// function attributes needed to emit that instruction set.
+
+// Bytes to advance Ptr by so it becomes vector aligned.
+EDVAR_CPP_CORE_DISPATCH_TARGET EDVAR_CPP_CORE_FORCE_INLINE uint64_t AlignmentOffset(const unsigned char* Ptr) {
+    return (VectorWidth - (reinterpret_cast<uintptr_t>(Ptr) & (VectorWidth - 1))) & (VectorWidth - 1);
+}
+
+EDVAR_CPP_CORE_DISPATCH_TARGET void CopyBytes(unsigned char* Dest, const unsigned char* Src, const uint64_t Size) {
+    if (Size <= InlineOpsSize) {
+        CopySmall(Dest, Src, Size);
+        return;
+    }
+    if (Size < VectorWidth) {
+        // Only reachable with 32 byte vectors.
+        CopyHeadTail<uint64_t>(Dest, Src, 16);
+        CopyHeadTail<uint64_t>(Dest + Size - 16, Src + Size - 16, 16);
+        return;
+    }
+    if (Size <= 2 * VectorWidth) {
+        const VectorType head = LoadVector(Src);
+        const VectorType tail = LoadVector(Src + Size - VectorWidth);
+        StoreVector(Dest, head);
+        StoreVector(Dest + Size - VectorWidth, tail);
+        return;
+    }
+
+    // The unaligned head is stored as is, the loop then stores to aligned addresses and the unaligned tail is stored
+    // last, overlapping the loop's final bytes.
+    const VectorType head = LoadVector(Src);
+    const VectorType tail = LoadVector(Src + Size - VectorWidth);
+    StoreVector(Dest, head);
+    uint64_t offset = AlignmentOffset(Dest);
+    const uint64_t loopEnd = Size - VectorWidth;
+    if (HasNonTemporalStore && Size >= NonTemporalThreshold) {
+        for (; offset < loopEnd; offset += VectorWidth) {
+            StreamVector(Dest + offset, LoadVector(Src + offset));
+        }
+        StoreFence();
+    } else {
+        for (; offset + 4 * VectorWidth <= loopEnd; offset += 4 * VectorWidth) {
+            const VectorType a = LoadVector(Src + offset);
+            const VectorType b = LoadVector(Src + offset + VectorWidth);
+            const VectorType c = LoadVector(Src + offset + 2 * VectorWidth);
+            const VectorType d = LoadVector(Src + offset + 3 * VectorWidth);
+            StoreVector(Dest + offset, a);
+            StoreVector(Dest + offset + VectorWidth, b);
+            StoreVector(Dest + offset + 2 * VectorWidth, c);
+            StoreVector(Dest + offset + 3 * VectorWidth, d);
+        }
+        for (; offset < loopEnd; offset += VectorWidth) {
+            StoreVector(Dest + offset, LoadVector(Src + offset));
+        }
+    }
+    StoreVector(Dest + loopEnd, tail);
+}
+
+EDVAR_CPP_CORE_DISPATCH_TARGET void SetBytes(unsigned char* Dest, const uint8_t Value, const uint64_t Size) {
+    if (Size <= InlineOpsSize) {
+        SetSmall(Dest, Value, Size);
+        return;
+    }
+    if (Size < VectorWidth) {
+        SetSmall(Dest, Value, 16);
+        SetSmall(Dest + Size - 16, Value, 16);
+        return;
+    }
+    const VectorType value = SplatVector(Value);
+    StoreVector(Dest, value);
+    StoreVector(Dest + Size - VectorWidth, value);
+    if (Size <= 2 * VectorWidth) {
+        return;
+    }
+
+    uint64_t offset = AlignmentOffset(Dest);
+    const uint64_t loopEnd = Size - VectorWidth;
+    if (HasNonTemporalStore && Size >= NonTemporalThreshold) {
+        for (; offset < loopEnd; offset += VectorWidth) {
+            StreamVector(Dest + offset, value);
+        }
+        StoreFence();
+    } else {
+        for (; offset + 4 * VectorWidth <= loopEnd; offset += 4 * VectorWidth) {
+            StoreVector(Dest + offset, value);
+            StoreVector(Dest + offset + VectorWidth, value);
+            StoreVector(Dest + offset + 2 * VectorWidth, value);
+            StoreVector(Dest + offset + 3 * VectorWidth, value);
+        }
+        for (; offset < loopEnd; offset += VectorWidth) {
+            StoreVector(Dest + offset, value);
+        }
+    }
+}
+
+EDVAR_CPP_CORE_DISPATCH_TARGET int32_t CompareBytes(const unsigned char* Ptr1, const unsigned char* Ptr2,
+                                                    const uint64_t Size) {
+    if (Size <= InlineOpsSize) {
+        return CompareSmall(Ptr1, Ptr2, Size);
+    }
+    if (Size < VectorWidth) {
+        const int32_t head = CompareHeadTail<uint64_t>(Ptr1, Ptr2, 16);
+        return head != 0 ? head : CompareHeadTail<uint64_t>(Ptr1 + Size - 16, Ptr2 + Size - 16, 16);
+    }
+    uint64_t offset = 0;
+    // Four vectors per branch, the differing vector is searched for only once a difference is known.
+    for (; offset + 4 * VectorWidth <= Size; offset += 4 * VectorWidth) {
+        const VectorType a = EqualMask(LoadVector(Ptr1 + offset), LoadVector(Ptr2 + offset));
+        const VectorType b =
+            EqualMask(LoadVector(Ptr1 + offset + VectorWidth), LoadVector(Ptr2 + offset + VectorWidth));
+        const VectorType c =
+            EqualMask(LoadVector(Ptr1 + offset + 2 * VectorWidth), LoadVector(Ptr2 + offset + 2 * VectorWidth));
+        const VectorType d =
+            EqualMask(LoadVector(Ptr1 + offset + 3 * VectorWidth), LoadVector(Ptr2 + offset + 3 * VectorWidth));
+        if (!IsAllEqual(AndMasks(AndMasks(a, b), AndMasks(c, d)))) {
+            break;
+        }
+    }
+    for (; offset + VectorWidth <= Size; offset += VectorWidth) {
+        if (!IsAllEqual(EqualMask(LoadVector(Ptr1 + offset), LoadVector(Ptr2 + offset)))) {
+            return CompareBytewise(Ptr1 + offset, Ptr2 + offset, VectorWidth);
+        }
+    }
+    if (offset < Size) {
+        // The overlapping tail rechecks bytes already known equal, the first difference in it is the first overall.
+        offset = Size - VectorWidth;
+        if (!IsAllEqual(EqualMask(LoadVector(Ptr1 + offset), LoadVector(Ptr2 + offset)))) {
+            return CompareBytewise(Ptr1 + offset, Ptr2 + offset, VectorWidth);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,403 @@
+#include "Memory/Reclamation.hpp"
+#include "Platform/IPlatformThreading.hpp"
+#include "Threading/Mutex.hpp"
+#include <algorithm>
+
+namespace Edvar::Memory {
+namespace _z__Private {
+namespace {
+// Retired objects a thread collects before it tries to free them.
+constexpr int32_t RetireBatchSize = 64;
+// The global domains are destroyed after the main thread's state, they must not touch it anymore.
+thread_local bool ThreadStateAlive = false;
+} // namespace
+
+struct RetiredObject {
+    void* Ptr;
+    RetireDeleterType Deleter;
+    int64_t Epoch;
+};
+
+struct EpochThreadRecord {
+    // (epoch << 1) | 1 while the owner is inside a critical section, 0 outside.
+    Atomic<int64_t> State{0};
+    Atomic<int32_t> InUse{1};
+    // Records are never unlinked, only reused, so the advancing scan needs no protection.
+    EpochThreadRecord* Next = nullptr;
+    // Owner thread only.
+    int32_t Nesting = 0;
+    Containers::List<RetiredObject> Retired;
+};
+
+struct EpochDomainState {
+    Atomic<EpochThreadRecord*> Records{nullptr};
+    // Batches handed over by threads that could not free them, or that exited.
+    Threading::Mutex PendingMutex;
+    Containers::List<RetiredObject> Pending;
+    Atomic<int32_t> PendingCount{0};
+};
+
+struct HazardThreadData {
+    Containers::List<HazardRecord*> FreeRecords;
+    Containers::List<RetiredObject> Retired;
+};
+
+struct HazardDomainState {
+    Threading::Mutex PendingMutex;
+    Containers::List<RetiredObject> Pending;
+    Atomic<int32_t> PendingCount{0};
+};
+
+namespace {
+void HandOver(Threading::Mutex& pendingMutex, Containers::List<RetiredObject>& pending, Atomic<int32_t>& pendingCount,
+              Containers::List<RetiredObject>& retired) {
+    if (retired.Length() == 0) {
+        return;
+    }
+    Threading::ScopedLock lock(pendingMutex);
+    pending.Append(retired.Data(), retired.Length());
+    pendingCount.Store(pending.Length(), MemoryOrder::Release);
+    retired.Resize(0);
+}
+
+/**
+ * @brief Removes the objects for which IsSafe holds from Retired and frees them. Deleters may retire further objects,
+ * so they run only after Retired is consistent again.
+ */
+template <typename PredicateT> void FreeRetired(Containers::List<RetiredObject>& Retired, const PredicateT& IsSafe) {
+    Containers::List<RetiredObject> batch;
+    int32_t kept = 0;
+    for (int32_t i = 0; i < Retired.Length(); ++i) {
+        if (IsSafe(Retired[i])) {
+            batch.Add(Retired[i]);
+        } else {
+            Retired[kept++] = Retired[i];
+        }
+    }
+    Retired.Resize(kept);
+    for (int32_t i = 0; i < batch.Length(); ++i) {
+        batch[i].Deleter(batch[i].Ptr);
+    }
+}
+
+void FreeRetiredBefore(Containers::List<RetiredObject>& Retired, const int64_t Epoch) {
+    // Every reader that could still see an object retired in epoch e announced e or e - 1, both are gone at e + 2.
+    FreeRetired(Retired, [Epoch](const RetiredObject& object) { return object.Epoch + 2 <= Epoch; });
+}
+
+void FreeUnprotected(Containers::List<RetiredObject>& Retired, HazardRecord* Records) {
+    Containers::List<void*> hazards;
+    for (HazardRecord* record = Records; record != nullptr; record = record->Next) {
+        if (void* ptr = record->Pointer.Load(MemoryOrder::SequentiallyConsistent); ptr != nullptr) {
+            hazards.Add(ptr);
+        }
+    }
+    std::sort(hazards.Data(), hazards.Data() + hazards.Length());
+    FreeRetired(Retired, [&hazards](const RetiredObject& object) {
+        return !std::binary_search(hazards.Data(), hazards.Data() + hazards.Length(), object.Ptr);
+    });
+}
+
+void FreeAll(Containers::List<RetiredObject>& Retired) {
+    FreeRetired(Retired, [](const RetiredObject&) { return true; });
+}
+} // namespace
+
+struct ReclamationThreadState {
+    ReclamationThreadState();
+    struct EpochEntry {
+        const EpochDomain* Domain;
+        EpochDomainState* State;
+        EpochThreadRecord* Record;
+    };
+    struct HazardEntry {
+        const HazardPointerDomain* Domain;
+        HazardDomainState* State;
+        HazardThreadData* Data;
+    };
+    Containers::List<EpochEntry> Epochs;
+    Containers::List<HazardEntry> Hazards;
+
+    ~ReclamationThreadState() {
+        for (int32_t i = 0; i < Epochs.Length(); ++i) {
+            ReleaseEpochRecord(Epochs[i]);
+        }
+        for (int32_t i = 0; i < Hazards.Length(); ++i) {
+            ReleaseHazardData(Hazards[i]);
+        }
+        Epochs.Resize(0);
+        Hazards.Resize(0);
+        ThreadStateAlive = false;
+    }
+
+    // The objects the exiting thread could not free yet are left to the domain's reclaimer.
+    static void ReleaseEpochRecord(const EpochEntry& entry) {
+        EpochThreadRecord* record = entry.Record;
+        HandOver(entry.State->PendingMutex, entry.State->Pending, entry.State->PendingCount, record->Retired);
+        record->Nesting = 0;
+        record->State.Store(0, MemoryOrder::Release);
+        record->InUse.Store(0, MemoryOrder::Release);
+    }
+    static void ReleaseHazardData(const HazardEntry& entry) {
+        HazardThreadData* data = entry.Data;
+        HandOver(entry.State->PendingMutex, entry.State->Pending, entry.State->PendingCount, data->Retired);
+        for (int32_t i = 0; i < data->FreeRecords.Length(); ++i) {
+            data->FreeRecords[i]->InUse.Store(0, MemoryOrder::Release);
+        }
+        delete data;
+    }
+
+    EpochThreadRecord* FindEpochRecord(const EpochDomain* domain) {
+        for (int32_t i = 0; i < Epochs.Length(); ++i) {
+            if (Epochs[i].Domain == domain) {
+                return Epochs[i].Record;
+            }
+        }
+        return nullptr;
+    }
+    HazardThreadData* FindHazardData(const HazardPointerDomain* domain) {
+        for (int32_t i = 0; i < Hazards.Length(); ++i) {
+            if (Hazards[i].Domain == domain) {
+                return Hazards[i].Data;
+            }
+        }
+        return nullptr;
+    }
+};
+
+namespace {
+thread_local ReclamationThreadState ThreadState;
+
+} // namespace
+
+ReclamationThreadState::ReclamationThreadState() { ThreadStateAlive = true; }
+
+namespace {
+EpochThreadRecord* AcquireEpochRecord(EpochDomainState* state) {
+    for (EpochThreadRecord* record = state->Records.Load(MemoryOrder::Acquire); record != nullptr;
+         record = record->Next) {
+        int32_t expected = 0;
+        if (record->InUse.Load(MemoryOrder::Relaxed) == 0 &&
+            record->InUse.CompareExchange(expected, 1, MemoryOrder::Acquire)) {
+            return record;
+        }
+    }
+    EpochThreadRecord* record = new EpochThreadRecord();
+    EpochThreadRecord* head = state->Records.Load(MemoryOrder::Relaxed);
+    do {
+        record->Next = head;
+    } while (!state->Records.CompareExchange(head, record, MemoryOrder::Release));
+    return record;
+}
+
+EpochThreadRecord* GetEpochRecord(const EpochDomain* domain, EpochDomainState* state) {
+    if (EpochThreadRecord* record = ThreadState.FindEpochRecord(domain)) {
+        return record;
+    }
+    EpochThreadRecord* record = AcquireEpochRecord(state);
+    ThreadState.Epochs.Add({domain, state, record});
+    return record;
+}
+
+HazardThreadData* GetHazardData(const HazardPointerDomain* domain, HazardDomainState* state) {
+    if (HazardThreadData* data = ThreadState.FindHazardData(domain)) {
+        return data;
+    }
+    HazardThreadData* data = new HazardThreadData();
+    ThreadState.Hazards.Add({domain, state, data});
+    return data;
+}
+} // namespace
+} // namespace _z__Private
+
+EpochDomain::EpochDomain() : globalEpoch(1), state(new _z__Private::EpochDomainState()) {}
+
+EpochDomain::~EpochDomain() {
+    for (int32_t i = 0; _z__Private::ThreadStateAlive && i < _z__Private::ThreadState.Epochs.Length(); ++i) {
+        if (_z__Private::ThreadState.Epochs[i].Domain == this) {
+            _z__Private::ThreadState.Epochs.RemoveAt(i);
+            break;
+        }
+    }
+    _z__Private::EpochThreadRecord* record = state->Records.Load(MemoryOrder::Acquire);
+    while (record != nullptr) {
+        _z__Private::EpochThreadRecord* next = record->Next;
+        _z__Private::FreeAll(record->Retired);
+        delete record;
+        record = next;
+    }
+    _z__Private::FreeAll(state->Pending);
+    delete state;
+}
+
+EpochDomain& EpochDomain::Global() {
+    static EpochDomain domain;
+    return domain;
+}
+
+void EpochDomain::Enter() {
+    _z__Private::EpochThreadRecord* record = _z__Private::GetEpochRecord(this, state);
+    if (record->Nesting++ == 0) {
+        // Sequentially consistent so the announcement is visible before any read of the protected data.
+        record->State.Store((globalEpoch.Load(MemoryOrder::Relaxed) << 1) | 1, MemoryOrder::SequentiallyConsistent);
+    }
+}
+
+void EpochDomain::Leave() {
+    _z__Private::EpochThreadRecord* record = _z__Private::ThreadState.FindEpochRecord(this);
+    if (--record->Nesting == 0) {
+        record->State.Store(0, MemoryOrder::Release);
+    }
+}
+
+void EpochDomain::Retire(void* Ptr, const RetireDeleterType Deleter) {
+    _z__Private::EpochThreadRecord* record = _z__Private::GetEpochRecord(this, state);
+    record->Retired.Add({Ptr, Deleter, globalEpoch.Load(MemoryOrder::SequentiallyConsistent)});
+    if (record->Retired.Length() < _z__Private::RetireBatchSize) {
+        return;
+    }
+    TryAdvance();
+    _z__Private::FreeRetiredBefore(record->Retired, globalEpoch.Load(MemoryOrder::Acquire));
+    if (record->Retired.Length() >= _z__Private::RetireBatchSize) {
+        // A reader is stalled, leave the batch to the reclaimer instead of rescanning on every retire.
+        _z__Private::HandOver(state->PendingMutex, state->Pending, state->PendingCount, record->Retired);
+    }
+}
+
+bool EpochDomain::TryAdvance() {
+    int64_t epoch = globalEpoch.Load(MemoryOrder::SequentiallyConsistent);
+    for (const _z__Private::EpochThreadRecord* record = state->Records.Load(MemoryOrder::Acquire); record != nullptr;
+         record = record->Next) {
+        const int64_t recordState = record->State.Load(MemoryOrder::SequentiallyConsistent);
+        if ((recordState & 1) != 0 && (recordState >> 1) != epoch) {
+            return false;
+        }
+    }
+    // Failing means another thread advanced it.
+    globalEpoch.CompareExchange(epoch, epoch + 1, MemoryOrder::AcquireAndRelease);
+    return true;
+}
+
+void EpochDomain::Reclaim() {
+    // Objects retired in the current epoch need two advances.
+    if (TryAdvance()) {
+        TryAdvance();
+    }
+    const int64_t epoch = globalEpoch.Load(MemoryOrder::Acquire);
+    if (_z__Private::EpochThreadRecord* record = _z__Private::ThreadState.FindEpochRecord(this)) {
+        _z__Private::FreeRetiredBefore(record->Retired, epoch);
+    }
+    if (state->PendingCount.Load(MemoryOrder::Acquire) == 0) {
+        return;
+    }
+    Containers::List<_z__Private::RetiredObject> pending;
+    {
+        Threading::ScopedLock lock(state->PendingMutex);
+        pending.Append(state->Pending.Data(), state->Pending.Length());
+        state->Pending.Resize(0);
+        state->PendingCount.Store(0, MemoryOrder::Release);
+    }
+    _z__Private::FreeRetiredBefore(pending, epoch);
+    _z__Private::HandOver(state->PendingMutex, state->Pending, state->PendingCount, pending);
+}
+
+void EpochDomain::Synchronize() {
+    // A reader that entered before the call announced at most the current epoch, the second advance waits for it.
+    const int64_t target = globalEpoch.Load(MemoryOrder::SequentiallyConsistent) + 2;
+    while (globalEpoch.Load(MemoryOrder::Acquire) < target) {
+        if (!TryAdvance()) {
+            Platform::IThreadImplementation::GetCurrentThread().Yield();
+        }
+    }
+}
+
+HazardPointerDomain::HazardPointerDomain()
+    : records(nullptr), recordCount(0), state(new _z__Private::HazardDomainState()) {}
+
+HazardPointerDomain::~HazardPointerDomain() {
+    for (int32_t i = 0; _z__Private::ThreadStateAlive && i < _z__Private::ThreadState.Hazards.Length(); ++i) {
+        if (_z__Private::ThreadState.Hazards[i].Domain == this) {
+            _z__Private::HazardThreadData* data = _z__Private::ThreadState.Hazards.RemoveAt(i).Data;
+            _z__Private::FreeAll(data->Retired);
+            delete data;
+            break;
+        }
+    }
+    _z__Private::HazardRecord* record = records.Load(MemoryOrder::Acquire);
+    while (record != nullptr) {
+        _z__Private::HazardRecord* next = record->Next;
+        delete record;
+        record = next;
+    }
+    _z__Private::FreeAll(state->Pending);
+    delete state;
+}
+
+HazardPointerDomain& HazardPointerDomain::Global() {
+    static HazardPointerDomain domain;
+    return domain;
+}
+
+void HazardPointerDomain::Retire(void* Ptr, const RetireDeleterType Deleter) {
+    _z__Private::HazardThreadData* data = _z__Private::GetHazardData(this, state);
+    data->Retired.Add({Ptr, Deleter, 0});
+    // Scanning costs a pass over all records, so let the list grow with their number.
+    const int32_t threshold = std::max(_z__Private::RetireBatchSize, 2 * recordCount.Load(MemoryOrder::Relaxed));
+    if (data->Retired.Length() >= threshold) {
+        _z__Private::FreeUnprotected(data->Retired, records.Load(MemoryOrder::Acquire));
+    }
+}
+
+void HazardPointerDomain::Reclaim() {
+    if (_z__Private::HazardThreadData* data = _z__Private::ThreadState.FindHazardData(this)) {
+        _z__Private::FreeUnprotected(data->Retired, records.Load(MemoryOrder::Acquire));
+    }
+    if (state->PendingCount.Load(MemoryOrder::Acquire) == 0) {
+        return;
+    }
+    Containers::List<_z__Private::RetiredObject> pending;
+    {
+        Threading::ScopedLock lock(state->PendingMutex);
+        pending.Append(state->Pending.Data(), state->Pending.Length());
+        state->Pending.Resize(0);
+        state->PendingCount.Store(0, MemoryOrder::Release);
+    }
+    _z__Private::FreeUnprotected(pending, records.Load(MemoryOrder::Acquire));
+    _z__Private::HandOver(state->PendingMutex, state->Pending, state->PendingCount, pending);
+}
+
+_z__Private::HazardRecord* HazardPointerDomain::AcquireRecord() {
+    _z__Private::HazardThreadData* data = _z__Private::GetHazardData(this, state);
+    if (data->FreeRecords.Length() > 0) {
+        _z__Private::HazardRecord* record = data->FreeRecords[data->FreeRecords.Length() - 1];
+        data->FreeRecords.Resize(data->FreeRecords.Length() - 1);
+        return record;
+    }
+    for (_z__Private::HazardRecord* record = records.Load(MemoryOrder::Acquire); record != nullptr;
+         record = record->Next) {
+        int32_t expected = 0;
+        if (record->InUse.Load(MemoryOrder::Relaxed) == 0 &&
+            record->InUse.CompareExchange(expected, 1, MemoryOrder::Acquire)) {
+            return record;
+        }
+    }
+    _z__Private::HazardRecord* record = new _z__Private::HazardRecord();
+    record->InUse.Store(1, MemoryOrder::Relaxed);
+    _z__Private::HazardRecord* head = records.Load(MemoryOrder::Relaxed);
+    do {
+        record->Next = head;
+    } while (!records.CompareExchange(head, record, MemoryOrder::Release));
+    recordCount.FetchAdd(1, MemoryOrder::Relaxed);
+    return record;
+}
+
+void HazardPointerDomain::ReleaseRecord(_z__Private::HazardRecord* Record) {
+    Record->Pointer.Store(nullptr, MemoryOrder::Release);
+    // Kept by the thread, the next hazard pointer it creates takes it without touching shared state.
+    _z__Private::GetHazardData(this, state)->FreeRecords.Add(Record);
+}
+
+HazardPointer::HazardPointer(HazardPointerDomain& InDomain) : domain(InDomain), record(InDomain.AcquireRecord()) {}
+
+HazardPointer::~HazardPointer() { domain.ReleaseRecord(record); }
+} // namespace Edvar::Memory
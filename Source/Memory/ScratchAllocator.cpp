@@ -0,0 +1,43 @@
+#include "Memory/ScratchAllocator.hpp"
+
+namespace Edvar::Memory {
+ScratchAllocator& ScratchAllocator::Get() {
+    thread_local ScratchAllocator allocator;
+    return allocator;
+}
+
+ScratchAllocator::~ScratchAllocator() {
+    Block* block = first;
+    while (block != nullptr) {
+        Block* next = block->Next;
+        GetGlobalMemoryAllocator().Free(block, alignof(Block));
+        block = next;
+    }
+    first = nullptr;
+    current = nullptr;
+    offset = 0;
+}
+
+void* ScratchAllocator::AllocateSlow(const uint64_t Size, const uint64_t Alignment) {
+    // Worst case padding to reach the alignment within a fresh block.
+    const uint64_t required = Size + (Alignment > alignof(Block) ? Alignment : 0);
+    Block* next = current != nullptr ? current->Next : first;
+    if (next == nullptr || next->Size < required) {
+        // Chained in front of the too small block, which stays around for later rewinds.
+        const uint64_t blockSize = required > DefaultBlockSize ? required : DefaultBlockSize;
+        auto* block =
+            static_cast<Block*>(GetGlobalMemoryAllocator().Allocate(sizeof(Block) + blockSize, alignof(Block)));
+        block->Next = next;
+        block->Size = blockSize;
+        if (current != nullptr) {
+            current->Next = block;
+        } else {
+            first = block;
+        }
+        next = block;
+    }
+    current = next;
+    offset = 0;
+    return Allocate(Size, Alignment);
+}
+} // namespace Edvar::Memory
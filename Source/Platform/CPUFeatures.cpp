@@ -0,0 +1,159 @@
+#include "Platform/CPUFeatures.hpp"
+
+#if defined(_M_AMD64) || defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#    define EDVAR_CPP_CORE_CPU_X86 1
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#    define EDVAR_CPP_CORE_CPU_ARM64 1
+#    if defined(_WIN32)
+#        define WIN32_LEAN_AND_MEAN
+#        include <windows.h>
+#    elif defined(__linux__)
+#        include <sys/auxv.h>
+#    endif
+#endif
+
+namespace Edvar::Platform {
+namespace {
+#if defined(EDVAR_CPP_CORE_CPU_X86)
+struct CPUIDResult {
+    uint32_t EAX, EBX, ECX, EDX;
+};
+
+CPUIDResult QueryCPUID(const uint32_t Leaf, const uint32_t SubLeaf) {
+    CPUIDResult result{};
+#    if defined(_MSC_VER)
+    int registers[4];
+    __cpuidex(registers, static_cast<int>(Leaf), static_cast<int>(SubLeaf));
+    result = {static_cast<uint32_t>(registers[0]), static_cast<uint32_t>(registers[1]),
+              static_cast<uint32_t>(registers[2]), static_cast<uint32_t>(registers[3])};
+#    else
+    __cpuid_count(Leaf, SubLeaf, result.EAX, result.EBX, result.ECX, result.EDX);
+#    endif
+    return result;
+}
+
+// Register state the operating system saves on context switches, only valid when OSXSAVE is set.
+uint64_t QueryEnabledRegisterState() {
+#    if defined(_MSC_VER)
+    return _xgetbv(0);
+#    else
+    // Inline assembly because the _xgetbv intrinsic requires building with -mxsave.
+    uint32_t low, high;
+    __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    return (static_cast<uint64_t>(high) << 32) | low;
+#    endif
+}
+
+CPUFeature DetectCPUFeatures() {
+    CPUFeature features = CPUFeature::None;
+    const uint32_t maxLeaf = QueryCPUID(0, 0).EAX;
+    if (maxLeaf < 1) {
+        return features;
+    }
+
+    const CPUIDResult leaf1 = QueryCPUID(1, 0);
+    const auto hasBit = [](const uint32_t Register, const int32_t Bit) { return (Register & (1u << Bit)) != 0; };
+    if (hasBit(leaf1.EDX, 26)) {
+        features |= CPUFeature::SSE2;
+    }
+    if (hasBit(leaf1.ECX, 0)) {
+        features |= CPUFeature::SSE3;
+    }
+    if (hasBit(leaf1.ECX, 9)) {
+        features |= CPUFeature::SSSE3;
+    }
+    if (hasBit(leaf1.ECX, 19)) {
+        features |= CPUFeature::SSE41;
+    }
+    if (hasBit(leaf1.ECX, 20)) {
+        features |= CPUFeature::SSE42;
+    }
+    if (hasBit(leaf1.ECX, 23)) {
+        features |= CPUFeature::POPCNT;
+    }
+
+    // XMM and YMM state, then opmask and both halves of the upper ZMM state.
+    constexpr uint64_t AVXState = 0x6;
+    constexpr uint64_t AVX512State = 0xE6;
+    const uint64_t enabledState = hasBit(leaf1.ECX, 27) ? QueryEnabledRegisterState() : 0;
+    const bool hasAVXState = (enabledState & AVXState) == AVXState;
+    const bool hasAVX512State = (enabledState & AVX512State) == AVX512State;
+    if (hasAVXState && hasBit(leaf1.ECX, 28)) {
+        features |= CPUFeature::AVX;
+        if (hasBit(leaf1.ECX, 12)) {
+            features |= CPUFeature::FMA;
+        }
+        if (hasBit(leaf1.ECX, 29)) {
+            features |= CPUFeature::F16C;
+        }
+    }
+
+    if (maxLeaf >= 7) {
+        const CPUIDResult leaf7 = QueryCPUID(7, 0);
+        if (hasBit(leaf7.EBX, 3)) {
+            features |= CPUFeature::BMI1;
+        }
+        if (hasBit(leaf7.EBX, 8)) {
+            features |= CPUFeature::BMI2;
+        }
+        if ((features & CPUFeature::AVX) != CPUFeature::None && hasBit(leaf7.EBX, 5)) {
+            features |= CPUFeature::AVX2;
+        }
+        if (hasAVX512State && hasBit(leaf7.EBX, 16)) {
+            features |= CPUFeature::AVX512F;
+            if (hasBit(leaf7.EBX, 17)) {
+                features |= CPUFeature::AVX512DQ;
+            }
+            if (hasBit(leaf7.EBX, 30)) {
+                features |= CPUFeature::AVX512BW;
+            }
+            if (hasBit(leaf7.EBX, 31)) {
+                features |= CPUFeature::AVX512VL;
+            }
+        }
+    }
+    return features;
+}
+#elif defined(EDVAR_CPP_CORE_CPU_ARM64)
+CPUFeature DetectCPUFeatures() {
+    // Advanced SIMD is mandatory on AArch64.
+    CPUFeature features = CPUFeature::NEON;
+#    if defined(_WIN32)
+    if (IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE)) {
+        features |= CPUFeature::ARMCRC32;
+    }
+#        ifdef PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE
+    if (IsProcessorFeaturePresent(PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE)) {
+        features |= CPUFeature::ARMDotProduct;
+    }
+#        endif
+#    elif defined(__linux__)
+    // Bit positions from the kernel's asm/hwcap.h, which is not available in every sysroot.
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    if ((hwcap & (1ul << 7)) != 0) {
+        features |= CPUFeature::ARMCRC32;
+    }
+    if ((hwcap & (1ul << 20)) != 0) {
+        features |= CPUFeature::ARMDotProduct;
+    }
+    if ((hwcap & (1ul << 22)) != 0) {
+        features |= CPUFeature::SVE;
+    }
+#    endif
+    return features;
+}
+#else
+CPUFeature DetectCPUFeatures() { return CPUFeature::None; }
+#endif
+} // namespace
+
+CPUFeature GetCPUFeatures() {
+    static const CPUFeature features = DetectCPUFeatures();
+    return features;
+}
+} // namespace Edvar::Platform
@@ -1,6 +1,14 @@
 #include "Platform/IPlatformWindowing.hpp"
 #include "Windowing/Window.hpp"
 namespace Edvar::Platform {
+namespace {
+// Starts at 1, 0 marks platform events without a window.
+Memory::Atomic<uint64_t> GNextWindowId(1);
+} // namespace
+
+IWindowImplementation::IWindowImplementation()
+    : WindowId(GNextWindowId.FetchAdd(1, Memory::MemoryOrder::Relaxed)) {}
+
 void IWindowImplementation::HandleClose(int32_t priorityLevel) {
     if (OwnerWrapper) [[likely]] {
         // Call the wrapper's OnClose method.
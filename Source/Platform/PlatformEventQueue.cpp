@@ -0,0 +1,229 @@
+#include "Platform/PlatformEventQueue.hpp"
+#include <bit>
+
+namespace Edvar::Platform {
+namespace {
+// Index of the pending flag of a window state event type, -1 for any other type. Drain emits the states in this
+// order, close last so the handler sees the final size and position of the window it closes.
+int32_t GetWindowStateIndex(const PlatformEventType Type) {
+    switch (Type) {
+    case PlatformEventType::WindowMoved:
+        return 0;
+    case PlatformEventType::WindowResized:
+        return 1;
+    case PlatformEventType::WindowDPIChanged:
+        return 2;
+    case PlatformEventType::WindowFocusChanged:
+        return 3;
+    case PlatformEventType::WindowClose:
+        return 4;
+    default:
+        return -1;
+    }
+}
+
+constexpr PlatformEventType WindowStateTypes[] = {PlatformEventType::WindowMoved, PlatformEventType::WindowResized,
+                                                  PlatformEventType::WindowDPIChanged,
+                                                  PlatformEventType::WindowFocusChanged, PlatformEventType::WindowClose};
+
+uint64_t PackVector(const Math::Vector2<int32_t>& Vector) {
+    return static_cast<uint64_t>(static_cast<uint32_t>(Vector.X)) |
+           (static_cast<uint64_t>(static_cast<uint32_t>(Vector.Y)) << 32);
+}
+
+Math::Vector2<int32_t> UnpackVector(const uint64_t Packed) {
+    return Math::Vector2<int32_t>(static_cast<int32_t>(static_cast<uint32_t>(Packed)),
+                                  static_cast<int32_t>(static_cast<uint32_t>(Packed >> 32)));
+}
+} // namespace
+
+PlatformEventQueue::PlatformEventQueue(const int32_t Capacity)
+    : enqueuePosition(0), dequeuePosition(0), droppedCount(0) {
+    if (Capacity <= 0 || (Capacity & (Capacity - 1)) != 0) {
+        Platform::GetPlatform().OnFatalError(u"PlatformEventQueue: Capacity must be a power of two.");
+    }
+    cells = new Cell[Capacity];
+    mask = static_cast<uint32_t>(Capacity - 1);
+    for (int32_t i = 0; i < Capacity; ++i) {
+        cells[i].Sequence.Store(static_cast<uint32_t>(i), Memory::MemoryOrder::Relaxed);
+    }
+}
+
+PlatformEventQueue::~PlatformEventQueue() { delete[] cells; }
+
+bool PlatformEventQueue::Record(const PlatformEvent& Event) {
+    if (RecordWindowState(Event)) {
+        return true;
+    }
+    uint32_t position = enqueuePosition.Load(Memory::MemoryOrder::Relaxed);
+    while (true) {
+        Cell& cell = cells[position & mask];
+        const uint32_t sequence = cell.Sequence.Load(Memory::MemoryOrder::Acquire);
+        // Positions wrap around, the signed difference stays correct.
+        const int32_t difference = static_cast<int32_t>(sequence - position);
+        if (difference == 0) {
+            // Free cell, claim it. On failure position receives the current enqueue position.
+            if (enqueuePosition.CompareExchange(position, position + 1, Memory::MemoryOrder::Relaxed)) {
+                cell.Event = Event;
+                cell.Sequence.Store(position + 1, Memory::MemoryOrder::Release);
+                return true;
+            }
+        } else if (difference < 0) {
+            // The consumer has not freed this cell since the previous lap, the ring is full.
+            droppedCount.FetchAdd(1, Memory::MemoryOrder::Relaxed);
+            return false;
+        } else {
+            // Another producer claimed the cell first.
+            position = enqueuePosition.Load(Memory::MemoryOrder::Relaxed);
+        }
+    }
+}
+
+int32_t PlatformEventQueue::Drain(const Utils::FunctionRef<void(const PlatformEvent&)> Handler) {
+    // Stop at the events recorded so far, a busy pump can not keep the consumer draining forever.
+    const uint32_t end = enqueuePosition.Load(Memory::MemoryOrder::Acquire);
+    PlatformEvent pending;
+    bool hasPending = false;
+    int32_t handledCount = 0;
+    while (dequeuePosition != end) {
+        Cell& cell = cells[dequeuePosition & mask];
+        if (cell.Sequence.Load(Memory::MemoryOrder::Acquire) != dequeuePosition + 1) {
+            // Claimed but still being written, it and everything after it wait for the next drain.
+            break;
+        }
+        const PlatformEvent event = cell.Event;
+        // Hands the cell back to the producers for the next lap.
+        cell.Sequence.Store(dequeuePosition + mask + 1, Memory::MemoryOrder::Release);
+        ++dequeuePosition;
+
+        if (hasPending && TryCoalesce(pending, event)) {
+            continue;
+        }
+        if (hasPending) {
+            Handler(pending);
+            ++handledCount;
+        }
+        pending = event;
+        hasPending = true;
+    }
+    if (hasPending) {
+        Handler(pending);
+        ++handledCount;
+    }
+    return handledCount + DrainWindowStates(Handler);
+}
+
+void PlatformEventQueue::ForgetWindow(const uint64_t WindowId) {
+    for (WindowStateSlot& slot : windowSlots) {
+        if (slot.WindowId.Load(Memory::MemoryOrder::Acquire) != WindowId) {
+            continue;
+        }
+        for (Memory::Atomic<uint8_t>& pending : slot.Pending) {
+            pending.Store(0, Memory::MemoryOrder::Relaxed);
+        }
+        slot.WindowId.Store(0, Memory::MemoryOrder::Release);
+    }
+}
+
+bool PlatformEventQueue::RecordWindowState(const PlatformEvent& Event) {
+    const int32_t stateIndex = GetWindowStateIndex(Event.Type);
+    if (stateIndex < 0 || Event.WindowId == 0) {
+        return false;
+    }
+    WindowStateSlot* slot = nullptr;
+    for (WindowStateSlot& candidate : windowSlots) {
+        if (candidate.WindowId.Load(Memory::MemoryOrder::Acquire) == Event.WindowId) {
+            slot = &candidate;
+            break;
+        }
+    }
+    for (int32_t i = 0; slot == nullptr && i < MaxWindowStateSlots; ++i) {
+        uint64_t expected = 0;
+        if (windowSlots[i].WindowId.CompareExchange(expected, Event.WindowId, Memory::MemoryOrder::AcquireAndRelease) ||
+            expected == Event.WindowId) {
+            slot = &windowSlots[i];
+        }
+    }
+    if (slot == nullptr) {
+        return false;
+    }
+
+    switch (Event.Type) {
+    case PlatformEventType::WindowMoved:
+        slot->Position.Store(PackVector(Event.Position), Memory::MemoryOrder::Relaxed);
+        break;
+    case PlatformEventType::WindowResized:
+        slot->Size.Store(PackVector(Event.Size), Memory::MemoryOrder::Relaxed);
+        break;
+    case PlatformEventType::WindowDPIChanged:
+        slot->DPIScaleBits.Store(std::bit_cast<uint32_t>(Event.Value), Memory::MemoryOrder::Relaxed);
+        break;
+    case PlatformEventType::WindowFocusChanged:
+        slot->Focused.Store(Event.Focused ? 1 : 0, Memory::MemoryOrder::Relaxed);
+        break;
+    default:
+        break;
+    }
+    // Publishes the value stored above to the consumer taking the flag.
+    slot->Pending[stateIndex].Store(1, Memory::MemoryOrder::Release);
+    return true;
+}
+
+int32_t PlatformEventQueue::DrainWindowStates(const Utils::FunctionRef<void(const PlatformEvent&)> Handler) {
+    int32_t handledCount = 0;
+    for (WindowStateSlot& slot : windowSlots) {
+        const uint64_t windowId = slot.WindowId.Load(Memory::MemoryOrder::Acquire);
+        if (windowId == 0) {
+            continue;
+        }
+        bool taken[WindowStateTypeCount] = {};
+        bool anyTaken = false;
+        for (int32_t i = 0; i < WindowStateTypeCount; ++i) {
+            taken[i] = slot.Pending[i].Exchange(0, Memory::MemoryOrder::Acquire) != 0;
+            anyTaken |= taken[i];
+        }
+        // The window was forgotten and its slot possibly claimed by another one meanwhile, the flags can not be
+        // attributed to either. A window recording again raises its flags again.
+        if (!anyTaken || slot.WindowId.Load(Memory::MemoryOrder::Acquire) != windowId) {
+            continue;
+        }
+        for (int32_t i = 0; i < WindowStateTypeCount; ++i) {
+            if (!taken[i]) {
+                continue;
+            }
+            PlatformEvent event(WindowStateTypes[i], windowId);
+            event.Position = UnpackVector(slot.Position.Load(Memory::MemoryOrder::Relaxed));
+            event.Size = UnpackVector(slot.Size.Load(Memory::MemoryOrder::Relaxed));
+            event.Value = std::bit_cast<float>(slot.DPIScaleBits.Load(Memory::MemoryOrder::Relaxed));
+            event.Focused = slot.Focused.Load(Memory::MemoryOrder::Relaxed) != 0;
+            Handler(event);
+            ++handledCount;
+        }
+    }
+    return handledCount;
+}
+
+bool PlatformEventQueue::TryCoalesce(PlatformEvent& Pending, const PlatformEvent& Next) {
+    if (Pending.Type != Next.Type || Pending.WindowId != Next.WindowId || Pending.Device != Next.Device) {
+        return false;
+    }
+    switch (Next.Type) {
+    case PlatformEventType::MouseMove:
+        Pending.Position = Next.Position;
+        Pending.Delta += Next.Delta;
+        return true;
+    case PlatformEventType::MouseWheel:
+        Pending.Position = Next.Position;
+        Pending.Value += Next.Value;
+        return true;
+    case PlatformEventType::WindowResized:
+    case PlatformEventType::WindowMoved:
+    case PlatformEventType::WindowDPIChanged:
+        // Only the final state matters.
+        Pending = Next;
+        return true;
+    default:
+        return false;
+    }
+}
+} // namespace Edvar::Platform
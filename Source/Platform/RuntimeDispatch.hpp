@@ -0,0 +1,59 @@
+#pragma once
+#include "Platform/CPUFeatures.hpp"
+
+// Runtime instruction set dispatch for translation units built for the baseline target.
+//
+// A user builds its kernels once per instruction set, each build in a namespace named after it: AVX2 when
+// EDVAR_CPP_CORE_DISPATCH_AVX2 is set, then exactly one of SSE2, NEON or Scalar as named by
+// EDVAR_CPP_CORE_DISPATCH_BASELINE. SSE2 is part of x86-64 and Advanced SIMD is mandatory on AArch64, so the baseline
+// build needs no target attributes and serves every machine of its architecture. Inside each namespace
+// EDVAR_CPP_CORE_DISPATCH_TARGET must hold the function attributes of that instruction set, e.g.
+// EDVAR_CPP_CORE_TARGET_AVX2, while the shared kernels are included.
+//
+// EDVAR_CPP_CORE_DEFINE_KERNEL_DISPATCH(TableType, MakeTable) then defines GetKernels(), returning the TableType that
+// MakeTable(Namespace) builds for the best build the running machine supports.
+
+#ifndef EDVAR_CPP_CORE_MATH_ALLOW_SIMD
+#    define EDVAR_CPP_CORE_MATH_ALLOW_SIMD 1
+#endif
+
+#ifndef EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX
+#    define EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX 1
+#endif
+
+#if EDVAR_CPP_CORE_MATH_ALLOW_SIMD && (defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64) ||                    \
+                                       (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define EDVAR_CPP_CORE_DISPATCH_X86 1
+#    define EDVAR_CPP_CORE_DISPATCH_ARM64 0
+#    define EDVAR_CPP_CORE_DISPATCH_BASELINE SSE2
+#    include <immintrin.h>
+#elif EDVAR_CPP_CORE_MATH_ALLOW_SIMD && (defined(_M_ARM64) || defined(__aarch64__))
+#    define EDVAR_CPP_CORE_DISPATCH_X86 0
+#    define EDVAR_CPP_CORE_DISPATCH_ARM64 1
+#    define EDVAR_CPP_CORE_DISPATCH_BASELINE NEON
+#    include <arm_neon.h>
+#else
+#    define EDVAR_CPP_CORE_DISPATCH_X86 0
+#    define EDVAR_CPP_CORE_DISPATCH_ARM64 0
+#    define EDVAR_CPP_CORE_DISPATCH_BASELINE Scalar
+#endif
+
+#if EDVAR_CPP_CORE_DISPATCH_X86 && EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX
+#    define EDVAR_CPP_CORE_DISPATCH_AVX2 1
+#    define EDVAR_CPP_CORE_DISPATCH_IF_AVX2(...) __VA_ARGS__
+#else
+#    define EDVAR_CPP_CORE_DISPATCH_AVX2 0
+#    define EDVAR_CPP_CORE_DISPATCH_IF_AVX2(...)
+#endif
+
+// The table is resolved on first use rather than by a global initializer, other globals may already call the kernels
+// while being constructed.
+#define EDVAR_CPP_CORE_DEFINE_KERNEL_DISPATCH(TableType, MakeTable)                                                    \
+    TableType SelectKernels() {                                                                                        \
+        EDVAR_CPP_CORE_DISPATCH_IF_AVX2(if (::Edvar::Platform::HasTargetAVX2Features()) { return MakeTable(AVX2); })   \
+        return MakeTable(EDVAR_CPP_CORE_DISPATCH_BASELINE);                                                            \
+    }                                                                                                                  \
+    EDVAR_CPP_CORE_FORCE_INLINE const TableType& GetKernels() {                                                        \
+        static const TableType kernels = SelectKernels();                                                              \
+        return kernels;                                                                                                \
+    }
@@ -132,9 +132,9 @@ void WindowsMouseDevice::ProcessButtonMessage(IWindowImplementation* window, con
     }
 }
 
-void WindowsMouseDevice::ProcessMoveMessage(IWindowImplementation* window, const Math::Vector2<int32_t>& position) {
-    Delta.X = position.X - Position.X;
-    Delta.Y = position.Y - Position.Y;
+void WindowsMouseDevice::ProcessMoveMessage(IWindowImplementation* window, const Math::Vector2<int32_t>& position,
+                                            const Math::Vector2<int32_t>& delta) {
+    Delta = delta;
     Position = position;
 
     // Fire device event
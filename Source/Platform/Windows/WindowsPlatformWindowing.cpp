@@ -11,12 +11,31 @@
 namespace Edvar::Platform::Windows {
 
 // Global map to store window instances for message routing
-static Containers::List<WindowsWindow*> GWindowInstances;
-static Threading::Mutex GWindowInstancesMutex;
+static Memory::Published<Containers::List<WindowsWindow*>> GWindowInstances;
 
 // Forward declarations
 static LRESULT CALLBACK GlobalWindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
+static void RecordEvent(const PlatformEvent& event) {
+    Platform::GetPlatform().GetWindowing().GetEventQueue().Record(event);
+}
+
+// Queued events may outlive their window, only dispatch to windows still alive. Looked up by id, a window created
+// meanwhile may reuse the address of the destroyed one. DestroyWindow retires windows to the global epoch domain, the
+// result stays valid as long as the caller's epoch critical section.
+static IWindowImplementation* FindLiveWindow(const uint64_t windowId) {
+    if (windowId == 0) {
+        return nullptr;
+    }
+    const auto windows = GWindowInstances.Read();
+    for (int32_t i = 0; i < windows->Length(); ++i) {
+        if (windows->Get(i)->GetWindowId() == windowId) {
+            return windows->Get(i);
+        }
+    }
+    return nullptr;
+}
+
 // ============================================================================
 // WindowsPlatformWindowing Implementation
 // ============================================================================
@@ -154,10 +173,7 @@ IWindowImplementation& WindowsPlatformWindowing::CreateWindow(const Windowing::W
     auto* window = new WindowsWindow(hwnd, descriptor);
 
     // Store in global map
-    {
-        Threading::ScopedLock lock(GWindowInstancesMutex);
-        GWindowInstances.Push(window);
-    }
+    GWindowInstances.Update([window](Containers::List<WindowsWindow*>& windows) { windows.Push(window); });
 
     // Store pointer in window user data for message routing
     if (hwnd) {
@@ -171,20 +187,30 @@ void WindowsPlatformWindowing::DestroyWindow(IWindowImplementation& window) {
     WindowsWindow* winWindow = static_cast<WindowsWindow*>(&window);
 
     // Remove from global map
-    {
-        Threading::ScopedLock lock(GWindowInstancesMutex);
-        for (int32_t i = 0; i < GWindowInstances.Length(); ++i) {
-            if (GWindowInstances[i] == winWindow) {
-                GWindowInstances.RemoveAt(i);
+    GWindowInstances.Update([winWindow](Containers::List<WindowsWindow*>& windows) {
+        for (int32_t i = 0; i < windows.Length(); ++i) {
+            if (windows[i] == winWindow) {
+                windows.RemoveAt(i);
                 break;
             }
         }
-    }
-
-    delete winWindow;
+    });
+    // Its pending state events can no longer be dispatched, free the slot they are kept in.
+    EventQueue.ForgetWindow(winWindow->GetWindowId());
+
+    // Another thread may be dispatching an event to the window right now, only the native window goes away here. The
+    // object is freed once every epoch critical section that could have found it has been left.
+    winWindow->DestroyNativeWindow();
+    Memory::EpochDomain::Global().Retire(winWindow);
 }
 
 void WindowsPlatformWindowing::PollEvents() {
+    PumpEvents();
+    DispatchEvents();
+}
+
+void WindowsPlatformWindowing::PumpEvents() {
+    // The window procedure only records events, the pump never waits on their handlers.
     MSG msg;
     while (PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE)) {
         TranslateMessage(&msg);
@@ -192,6 +218,59 @@ void WindowsPlatformWindowing::PollEvents() {
     }
 }
 
+int32_t WindowsPlatformWindowing::DispatchEvents() {
+    auto dispatch = [](const PlatformEvent& event) {
+        // Keeps the window alive until its handlers return, even if another thread destroys it meanwhile.
+        Memory::EpochGuard guard;
+        IWindowImplementation* window = FindLiveWindow(event.WindowId);
+        switch (event.Type) {
+        case PlatformEventType::Key:
+            // Devices still track input sent to a window destroyed meanwhile.
+            static_cast<WindowsKeyboardDevice*>(event.Device)
+                ->ProcessKeyMessage(window, event.Code, event.IsDown, event.IsRepeat);
+            break;
+        case PlatformEventType::TextInput:
+            static_cast<WindowsKeyboardDevice*>(event.Device)
+                ->ProcessTextInput(window, Containers::String(event.Text, event.TextLength));
+            break;
+        case PlatformEventType::MouseButton:
+            static_cast<WindowsMouseDevice*>(event.Device)->ProcessButtonMessage(window, event.Code, event.IsDown);
+            break;
+        case PlatformEventType::MouseMove:
+            static_cast<WindowsMouseDevice*>(event.Device)->ProcessMoveMessage(window, event.Position, event.Delta);
+            break;
+        case PlatformEventType::MouseWheel:
+            static_cast<WindowsMouseDevice*>(event.Device)->ProcessWheelMessage(window, event.Value);
+            break;
+        default:
+            if (window == nullptr) {
+                break;
+            }
+            switch (event.Type) {
+            case PlatformEventType::WindowClose:
+                window->HandleClose(0);
+                break;
+            case PlatformEventType::WindowResized:
+                window->HandleResized(event.Size);
+                break;
+            case PlatformEventType::WindowMoved:
+                window->HandleMoved(event.Position);
+                break;
+            case PlatformEventType::WindowFocusChanged:
+                window->HandleFocusChanged(event.Focused);
+                break;
+            case PlatformEventType::WindowDPIChanged:
+                window->HandleDPIChanged(event.Value);
+                break;
+            default:
+                break;
+            }
+            break;
+        }
+    };
+    return EventQueue.Drain(dispatch);
+}
+
 void WindowsPlatformWindowing::RegisterWindowClass() {
     WNDCLASSEXW wc = {};
     wc.cbSize = sizeof(WNDCLASSEXW);
@@ -252,9 +331,14 @@ WindowsWindow::WindowsWindow(void* hwnd, const Windowing::WindowDescriptor& desc
 }
 
 WindowsWindow::~WindowsWindow() {
+    // May run on any thread once retired, DestroyNativeWindow already took the HWND down.
+}
+
+void WindowsWindow::DestroyNativeWindow() {
     if (NativeHandle) {
+        // Messages sent while the window is torn down must not reach this object anymore.
+        SetWindowLongPtrW(static_cast<HWND>(NativeHandle), GWLP_USERDATA, 0);
         DestroyWindow(static_cast<HWND>(NativeHandle));
-        NativeHandle = nullptr;
     }
 }
 
@@ -412,9 +496,11 @@ void WindowsWindow::HandleDPIChange(uint32_t newDPI, const void* suggestedRect)
     SetWindowPos(static_cast<HWND>(NativeHandle), nullptr, rect->left, rect->top, rect->right - rect->left,
                  rect->bottom - rect->top, SWP_NOZORDER | SWP_NOACTIVATE);
 
-    // Update DPI scale and fire event
+    // Update DPI scale and queue the event
     CurrentDPIScale = static_cast<float>(newDPI) / 96.0f;
-    HandleDPIChanged(CurrentDPIScale);
+    PlatformEvent event(PlatformEventType::WindowDPIChanged, GetWindowId());
+    event.Value = CurrentDPIScale;
+    RecordEvent(event);
 }
 
 void WindowsWindow::HandleMonitorChange() { UpdateMonitorInfo(); }
@@ -429,31 +515,30 @@ bool WindowsWindow::OutputSupportsHDR() {
 int64_t WindowsWindow::WindowProc(uint32_t msg, uint64_t wParam, int64_t lParam) {
     switch (msg) {
     case WM_CLOSE: {
-        HandleClose(0);
+        RecordEvent(PlatformEvent(PlatformEventType::WindowClose, GetWindowId()));
         return 0; // Don't destroy automatically
     }
 
     case WM_SIZE: {
-        Math::Vector2<int32_t> newSize(LOWORD(lParam), HIWORD(lParam));
-        HandleResized(newSize);
+        PlatformEvent event(PlatformEventType::WindowResized, GetWindowId());
+        event.Size = Math::Vector2<int32_t>(LOWORD(lParam), HIWORD(lParam));
+        RecordEvent(event);
         return 0;
     }
 
     case WM_MOVE: {
-        Math::Vector2<int32_t> newPos(LOWORD(lParam), HIWORD(lParam));
-        HandleMoved(newPos);
-        return 0;
-    }
-
-    case WM_SETFOCUS: {
-        Focused = true;
-        HandleFocusChanged(true);
+        PlatformEvent event(PlatformEventType::WindowMoved, GetWindowId());
+        event.Position = Math::Vector2<int32_t>(LOWORD(lParam), HIWORD(lParam));
+        RecordEvent(event);
         return 0;
     }
 
+    case WM_SETFOCUS:
     case WM_KILLFOCUS: {
-        Focused = false;
-        HandleFocusChanged(false);
+        Focused = (msg == WM_SETFOCUS);
+        PlatformEvent event(PlatformEventType::WindowFocusChanged, GetWindowId());
+        event.Focused = Focused;
+        RecordEvent(event);
         return 0;
     }
 
@@ -471,24 +556,26 @@ int64_t WindowsWindow::WindowProc(uint32_t msg, uint64_t wParam, int64_t lParam)
 
     case WM_KEYDOWN:
     case WM_KEYUP: {
-        // Route to input system - it will call our HandleKeyEvent
+        // Queued for the input system - dispatching calls our HandleKeyEvent
         auto& input = static_cast<Windows::WindowsPlatformInput&>(Platform::GetPlatform().GetInput());
         if (WindowsKeyboardDevice* keyboard = input.GetPrimaryKeyboard()) {
-            int32_t keyCode = static_cast<int32_t>(wParam);
-            bool isDown = (msg == WM_KEYDOWN);
-            bool isRepeat = (lParam & 0x40000000) != 0;
-            keyboard->ProcessKeyMessage(this, keyCode, isDown, isRepeat);
+            PlatformEvent event(PlatformEventType::Key, GetWindowId(), keyboard);
+            event.Code = static_cast<int32_t>(wParam);
+            event.IsDown = (msg == WM_KEYDOWN);
+            event.IsRepeat = (lParam & 0x40000000) != 0;
+            RecordEvent(event);
         }
         return 0;
     }
 
     case WM_CHAR: {
-        // Route to input system - it will call our HandleTextInput
+        // Queued for the input system - dispatching calls our HandleTextInput
         auto& input = static_cast<Windows::WindowsPlatformInput&>(Platform::GetPlatform().GetInput());
         if (WindowsKeyboardDevice* keyboard = input.GetPrimaryKeyboard()) {
-            wchar_t ch = static_cast<wchar_t>(wParam);
-            Containers::String text(reinterpret_cast<const char16_t*>(&ch), 1);
-            keyboard->ProcessTextInput(this, text);
+            PlatformEvent event(PlatformEventType::TextInput, GetWindowId(), keyboard);
+            event.Text[0] = static_cast<char16_t>(wParam);
+            event.TextLength = 1;
+            RecordEvent(event);
         }
         return 0;
     }
@@ -530,10 +617,13 @@ int64_t WindowsWindow::WindowProc(uint32_t msg, uint64_t wParam, int64_t lParam)
             }
         }
 
-        // Route to input system - it will call our HandleMouseButton
+        // Queued for the input system - dispatching calls our HandleMouseButton
         auto& input = static_cast<Windows::WindowsPlatformInput&>(Platform::GetPlatform().GetInput());
         if (WindowsMouseDevice* mouse = input.GetPrimaryMouse()) {
-            mouse->ProcessButtonMessage(this, button, isDown);
+            PlatformEvent event(PlatformEventType::MouseButton, GetWindowId(), mouse);
+            event.Code = button;
+            event.IsDown = isDown;
+            RecordEvent(event);
         }
 
         return 0;
@@ -542,10 +632,13 @@ int64_t WindowsWindow::WindowProc(uint32_t msg, uint64_t wParam, int64_t lParam)
     case WM_MOUSEMOVE: {
         Math::Vector2<int32_t> currentPos(GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
 
-        // Route to input system - it will call our HandleMouseMove
+        // Queued for the input system - consecutive moves are coalesced, dispatching calls our HandleMouseMove
         auto& input = static_cast<Windows::WindowsPlatformInput&>(Platform::GetPlatform().GetInput());
         if (WindowsMouseDevice* mouse = input.GetPrimaryMouse()) {
-            mouse->ProcessMoveMessage(this, currentPos);
+            PlatformEvent event(PlatformEventType::MouseMove, GetWindowId(), mouse);
+            event.Position = currentPos;
+            event.Delta = currentPos - LastMousePosition;
+            RecordEvent(event);
         }
 
         // Update last mouse position for wheel events
@@ -556,10 +649,13 @@ int64_t WindowsWindow::WindowProc(uint32_t msg, uint64_t wParam, int64_t lParam)
     case WM_MOUSEWHEEL: {
         float wheelDelta = static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam)) / WHEEL_DELTA;
 
-        // Route to input system - it will call our HandleMouseWheel
+        // Queued for the input system - dispatching calls our HandleMouseWheel
         auto& input = static_cast<Windows::WindowsPlatformInput&>(Platform::GetPlatform().GetInput());
         if (WindowsMouseDevice* mouse = input.GetPrimaryMouse()) {
-            mouse->ProcessWheelMessage(this, wheelDelta);
+            PlatformEvent event(PlatformEventType::MouseWheel, GetWindowId(), mouse);
+            event.Position = LastMousePosition;
+            event.Value = wheelDelta;
+            RecordEvent(event);
         }
         return 0;
     }
@@ -574,6 +670,8 @@ int64_t WindowsWindow::WindowProc(uint32_t msg, uint64_t wParam, int64_t lParam)
 // ============================================================================
 
 static LRESULT CALLBACK GlobalWindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+    // The window may be destroyed from the dispatching thread while this one is still inside its procedure.
+    Memory::EpochGuard guard;
     WindowsWindow* window = reinterpret_cast<WindowsWindow*>(GetWindowLongPtrW(hwnd, GWLP_USERDATA));
 
     if (window) {
@@ -8,21 +8,24 @@
 #    include "Rendering/Vulkan/VulkanRenderingAPI.hpp"
 #endif
 namespace Edvar::Renderer::RHI {
-SharedPointer<IRenderingAPI> IRenderingAPI::ActiveAPI;
+Memory::Published<SharedPointer<IRenderingAPI, true>> IRenderingAPI::ActiveAPI;
 IRenderDeviceDependent::~IRenderDeviceDependent() {
     if (associatedDevice.IsValid()) [[likely]] {
-        associatedDevice->dependents.Remove(this);
+        associatedDevice->dependents.Remove(dependentHandle);
     }
 }
 IRenderDeviceDependent::IRenderDeviceDependent(const SharedReference<IRenderDevice>& device)
     : associatedDevice(device) {
-    device->dependents.Add(this);
+    dependentHandle = device->dependents.Add(this);
 }
 SharedReference<IRenderDevice> IRenderDeviceDependent::GetAssociatedDevice() const { return associatedDevice; }
 void IRenderDeviceDependent::CheckDeviceSanity() const { GetAssociatedDevice()->DoCheckDeviceSanity(); }
 
 void IRenderDeviceDependent::OnRenderDeviceRestored(IRenderDevice& newDevice) {
+    // The handle belongs to the old device's map, move the registration over to the new device.
+    associatedDevice->dependents.Remove(dependentHandle);
     associatedDevice = newDevice.AsShared();
+    dependentHandle = associatedDevice->dependents.Add(this);
 }
 
 IRenderingAPI::~IRenderingAPI() = default;
@@ -33,27 +36,28 @@ SharedReference<IRenderDevice> IRenderingAPI::GetPrimaryDevice() {
     }
     return PrimaryDevice;
 }
-SharedReference<IRenderingAPI> IRenderingAPI::GetActiveAPI(const bool bSelectIfNull) {
-    if (bSelectIfNull && !ActiveAPI.IsValid()) [[unlikely]] {
+RenderingAPIRef IRenderingAPI::GetActiveAPI(const bool bSelectIfNull) {
+    {
+        const auto activeAPI = ActiveAPI.Read();
+        if (activeAPI->IsValid() || !bSelectIfNull) [[likely]] {
+            return activeAPI->ToSharedReference();
+        }
+    }
 #if _WIN32
-        SetActiveAPI(MakeShared<D3D12::D3D12RenderingAPI>());
+    SetActiveAPI(MakeShared<D3D12::D3D12RenderingAPI, true>());
 #else
-        SetActiveAPI(MakeShared<Vulkan::VulkanRenderingAPI>());
+    SetActiveAPI(MakeShared<Vulkan::VulkanRenderingAPI, true>());
 #endif
-    }
-    return ActiveAPI.ToSharedReference();
+    return ActiveAPI.Read()->ToSharedReference();
 }
-void IRenderingAPI::SetActiveAPI(const SharedReference<IRenderingAPI>& newAPI) {
-    const SharedPointer<IRenderingAPI> oldAPI = ActiveAPI;
-    if (ActiveAPI) {
-        // Notify listeners about the change.
-    }
-    ActiveAPI = newAPI;
-    OnRenderingAPIChanged().Broadcast(oldAPI, ActiveAPI);
+void IRenderingAPI::SetActiveAPI(const RenderingAPIRef& newAPI) {
+    // Waits for the readers instead of retiring the old version, so the old API and its devices are not released
+    // later on whichever thread happens to reclaim it
+    const SharedPointer<IRenderingAPI, true> oldAPI = ActiveAPI.Exchange(newAPI);
+    OnRenderingAPIChanged().Broadcast(oldAPI, newAPI);
 }
-Utils::MultiDelegate<void(SharedReference<IRenderingAPI>, SharedReference<IRenderingAPI>)>
-IRenderingAPI::OnRenderingAPIChanged() {
-    static Utils::MultiDelegate<void(SharedReference<IRenderingAPI>, SharedReference<IRenderingAPI>)> delegate;
+Utils::MultiDelegate<void(RenderingAPIRef, RenderingAPIRef)> IRenderingAPI::OnRenderingAPIChanged() {
+    static Utils::MultiDelegate<void(RenderingAPIRef, RenderingAPIRef)> delegate;
     return delegate;
 }
 Utils::MultiDelegate<void(SharedReference<IRenderDevice>)> IRenderingAPI::OnRenderDeviceLost() {
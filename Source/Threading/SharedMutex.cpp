@@ -0,0 +1,99 @@
+#include "Threading/SharedMutex.hpp"
+#include "Threading/SpinLock.hpp"
+
+namespace Edvar::Threading {
+namespace {
+// Waits are usually short, spin briefly before sleeping.
+constexpr int32_t SpinCount = 64;
+} // namespace
+
+void SharedMutex::LockSharedSlow() {
+    int32_t spins = 0;
+    int32_t current = state.Load(Memory::MemoryOrder::Relaxed);
+    while (true) {
+        if ((current & WriterFlag) == 0) {
+            // A failed exchange reloads current.
+            if (state.CompareExchange(current, current + 1, Memory::MemoryOrder::Acquire)) {
+                return;
+            }
+            continue;
+        }
+        if (spins < SpinCount) {
+            ++spins;
+            CpuRelax();
+            current = state.Load(Memory::MemoryOrder::Relaxed);
+            continue;
+        }
+        if ((current & ReadersWaitingFlag) == 0 &&
+            !state.CompareExchange(current, current | ReadersWaitingFlag, Memory::MemoryOrder::Relaxed)) {
+            continue;
+        }
+        WaitOnAddress(state, current | ReadersWaitingFlag);
+        current = state.Load(Memory::MemoryOrder::Relaxed);
+    }
+}
+
+bool SharedMutex::TryLockShared() {
+    int32_t current = state.Load(Memory::MemoryOrder::Relaxed);
+    while ((current & WriterFlag) == 0) {
+        if (state.CompareExchange(current, current + 1, Memory::MemoryOrder::Acquire)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SharedMutex::Lock() {
+    // Writers queue on the gate, only one of them at a time competes with the readers.
+    int32_t expected = 0;
+    if (!writerGate.CompareExchange(expected, 1, Memory::MemoryOrder::Acquire)) {
+        bool acquired = false;
+        for (int32_t i = 0; i < SpinCount && !acquired; ++i) {
+            CpuRelax();
+            expected = 0;
+            acquired = writerGate.Load(Memory::MemoryOrder::Relaxed) == 0 &&
+                       writerGate.CompareExchange(expected, 1, Memory::MemoryOrder::Acquire);
+        }
+        if (!acquired) {
+            while (writerGate.Exchange(2, Memory::MemoryOrder::Acquire) != 0) {
+                WaitOnAddress(writerGate, 2);
+            }
+        }
+    }
+
+    // Stop new readers, then wait for the current ones to drain.
+    int32_t current = state.FetchAdd(WriterFlag, Memory::MemoryOrder::AcquireAndRelease) + WriterFlag;
+    for (int32_t spins = 0; (current & ReaderMask) != 0; ++spins) {
+        if (spins < SpinCount) {
+            CpuRelax();
+        } else {
+            WaitOnAddress(state, current);
+        }
+        current = state.Load(Memory::MemoryOrder::Acquire);
+    }
+}
+
+bool SharedMutex::TryLock() {
+    int32_t expected = 0;
+    if (!writerGate.CompareExchange(expected, 1, Memory::MemoryOrder::Acquire)) {
+        return false;
+    }
+    expected = 0;
+    if (state.CompareExchange(expected, WriterFlag, Memory::MemoryOrder::Acquire)) {
+        return true;
+    }
+    if (writerGate.Exchange(0, Memory::MemoryOrder::Release) == 2) {
+        WakeOnAddress(writerGate);
+    }
+    return false;
+}
+
+void SharedMutex::Release() {
+    if ((state.Exchange(0, Memory::MemoryOrder::Release) & ReadersWaitingFlag) != 0) {
+        WakeAllOnAddress(state);
+    }
+    if (writerGate.Exchange(0, Memory::MemoryOrder::Release) == 2) {
+        WakeOnAddress(writerGate);
+    }
+}
+} // namespace Edvar::Threading
@@ -0,0 +1,53 @@
+#include "Threading/Signal.hpp"
+#include <chrono>
+
+namespace Edvar::Threading {
+namespace {
+int64_t GetMonotonicMilliseconds() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace
+
+bool Signal::Wait(const int32_t Milliseconds) {
+    const int32_t observed = generation.Load(Memory::MemoryOrder::SequentiallyConsistent);
+    return WaitForChange(observed, Milliseconds < 0 ? -1 : GetDeadline(Milliseconds));
+}
+
+void Signal::NotifyOne() {
+    generation.FetchAdd(1, Memory::MemoryOrder::SequentiallyConsistent);
+    if (waiterCount.Load(Memory::MemoryOrder::SequentiallyConsistent) > 0) {
+        WakeOnAddress(generation);
+    }
+}
+
+void Signal::NotifyAll() {
+    generation.FetchAdd(1, Memory::MemoryOrder::SequentiallyConsistent);
+    if (waiterCount.Load(Memory::MemoryOrder::SequentiallyConsistent) > 0) {
+        WakeAllOnAddress(generation);
+    }
+}
+
+int64_t Signal::GetDeadline(const int32_t Milliseconds) { return GetMonotonicMilliseconds() + Milliseconds; }
+
+bool Signal::WaitForChange(const int32_t Observed, const int64_t Deadline) {
+    while (true) {
+        int32_t remaining = -1;
+        if (Deadline >= 0) {
+            const int64_t now = GetMonotonicMilliseconds();
+            if (now >= Deadline) {
+                return generation.Load(Memory::MemoryOrder::Acquire) != Observed;
+            }
+            remaining = static_cast<int32_t>(Deadline - now);
+        }
+        // Registered before sleeping: a notifier that misses the registration already changed the generation, so the
+        // wait below does not block.
+        waiterCount.FetchAdd(1, Memory::MemoryOrder::SequentiallyConsistent);
+        WaitOnAddress(generation, Observed, remaining);
+        waiterCount.FetchAdd(-1, Memory::MemoryOrder::Relaxed);
+        if (generation.Load(Memory::MemoryOrder::Acquire) != Observed) {
+            return true;
+        }
+    }
+}
+} // namespace Edvar::Threading
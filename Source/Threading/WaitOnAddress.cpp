@@ -0,0 +1,69 @@
+#include "Threading/WaitOnAddress.hpp"
+
+#if defined(_WIN32)
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#elif defined(__linux__)
+#    include <cerrno>
+#    include <ctime>
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#else
+#    include "Platform/IPlatformThreading.hpp"
+#endif
+
+namespace Edvar::Threading {
+// Atomic<int32_t> keeps its value as the first member, so its address is the address of the 32-bit word.
+#if defined(_WIN32)
+bool WaitOnAddress(const Memory::Atomic<int32_t>& Address, int32_t Expected, const int32_t Milliseconds) {
+    const DWORD timeOut = (Milliseconds < 0) ? INFINITE : static_cast<DWORD>(Milliseconds);
+    if (::WaitOnAddress(const_cast<Memory::Atomic<int32_t>*>(&Address), &Expected, sizeof(int32_t), timeOut)) {
+        return true;
+    }
+    return GetLastError() != ERROR_TIMEOUT;
+}
+void WakeOnAddress(const Memory::Atomic<int32_t>& Address) {
+    ::WakeByAddressSingle(const_cast<Memory::Atomic<int32_t>*>(&Address));
+}
+void WakeAllOnAddress(const Memory::Atomic<int32_t>& Address) {
+    ::WakeByAddressAll(const_cast<Memory::Atomic<int32_t>*>(&Address));
+}
+#elif defined(__linux__)
+namespace {
+long Futex(const Memory::Atomic<int32_t>& Address, const int Operation, const int32_t Value,
+           const timespec* TimeOut) {
+    return syscall(SYS_futex, reinterpret_cast<const int32_t*>(&Address), Operation, Value, TimeOut, nullptr, 0);
+}
+} // namespace
+
+bool WaitOnAddress(const Memory::Atomic<int32_t>& Address, const int32_t Expected, const int32_t Milliseconds) {
+    timespec timeOut{};
+    if (Milliseconds >= 0) {
+        timeOut.tv_sec = Milliseconds / 1000;
+        timeOut.tv_nsec = static_cast<long>(Milliseconds % 1000) * 1000000;
+    }
+    // The kernel compares the value itself, a change between the caller's load and the wait is never missed.
+    const long result = Futex(Address, FUTEX_WAIT_PRIVATE, Expected, Milliseconds >= 0 ? &timeOut : nullptr);
+    return result == 0 || errno != ETIMEDOUT;
+}
+void WakeOnAddress(const Memory::Atomic<int32_t>& Address) { Futex(Address, FUTEX_WAKE_PRIVATE, 1, nullptr); }
+void WakeAllOnAddress(const Memory::Atomic<int32_t>& Address) {
+    Futex(Address, FUTEX_WAKE_PRIVATE, 0x7FFFFFFF, nullptr);
+}
+#else
+// No wait-on-address primitive, poll with a short sleep.
+bool WaitOnAddress(const Memory::Atomic<int32_t>& Address, const int32_t Expected, const int32_t Milliseconds) {
+    Platform::IThreadImplementation& currentThread = Platform::IThreadImplementation::GetCurrentThread();
+    for (int32_t elapsed = 0; Milliseconds < 0 || elapsed < Milliseconds; ++elapsed) {
+        if (Address.Load(Memory::MemoryOrder::Acquire) != Expected) {
+            return true;
+        }
+        currentThread.Sleep(1);
+    }
+    return Address.Load(Memory::MemoryOrder::Acquire) != Expected;
+}
+void WakeOnAddress(const Memory::Atomic<int32_t>&) {}
+void WakeAllOnAddress(const Memory::Atomic<int32_t>&) {}
+#endif
+} // namespace Edvar::Threading
@@ -48,12 +48,9 @@ void vsnprintf_WriteToBuffer(char16_t* buffer, uint32_t bufferLength, int32_t& c
     ++currentIndex;
 }
 int32_t ToCharString(const wchar_t* inString, char* buffer, const int32_t bufferLength) {
-    const int32_t utf16Size = ToUtf16String(inString, nullptr, bufferLength);
-    auto* utf16Buffer = new char16_t[utf16Size];
-    ToUtf16String(inString, utf16Buffer, utf16Size);
-    const int32_t resultSize = ToCharString(utf16Buffer, buffer, bufferLength);
-    delete[] utf16Buffer;
-    return resultSize;
+    const Memory::ScratchMarker scratch;
+    const char16_t* utf16Buffer = CreateScratchConvertedString<char16_t>(inString);
+    return utf16Buffer != nullptr ? ToCharString(utf16Buffer, buffer, bufferLength) : 0;
 }
 int32_t ToCharString(const char8_t* inString, char* buffer, const int32_t bufferLength) {
     if (auto* bufferUtf8 = reinterpret_cast<char8_t*>(buffer); bufferUtf8 != inString) {
@@ -69,11 +66,9 @@ int32_t ToCharString(const char16_t* inString, char* buffer, const int32_t buffe
     return writeSize;
 }
 int32_t ToCharString(const char32_t* inString, char* buffer, const int32_t bufferLength) {
-    const int32_t requiredBufferLength = ToUtf16String(inString, nullptr, 0);
-    const auto* bufferUtf16 = new wchar_t[requiredBufferLength];
-    const int32_t resultStrLength = ToCharString(bufferUtf16, buffer, bufferLength);
-    delete[] bufferUtf16;
-    return resultStrLength;
+    const Memory::ScratchMarker scratch;
+    const char16_t* utf16Buffer = CreateScratchConvertedString<char16_t>(inString);
+    return utf16Buffer != nullptr ? ToCharString(utf16Buffer, buffer, bufferLength) : 0;
 }
 int32_t ToWCharString(const char* inString, wchar_t* buffer, const int32_t bufferLength) {
     return static_cast<int32_t>(mbstowcs(buffer, inString, bufferLength));
@@ -88,12 +83,9 @@ int32_t ToWCharString(const char16_t* inString, wchar_t* buffer, const int32_t b
     return resultLength;
 }
 int32_t ToWCharString(const char32_t* inString, wchar_t* buffer, const int32_t bufferLength) {
-    const int32_t utf16Size = ToUtf16String(inString, nullptr, 0);
-    auto* utf16Buffer = new char16_t[utf16Size];
-    ToUtf16String(inString, utf16Buffer, utf16Size);
-    const int32_t resultSize = ToWCharString(utf16Buffer, buffer, bufferLength);
-    delete[] utf16Buffer;
-    return resultSize;
+    const Memory::ScratchMarker scratch;
+    const char16_t* utf16Buffer = CreateScratchConvertedString<char16_t>(inString);
+    return utf16Buffer != nullptr ? ToWCharString(utf16Buffer, buffer, bufferLength) : 0;
 }
 int32_t ToUtf8String(const char* inString, char8_t* buffer, const int32_t bufferLength) {
     if (const auto* utf8InString = reinterpret_cast<const char8_t*>(inString); utf8InString != buffer) {
@@ -132,20 +124,14 @@ int32_t ToUtf16String(const char32_t* inString, char16_t* buffer, const int32_t
     return resultSize;
 }
 int32_t ToUtf32String(const char* inString, char32_t* buffer, const int32_t bufferLength) {
-    const int32_t utf16Length = ToUtf16String(inString, nullptr, 0);
-    auto* utf16Buffer = new char16_t[utf16Length];
-    ToUtf16String(inString, utf16Buffer, utf16Length);
-    const int32_t resultSize = ToUtf32String(utf16Buffer, buffer, bufferLength);
-    delete[] utf16Buffer;
-    return resultSize;
+    const Memory::ScratchMarker scratch;
+    const char16_t* utf16Buffer = CreateScratchConvertedString<char16_t>(inString);
+    return utf16Buffer != nullptr ? ToUtf32String(utf16Buffer, buffer, bufferLength) : 0;
 }
 int32_t ToUtf32String(const wchar_t* inString, char32_t* buffer, const int32_t bufferLength) {
-    const int32_t utf16Length = ToUtf16String(inString, nullptr, 0);
-    auto* utf16Buffer = new char16_t[utf16Length];
-    ToUtf16String(inString, utf16Buffer, utf16Length);
-    const int32_t resultSize = ToUtf32String(utf16Buffer, buffer, bufferLength);
-    delete[] utf16Buffer;
-    return resultSize;
+    const Memory::ScratchMarker scratch;
+    const char16_t* utf16Buffer = CreateScratchConvertedString<char16_t>(inString);
+    return utf16Buffer != nullptr ? ToUtf32String(utf16Buffer, buffer, bufferLength) : 0;
 }
 int32_t ToUtf32String(const char8_t* inString, char32_t* buffer, const int32_t bufferLength) {
     return ToUtf32String(reinterpret_cast<const char*>(inString), buffer, bufferLength);
@@ -157,14 +143,14 @@ int32_t ToUtf32String(const char16_t* inString, char32_t* buffer, const int32_t
     return resultSize;
 }
 
-int32_t ToLower(char16_t* inString, char16_t* outString, int32_t bufferLength, const I18N::Locale* inLocale) {
+int32_t ToLower(const char16_t* inString, char16_t* outString, int32_t bufferLength, const I18N::Locale* inLocale) {
     UErrorCode errorCode = U_ZERO_ERROR;
     const I18N::Locale& locale = inLocale ? *inLocale : I18N::Locale::Default();
     return u_strToLower(outString, bufferLength, inString, -1,
                         static_cast<const icu::Locale*>(locale.GetData())->getName(), &errorCode);
 }
 
-int32_t ToUpper(char16_t* inString, char16_t* outString, int32_t bufferLength, const I18N::Locale* inLocale) {
+int32_t ToUpper(const char16_t* inString, char16_t* outString, int32_t bufferLength, const I18N::Locale* inLocale) {
     UErrorCode errorCode = U_ZERO_ERROR;
     const I18N::Locale& locale = inLocale ? *inLocale : I18N::Locale::Default();
     return u_strToUpper(outString, bufferLength, inString, -1,
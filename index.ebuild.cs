@@ -34,8 +34,8 @@ class EdvarCppCore : ModuleBase
 
         this.ForceIncludes.Public.Add("Source/ForceInclude.hpp");
 
-        this.Definitions.Private.Add($"EDVAR_CPP_CORE_MATH_ALLOW_SIMD={(this.AllowSimd ? 1 : 0)}");
-        this.Definitions.Private.Add($"EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX={(this.EnableAvx ? 1 : 0)}");
+        this.Definitions.Public.Add($"EDVAR_CPP_CORE_MATH_ALLOW_SIMD={(this.AllowSimd ? 1 : 0)}");
+        this.Definitions.Public.Add($"EDVAR_CPP_CORE_MATH_ALLOW_SIMD_AVX={(this.EnableAvx ? 1 : 0)}");
 
         if(this.DebugTraceAllocators && context.Configuration == "debug")
         {
@@ -64,6 +64,7 @@ class EdvarCppCore : ModuleBase
             this.Libraries.Private.Add("d3d12.lib");
             this.Libraries.Private.Add("dxgi.lib");
             this.Libraries.Private.Add("Shcore.lib");
+            this.Libraries.Private.Add("Synchronization.lib");
         }
         else if (context.Platform.Name == "linux")
         {